@@ -0,0 +1,263 @@
+#!/bin/sh
+# benchmark.sh - run the standard benchmark workloads
+#
+# usage: benchmark.sh [<bindir> [<datadir> [<report>]]]
+#
+# <bindir>  directory with the emulators, petcat and c1541 (default: src)
+# <datadir> directory with the ROM sets (default: data next to this script)
+# <report>  file the results are appended to (default: benchmark.json)
+#
+# Every workload runs in warp mode for BENCH_CYCLES cycles (default
+# 20000000) and adds one line of JSON to the report, see `-benchmark'.
+# The PAL renderer workload needs a display and only runs when DISPLAY is
+# set or BENCH_RENDER=1.
+
+bindir=${1:-src}
+datadir=${2:-`dirname $0`/data}
+report=${3:-benchmark.json}
+cycles=${BENCH_CYCLES:-20000000}
+
+if test x"$BENCH_RENDER" = "x" -a x"$DISPLAY" != "x"; then
+  BENCH_RENDER=1
+fi
+
+if test ! -x $bindir/petcat -o ! -x $bindir/c1541; then
+  echo "$bindir/petcat and $bindir/c1541 are needed to build the workloads"
+  exit 1
+fi
+
+tmpdir=${TMPDIR:-/tmp}/vice-benchmark.$$
+mkdir $tmpdir || exit 1
+trap 'rm -rf $tmpdir' 0 1 2 15
+
+failed=0
+
+# bytes <hex> ...: write raw bytes
+bytes()
+{
+  for b in $*
+  do
+    printf "\\`printf '%03o' 0x$b`"
+  done
+}
+
+# pad32 <string>: write a string as a zero padded 32 byte PSID field
+pad32()
+{
+  printf '%s' "$1"
+  n=`expr 32 - ${#1}`
+  while test $n -gt 0
+  do
+    printf '\000'
+    n=`expr $n - 1`
+  done
+}
+
+# basic <source> <program> <petcat options>: tokenize $tmpdir/<source>.txt
+# into $tmpdir/<program>.prg
+basic()
+{
+  src=$1
+  prg=$2
+  shift 2
+  $bindir/petcat $* -o $tmpdir/$prg.prg -- $tmpdir/$src.txt >/dev/null 2>&1
+}
+
+# romdirs <emulator>: ROM search path for the emulator
+romdirs()
+{
+  case "$1" in
+    x64|x64sc|vsid) dir=C64 ;;
+    x128)           dir=C128 ;;
+    xscpu64)        dir=SCPU64 ;;
+    xvic)           dir=VIC20 ;;
+    xplus4)         dir=PLUS4 ;;
+    xpet)           dir=PET ;;
+  esac
+  echo "$datadir/$dir:$datadir/DRIVES:$datadir/PRINTER"
+}
+
+# run <workload> <emulator> <options> ...
+run()
+{
+  workload=$1
+  emu=$2
+  shift 2
+
+  if test ! -x $bindir/$emu; then
+    echo "$emu: not built, skipping $workload"
+    return
+  fi
+
+  echo "$emu: $workload"
+  rm -f $tmpdir/result.json
+  if test x"$BENCH_RENDER" = "x1" -a x"$workload" = "xpal-renderer"; then
+    console=
+  else
+    console=-console
+  fi
+  # The cycle limit exits with an error status, so only check the report.
+  $bindir/$emu -default $console -directory `romdirs $emu` -warp -sounddev dummy \
+    -limitcycles $cycles -benchmark $tmpdir/result.json "$@" >$tmpdir/$emu.log 2>&1
+  if test -s $tmpdir/result.json; then
+    sed -e "s/^{/{\"workload\":\"$workload\",/" $tmpdir/result.json >>$report
+  else
+    echo "$emu: $workload failed, see the log below"
+    tail -20 $tmpdir/$emu.log
+    failed=`expr $failed + 1`
+  fi
+}
+
+# CPU-bound BASIC loop
+
+cat >$tmpdir/cpu.txt <<EOF
+10 t=0
+20 for i=1 to 1000
+30 t=t+i*2/3:a\$=str\$(i)
+40 next
+50 goto 10
+EOF
+
+basic cpu cpu-c64 -w2 -l 0801
+basic cpu cpu-c128 -w70 -l 1c01
+basic cpu cpu-vic20 -w2 -l 1001
+basic cpu cpu-plus4 -w3 -l 1001
+basic cpu cpu-pet -w40 -l 0401
+
+run cpu-basic x64 -autostart $tmpdir/cpu-c64.prg
+run cpu-basic x64sc -autostart $tmpdir/cpu-c64.prg
+run cpu-basic xscpu64 -autostart $tmpdir/cpu-c64.prg
+run cpu-basic x128 -autostart $tmpdir/cpu-c128.prg
+run cpu-basic xvic -autostart $tmpdir/cpu-vic20.prg
+run cpu-basic xplus4 -autostart $tmpdir/cpu-plus4.prg
+run cpu-basic xpet -autostart $tmpdir/cpu-pet.prg
+
+# SuperCPU machine code in warp: the same add loop over 4KB in emulation
+# mode (8 bit registers) and in native mode with 16 bit registers, with
+# interrupts off.  Each pass through the loop increments $0400.
+
+{
+  # load address and 10 SYS2061
+  bytes 01 08 0b 08 0a 00 9e 32 30 36 31 00 00 00
+  # sei; ldx #0; lda $1000,x; adc $2000,x; sta $3000,x; inx; bne;
+  # inc $0400; jmp $080e
+  bytes 78 a2 00 bd 00 10 7d 00 20 9d 00 30 e8 d0 f4 ee 00 04 4c 0e 08
+} >$tmpdir/scpu-emulation.prg
+
+{
+  bytes 01 08 0b 08 0a 00 9e 32 30 36 31 00 00 00
+  # sei; clc; xce; rep #$30; ldx #0; lda $1000,x; adc $2000,x;
+  # sta $3000,x; inx; inx; cpx #$1000; bne; inc $0400; bra $0812
+  bytes 78 18 fb c2 30 a2 00 00 bd 00 10 7d 00 20 9d 00 30 e8 e8 e0
+  bytes 00 10 d0 f0 ee 00 04 80 e8
+} >$tmpdir/scpu-native.prg
+
+run scpu-emulation xscpu64 -autostart $tmpdir/scpu-emulation.prg
+run scpu-native xscpu64 -autostart $tmpdir/scpu-native.prg
+
+# Sprite-heavy VIC-II scene: eight expanded multicolour sprites moving
+# across the screen.  The C128 BASIC interrupt rewrites the sprite
+# registers, so x128 runs it in C64 mode.
+
+cat >$tmpdir/sprites.txt <<EOF
+10 for i=832 to 894:poke i,170+(i and 1)*15:next
+20 for i=0 to 7:poke 2040+i,13:poke 53287+i,i+1:poke 53249+i*2,50+i*20:next
+30 poke 53269,255:poke 53276,255:poke 53277,255:poke 53271,255
+40 for x=0 to 255:for i=0 to 14 step 2:poke 53248+i,x:next:next
+50 goto 40
+EOF
+
+basic sprites sprites -w2 -l 0801
+
+run vicii-sprites x64 -autostart $tmpdir/sprites.prg
+run vicii-sprites x64sc -autostart $tmpdir/sprites.prg
+run vicii-sprites xscpu64 -autostart $tmpdir/sprites.prg
+run vicii-sprites x128 -go64 -autostart $tmpdir/sprites.prg
+
+# 3-SID tune: all nine voices sweeping, reSID at $d400, $d420 and $d440
+
+cat >$tmpdir/sid3.txt <<EOF
+10 s(0)=54272:s(1)=54304:s(2)=54336
+20 for j=0 to 2:b=s(j):poke b+24,15
+30 for v=0 to 14 step 7:poke b+v+5,0:poke b+v+6,240:poke b+v+3,8:poke b+v+4,65:next:next
+40 for f=0 to 255:for j=0 to 2:poke s(j)+1,f:poke s(j)+8,255-f:poke s(j)+15,f/2:next:next
+50 goto 40
+EOF
+
+basic sid3 sid3 -w2 -l 0801
+
+run sid-3x x64sc -sound -sidstereo 2 -sidstereoaddress 0xd420 \
+  -sidtripleaddress 0xd440 -autostart $tmpdir/sid3.prg
+
+# The same for vsid as a PSID v3 file; the reserved word holds the middle
+# nybbles of the second and third SID address.
+
+{
+  printf 'PSID'
+  bytes 00 03 00 7c 00 00 10 00 10 03 00 01 00 01 00 00 00 00
+  pad32 "benchmark"
+  pad32 "VICE"
+  pad32 ""
+  bytes 00 14 00 00 42 44
+  # load address, then init at $1000 and play at $1003
+  bytes 00 10
+  bytes 4c 06 10 4c 2e 10
+  # init: gate all nine voices, full volume on all three SIDs
+  bytes a2 08 bc 44 10 a9 f0 99 06 d4 a9 00 99 05 d4 a9 41 99 04 d4
+  bytes a9 08 99 03 d4 ca 10 e6 a9 0f 8d 18 d4 8d 38 d4 8d 58 d4 60
+  # play: sweep the frequencies
+  bytes ee 4d 10 a2 08 bc 44 10 8a 6d 4d 10 99 01 d4 99 00 d4 ca 10
+  bytes f0 60
+  # voice offsets and the counter
+  bytes 00 07 0e 20 27 2e 40 47 4e 00
+} >$tmpdir/sid3.sid
+
+run sid-3x vsid -sound $tmpdir/sid3.sid
+
+# True drive disk load: the loader LOADs a 33 block file over and over
+# (LOAD from a program restarts it).
+
+cat >$tmpdir/loader.txt <<EOF
+10 load"data",8,1
+EOF
+
+basic loader loader -w2 -l 0801
+{
+  bytes 00 20
+  awk 'BEGIN { for (i = 0; i < 8192; i++) printf "%c", 65 + i % 26 }'
+} >$tmpdir/data.prg
+$bindir/c1541 -format "bench,01" d64 $tmpdir/bench.d64 \
+  -write $tmpdir/loader.prg loader -write $tmpdir/data.prg data >/dev/null 2>&1
+
+run truedrive-load x64 -truedrive +autostart-handle-tde -autostart $tmpdir/bench.d64
+run truedrive-load x64sc -truedrive +autostart-handle-tde -autostart $tmpdir/bench.d64
+
+# REU DMA: stash all 64KB of C64 memory, then fetch 32KB to $2000-$9fff,
+# with autoload so the registers keep their values.
+
+cat >$tmpdir/reu.txt <<EOF
+10 poke 55,0:poke 56,32:clr:b=57088
+20 poke b+2,0:poke b+3,0:poke b+4,0:poke b+5,0:poke b+6,0:poke b+7,0:poke b+8,0
+30 poke b+1,176
+40 poke b+3,32:poke b+6,1:poke b+8,128
+50 poke b+1,177
+60 goto 20
+EOF
+
+basic reu reu -w2 -l 0801
+
+run reu-dma x64 -reu -reusize 512 -autostart $tmpdir/reu.prg
+run reu-dma x64sc -reu -reusize 512 -autostart $tmpdir/reu.prg
+
+# PAL renderer: the sprite scene drawn every frame through the CRT
+# emulation.
+
+if test x"$BENCH_RENDER" = "x1"; then
+  run pal-renderer x64sc -VICIIfilter 1 -refresh 1 -autostart $tmpdir/sprites.prg
+else
+  echo "no display, skipping pal-renderer"
+fi
+
+echo "results appended to $report"
+
+test $failed -eq 0
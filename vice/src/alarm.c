@@ -112,6 +112,10 @@ static void alarm_init(alarm_t *alarm, alarm_context_t *context,
 
     alarm->pending_idx = -1;      /* Not pending.  */
 
+#ifdef FEATURE_HOSTTIMERS
+    alarm->hosttimer = hosttimer_register(name);
+#endif
+
     /* Add to the head of the alarm list of the alarm context.  */
     if (context->alarms == NULL) {
         context->alarms = alarm;
@@ -28,6 +28,7 @@
 #ifndef VICE_ALARM_H
 #define VICE_ALARM_H
 
+#include "hosttimer.h"
 #include "types.h"
 
 #define ALARM_CONTEXT_MAX_PENDING_ALARMS 0x100
@@ -54,6 +55,11 @@ struct alarm_s {
 
     /* Link to the next and previous alarms in the list.  */
     struct alarm_s *next, *prev;
+
+#ifdef FEATURE_HOSTTIMERS
+    /* Host time spent in the callback goes to this timer.  */
+    int hosttimer;
+#endif
 };
 typedef struct alarm_s alarm_t;
 
@@ -142,7 +148,9 @@ inline static void alarm_context_dispatch(alarm_context_t *context,
     idx = context->next_pending_alarm_idx;
     alarm = context->pending_alarms[idx].alarm;
 
+    HOSTTIMER_ENTER(alarm->hosttimer);
     (alarm->callback)(offset, alarm->data);
+    HOSTTIMER_LEAVE();
 }
 
 inline static void alarm_set(alarm_t *alarm, CLOCK cpu_clk)
@@ -45,6 +45,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
 #include "lib.h"
 #include "log.h"
 #include "rawnetarch.h"
@@ -204,6 +210,16 @@ static int TfePcapOpenAdapter(const char *interface_name)
     return 1;
 }
 
+#ifdef HAVE_PTHREAD
+static void rawnet_thread_start(void);
+static void rawnet_thread_stop(void);
+
+/* Copy of the receive filter settings, used by the thread.  */
+static BYTE rawnet_filter_mac[6];
+static volatile int rawnet_filter_broadcast = 0;
+static volatile int rawnet_filter_others = 0;
+#endif
+
 /* ------------------------------------------------------------------------- */
 /*    the architecture-dependend functions                                   */
 
@@ -236,6 +252,9 @@ int rawnet_arch_activate(const char *interface_name)
     if (!TfePcapOpenAdapter(interface_name)) {
         return 0;
     }
+#ifdef HAVE_PTHREAD
+    rawnet_thread_start();
+#endif
     return 1;
 }
 
@@ -244,6 +263,9 @@ void rawnet_arch_deactivate( void )
 #ifdef RAWNET_DEBUG_ARCH
     log_message( rawnet_arch_log, "rawnet_arch_deactivate()." );
 #endif
+#ifdef HAVE_PTHREAD
+    rawnet_thread_stop();
+#endif
 }
 
 void rawnet_arch_set_mac( const BYTE mac[6] )
@@ -251,6 +273,9 @@ void rawnet_arch_set_mac( const BYTE mac[6] )
 #ifdef RAWNET_DEBUG_ARCH
     log_message( rawnet_arch_log, "New MAC address set: %02X:%02X:%02X:%02X:%02X:%02X.", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5] );
 #endif
+#ifdef HAVE_PTHREAD
+    memcpy(rawnet_filter_mac, mac, 6);
+#endif
 }
 
 void rawnet_arch_set_hashfilter(const DWORD hash_mask[2])
@@ -278,6 +303,11 @@ void rawnet_arch_recv_ctl(int bBroadcast, int bIA, int bMulticast, int bCorrect,
     log_message(rawnet_arch_log, "\tbPromiscuous = %s", bPromiscuous ? "TRUE" : "FALSE");
     log_message(rawnet_arch_log, "\tbIAHash      = %s", bIAHash ? "TRUE" : "FALSE");
 #endif
+#ifdef HAVE_PTHREAD
+    /* multicast and hashed frames need the hash filter; let them all pass */
+    rawnet_filter_broadcast = bBroadcast || bPromiscuous;
+    rawnet_filter_others = bPromiscuous || bMulticast || bIAHash;
+#endif
 }
 
 void rawnet_arch_line_ctl(int bEnableTransmitter, int bEnableReceiver )
@@ -422,6 +452,207 @@ static void rawnet_arch_transmit_pcap(int force, int onecoll, int inhibit_crc, i
 
 #endif /* HAVE_LIBNET */
 
+#ifdef HAVE_PTHREAD
+/* ------------------------------------------------------------------------- */
+/*    packet I/O thread                                                      */
+
+/*
+ Reading the adapter from the emulation thread costs a pcap_dispatch()
+ system call on every receive poll of the chip.  Instead, a separate thread
+ waits on the pcap descriptor, drops the frames the receiver can never
+ accept with the current receive control settings, and queues the others.
+ rawnet_arch_receive() then only takes frames out of that queue.  Frames to
+ be transmitted are queued the other way round.
+
+ Both queues have a single producer and a single consumer; the indices only
+ ever increase and each is only written by one side.
+*/
+
+#define RAWNET_QUEUE_SIZE  64     /* frames, must be a power of two */
+#define RAWNET_FRAME_SIZE  1700   /* same as the pcap snapshot length */
+
+#define RAWNET_BARRIER() __sync_synchronize()
+
+typedef struct rawnet_frame_s {
+    int len;
+    BYTE data[RAWNET_FRAME_SIZE];
+} rawnet_frame_t;
+
+typedef struct rawnet_queue_s {
+    rawnet_frame_t frame[RAWNET_QUEUE_SIZE];
+    volatile unsigned int head; /* written by the producer */
+    volatile unsigned int tail; /* written by the consumer */
+} rawnet_queue_t;
+
+static rawnet_queue_t *rawnet_rx_queue = NULL;
+static rawnet_queue_t *rawnet_tx_queue = NULL;
+
+static pthread_t rawnet_thread;
+static int rawnet_thread_running = 0;
+static volatile int rawnet_thread_quit = 0;
+static int rawnet_wakeup_pipe[2] = { -1, -1 };
+
+static volatile unsigned int rawnet_rx_dropped = 0;
+static unsigned int rawnet_rx_dropped_logged = 0;
+
+static int rawnet_queue_full(rawnet_queue_t *q)
+{
+    return q->head - q->tail >= RAWNET_QUEUE_SIZE;
+}
+
+static int rawnet_queue_empty(rawnet_queue_t *q)
+{
+    return q->head == q->tail;
+}
+
+/* Returns 0 if the receiver cannot accept this frame anyway.  Frames which
+   depend on the hash filter are passed on, the chip emulation decides.  */
+static int rawnet_thread_filter(const u_char *data, unsigned int len)
+{
+    static const BYTE broadcast[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+    if (len < 6) {
+        return 0;
+    }
+    if (rawnet_filter_others) {
+        return 1;
+    }
+    if (memcmp(data, broadcast, 6) == 0) {
+        return rawnet_filter_broadcast;
+    }
+    return memcmp(data, rawnet_filter_mac, 6) == 0;
+}
+
+static void rawnet_thread_packet_handler(u_char *param, const struct pcap_pkthdr *header, const u_char *pkt_data)
+{
+    rawnet_frame_t *f;
+    unsigned int len = header->caplen;
+
+    if (!rawnet_thread_filter(pkt_data, len)) {
+        return;
+    }
+
+    if (rawnet_queue_full(rawnet_rx_queue)) {
+        rawnet_rx_dropped++;
+        return;
+    }
+
+    if (len > RAWNET_FRAME_SIZE) {
+        len = RAWNET_FRAME_SIZE;
+    }
+
+    f = &rawnet_rx_queue->frame[rawnet_rx_queue->head & (RAWNET_QUEUE_SIZE - 1)];
+    memcpy(f->data, pkt_data, len);
+    f->len = (int)len;
+    RAWNET_BARRIER();
+    rawnet_rx_queue->head++;
+}
+
+static void *rawnet_thread_main(void *arg)
+{
+    int pcap_fd = pcap_get_selectable_fd(TfePcapFP);
+    int maxfd = (pcap_fd > rawnet_wakeup_pipe[0]) ? pcap_fd : rawnet_wakeup_pipe[0];
+    fd_set fds;
+    char dummy[16];
+
+    while (!rawnet_thread_quit) {
+        struct timeval tv = { 0, 100000 };
+
+        FD_ZERO(&fds);
+        FD_SET(pcap_fd, &fds);
+        FD_SET(rawnet_wakeup_pipe[0], &fds);
+
+        if (select(maxfd + 1, &fds, NULL, NULL, &tv) < 0) {
+            continue;
+        }
+
+        if (FD_ISSET(rawnet_wakeup_pipe[0], &fds)) {
+            if (read(rawnet_wakeup_pipe[0], dummy, sizeof(dummy)) < 0) {
+                /* nothing to do, we only wanted to wake up */
+            }
+        }
+
+        while (!rawnet_queue_empty(rawnet_tx_queue)) {
+            rawnet_frame_t *f;
+
+            RAWNET_BARRIER();
+            f = &rawnet_tx_queue->frame[rawnet_tx_queue->tail & (RAWNET_QUEUE_SIZE - 1)];
+            RAWNET_ARCH_TRANSMIT(0, 0, 0, 0, f->len, f->data);
+            RAWNET_BARRIER();
+            rawnet_tx_queue->tail++;
+        }
+
+        if (FD_ISSET(pcap_fd, &fds)) {
+            pcap_dispatch(TfePcapFP, -1, rawnet_thread_packet_handler, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+static void rawnet_thread_wakeup(void)
+{
+    char c = 0;
+
+    if (write(rawnet_wakeup_pipe[1], &c, 1) < 0) {
+        /* the pipe is full, the thread will wake up anyway */
+    }
+}
+
+static void rawnet_thread_start(void)
+{
+    if (rawnet_thread_running || pcap_get_selectable_fd(TfePcapFP) < 0) {
+        return;
+    }
+
+    if (pipe(rawnet_wakeup_pipe) < 0) {
+        log_message(rawnet_arch_log, "WARNING: Cannot create wakeup pipe, not using a packet thread.");
+        return;
+    }
+
+    rawnet_rx_queue = lib_calloc(1, sizeof(rawnet_queue_t));
+    rawnet_tx_queue = lib_calloc(1, sizeof(rawnet_queue_t));
+    rawnet_rx_dropped = rawnet_rx_dropped_logged = 0;
+    rawnet_thread_quit = 0;
+
+    if (pthread_create(&rawnet_thread, NULL, rawnet_thread_main, NULL) != 0) {
+        log_message(rawnet_arch_log, "WARNING: Cannot start packet thread, polling the adapter directly.");
+        close(rawnet_wakeup_pipe[0]);
+        close(rawnet_wakeup_pipe[1]);
+        lib_free(rawnet_rx_queue);
+        lib_free(rawnet_tx_queue);
+        rawnet_rx_queue = rawnet_tx_queue = NULL;
+        return;
+    }
+
+    rawnet_thread_running = 1;
+}
+
+static void rawnet_thread_stop(void)
+{
+    if (!rawnet_thread_running) {
+        return;
+    }
+
+    rawnet_thread_quit = 1;
+    rawnet_thread_wakeup();
+    pthread_join(rawnet_thread, NULL);
+    rawnet_thread_running = 0;
+
+    close(rawnet_wakeup_pipe[0]);
+    close(rawnet_wakeup_pipe[1]);
+    rawnet_wakeup_pipe[0] = rawnet_wakeup_pipe[1] = -1;
+
+    if (rawnet_rx_dropped) {
+        log_message(rawnet_arch_log, "%u received frames dropped, the queue was full.", rawnet_rx_dropped);
+    }
+
+    lib_free(rawnet_rx_queue);
+    lib_free(rawnet_tx_queue);
+    rawnet_rx_queue = rawnet_tx_queue = NULL;
+}
+#endif /* #ifdef HAVE_PTHREAD */
+
 /* int force       - FORCE: Delete waiting frames in transmit buffer */
 /* int onecoll     - ONECOLL: Terminate after just one collision */
 /* int inhibit_crc - INHIBITCRC: Do not append CRC to the transmission */
@@ -444,6 +675,24 @@ void rawnet_arch_transmit(int force, int onecoll, int inhibit_crc, int tx_pad_di
     debug_output("Transmit frame: ", txframe, txlength);
 #endif /* #ifdef RAWNET_DEBUG_PKTDUMP */
 
+#ifdef HAVE_PTHREAD
+    if (rawnet_thread_running) {
+        rawnet_frame_t *f;
+
+        if (rawnet_queue_full(rawnet_tx_queue) || txlength > RAWNET_FRAME_SIZE) {
+            log_message(rawnet_arch_log, "WARNING! Could not send packet, transmit queue full!");
+            return;
+        }
+        f = &rawnet_tx_queue->frame[rawnet_tx_queue->head & (RAWNET_QUEUE_SIZE - 1)];
+        memcpy(f->data, txframe, txlength);
+        f->len = txlength;
+        RAWNET_BARRIER();
+        rawnet_tx_queue->head++;
+        rawnet_thread_wakeup();
+        return;
+    }
+#endif
+
     RAWNET_ARCH_TRANSMIT(force, onecoll, inhibit_crc, tx_pad_dis, txlength, txframe);
 }
 
@@ -497,6 +746,29 @@ int rawnet_arch_receive(BYTE *pbuffer, int *plen, int  *phashed, int *phash_inde
 
     assert((*plen & 1) == 0);
 
+#ifdef HAVE_PTHREAD
+    if (rawnet_thread_running) {
+        rawnet_frame_t *f;
+
+        if (rawnet_rx_dropped != rawnet_rx_dropped_logged) {
+            log_message(rawnet_arch_log, "WARNING! Receive queue full, %u frames dropped.", rawnet_rx_dropped - rawnet_rx_dropped_logged);
+            rawnet_rx_dropped_logged = rawnet_rx_dropped;
+        }
+
+        if (rawnet_queue_empty(rawnet_rx_queue)) {
+            return 0;
+        }
+        RAWNET_BARRIER();
+        f = &rawnet_rx_queue->frame[rawnet_rx_queue->tail & (RAWNET_QUEUE_SIZE - 1)];
+        len = f->len;
+        if ((unsigned int)len < internal.len) {
+            internal.len = len;
+        }
+        memcpy(pbuffer, f->data, internal.len);
+        RAWNET_BARRIER();
+        rawnet_rx_queue->tail++;
+    } else
+#endif
     len = rawnet_arch_receive_frame(&internal);
 
     if (len != -1) {
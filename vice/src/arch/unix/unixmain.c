@@ -26,15 +26,10 @@
 
 #include "vice.h"
 
-#include <stdio.h>
-#include <signal.h>
-
 #ifdef __BEOS__
 #include <sys/utsname.h>
 #endif
 
-#include "log.h"
-#include "machine.h"
 #include "main.h"
 #include "video.h"
 
@@ -44,20 +39,6 @@ int main(int argc, char **argv)
     return main_program(argc, argv);
 }
 
-void main_exit(void)
-{
-    /* Disable SIGINT.  This is done to prevent the user from keeping C-c
-       pressed and thus breaking the cleanup process, which might be
-       dangerous.  */
-    signal(SIGINT, SIG_IGN);
-
-    log_message(LOG_DEFAULT, "\nExiting...");
-
-    machine_shutdown();
-
-    putchar('\n');
-}
-
 #ifdef __BEOS__
 /* this check is needed for haiku, since it always returns 1 on
    SupportsWindowMode() */
@@ -885,6 +885,78 @@ void video_canvas_refresh(video_canvas_t *canvas, unsigned int xs, unsigned int
     }
 }
 
+void video_canvas_refresh_prepare(video_canvas_t *canvas)
+{
+    if (console_mode || video_disabled_mode) {
+        return;
+    }
+
+#ifdef HAVE_XVIDEO
+    if (canvas->videoconfig->hwscale && canvas->xv_image) {
+        return;
+    }
+#endif
+
+    video_canvas_render_prepare(canvas);
+}
+
+int video_canvas_refresh_convert(video_canvas_t *canvas, unsigned int xs, unsigned int ys, unsigned int xi, unsigned int yi, unsigned int w, unsigned int h)
+{
+    if (console_mode || video_disabled_mode) {
+        return 0;
+    }
+
+#ifdef HAVE_XVIDEO
+    if (canvas->videoconfig->hwscale && canvas->xv_image) {
+        return -1;
+    }
+#endif
+
+#ifdef HAVE_FULLSCREEN
+    if (canvas->video_fullscreen_refresh_func) {
+        return -1;
+    }
+#endif
+
+    xi *= canvas->videoconfig->scalex;
+    w *= canvas->videoconfig->scalex;
+
+    yi *= canvas->videoconfig->scaley;
+    h *= canvas->videoconfig->scaley;
+
+    if (xi + w > canvas->draw_buffer->canvas_physical_width || yi + h > canvas->draw_buffer->canvas_physical_height) {
+        return -1;
+    }
+
+    if ((int)xs >= 0) {
+        video_canvas_render_prepared(canvas, (BYTE *)canvas->x_image->data, w, h, xs, ys, xi, yi, canvas->x_image->bytes_per_line, canvas->x_image->bits_per_pixel);
+    }
+    return 0;
+}
+
+void video_canvas_refresh_show(video_canvas_t *canvas, unsigned int xi, unsigned int yi, unsigned int w, unsigned int h)
+{
+    Display *display;
+
+    if (console_mode || video_disabled_mode) {
+        return;
+    }
+
+    xi *= canvas->videoconfig->scalex;
+    w *= canvas->videoconfig->scalex;
+
+    yi *= canvas->videoconfig->scaley;
+    h *= canvas->videoconfig->scaley;
+
+    display = x11ui_get_display_ptr();
+
+    _refresh_func(display, canvas->drawable, _video_gc, canvas->x_image, xi, yi, xi, yi, w, h, False, NULL, canvas);
+
+    if (_video_use_xsync) {
+        XSync(display, False);
+    }
+}
+
 /* FIXME: This should return 0 if the window is maximized
    (and therefore cannot change size).
    What is a pure X11 method to detect that? */
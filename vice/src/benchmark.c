@@ -0,0 +1,180 @@
+/*
+ * benchmark.c - Emulation speed report for benchmark runs.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* With `-benchmark <file>' the emulator measures host time and emulated
+   cycles from the end of the first frame to the end of the last one and
+   appends a single line of JSON to the file when it exits, usually at the
+   `-limitcycles' limit.  `benchmark.sh' in the top directory runs the
+   standard workloads and collects these lines.  With host timers built in
+   they are switched on, and the line gets the host time per frame of each
+   subsystem as well.  */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "clkguard.h"
+#include "cmdline.h"
+#include "hosttimer.h"
+#include "lib.h"
+#include "log.h"
+#include "machine.h"
+#include "maincpu.h"
+#include "resources.h"
+#include "translate.h"
+#include "types.h"
+#include "util.h"
+#include "vsyncapi.h"
+
+static char *benchmark_file = NULL;
+
+static int started = 0;
+static unsigned long frames = 0;
+static CLOCK start_clk, last_clk;
+static unsigned long start_time, last_time;
+
+/* ------------------------------------------------------------------------- */
+
+#ifdef FEATURE_HOSTTIMERS
+static void benchmark_write_subsystems(FILE *f)
+{
+    unsigned int i;
+    double ns;
+    int first = 1;
+
+    fprintf(f, ",\"subsystems\":{");
+    for (i = 0; i < hosttimer_count(); i++) {
+        ns = hosttimer_ns_per_frame(i);
+        if (ns >= 0.5) {
+            fprintf(f, "%s\"%s\":%.0f", first ? "" : ",", hosttimer_name(i), ns);
+            first = 0;
+        }
+    }
+    fprintf(f, "}");
+}
+#endif
+
+static void clk_overflow_callback(CLOCK sub, void *unused_data)
+{
+    start_clk -= sub;
+    last_clk -= sub;
+}
+
+void benchmark_frame(void)
+{
+    if (benchmark_file == NULL) {
+        return;
+    }
+
+    /* The first frame includes the startup, measure from its end.  */
+    if (!started) {
+        start_clk = last_clk = maincpu_clk;
+        start_time = last_time = vsyncarch_gettime();
+        clk_guard_add_callback(maincpu_clk_guard, clk_overflow_callback, NULL);
+        started = 1;
+        return;
+    }
+
+    last_clk = maincpu_clk;
+    last_time = vsyncarch_gettime();
+    frames++;
+}
+
+void benchmark_shutdown(void)
+{
+    FILE *f;
+    double seconds, cycles, cycles_per_second;
+
+    if (benchmark_file == NULL) {
+        return;
+    }
+
+    if (frames == 0) {
+        log_error(LOG_DEFAULT, "Benchmark: no complete frame was emulated.");
+        lib_free(benchmark_file);
+        benchmark_file = NULL;
+        return;
+    }
+
+    seconds = (double)(last_time - start_time) / (double)vsyncarch_frequency();
+    cycles = (double)(last_clk - start_clk);
+    cycles_per_second = (seconds > 0.0) ? cycles / seconds : 0.0;
+
+    if (strcmp(benchmark_file, "-") == 0) {
+        f = stdout;
+    } else {
+        f = fopen(benchmark_file, "a");
+    }
+
+    if (f == NULL) {
+        log_error(LOG_DEFAULT, "Cannot write benchmark report `%s'.", benchmark_file);
+    } else {
+        fprintf(f, "{\"machine\":\"%s\",\"frames\":%lu,\"cycles\":%.0f,"
+                "\"seconds\":%.6f,\"cycles_per_second\":%.0f,"
+                "\"speed_percent\":%.2f,\"ns_per_frame\":%.0f",
+                machine_get_name(), frames, cycles, seconds, cycles_per_second,
+                cycles_per_second * 100.0 / (double)machine_get_cycles_per_second(),
+                seconds * 1e9 / (double)frames);
+#ifdef FEATURE_HOSTTIMERS
+        benchmark_write_subsystems(f);
+#endif
+        fprintf(f, "}\n");
+        if (f == stdout) {
+            fflush(f);
+        } else {
+            fclose(f);
+        }
+    }
+
+    lib_free(benchmark_file);
+    benchmark_file = NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int set_benchmark_file(const char *param, void *extra_param)
+{
+    util_string_set(&benchmark_file, param);
+
+#ifdef FEATURE_HOSTTIMERS
+    resources_set_int("HostTimers", 1);
+#endif
+
+    return 0;
+}
+
+static const cmdline_option_t cmdline_options[] = {
+    { "-benchmark", CALL_FUNCTION, 1,
+      set_benchmark_file, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_FILE, IDCLS_SPECIFY_BENCHMARK_FILE,
+      NULL, NULL },
+    { NULL }
+};
+
+int benchmark_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
@@ -0,0 +1,35 @@
+/*
+ * benchmark.h - Emulation speed report for benchmark runs.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_BENCHMARK_H
+#define VICE_BENCHMARK_H
+
+extern int benchmark_cmdline_options_init(void);
+
+/* Called at the end of every frame.  */
+extern void benchmark_frame(void);
+
+/* Write the report, if one was asked for.  */
+extern void benchmark_shutdown(void);
+
+#endif
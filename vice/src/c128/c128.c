@@ -1211,6 +1211,9 @@ static void machine_vsync_hook(void)
 {
     CLOCK sub;
 
+    /* UI events may touch the VDC canvas.  */
+    vdc_render_sync();
+
     drive_vsync_hook();
 
     autostart_advance();
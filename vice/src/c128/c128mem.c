@@ -156,16 +156,43 @@ static void watch_store(WORD addr, BYTE value)
     mem_write_tab[vbank][mem_config][addr >> 8](addr, value);
 }
 
-void mem_toggle_watchpoints(int flag, void *context)
+/* Only the pages that contain a watched address go through the checking
+   handlers, all other pages keep the handlers of the current config.  */
+static void mem_update_watch_tab(void)
 {
-    if (flag) {
+    int i, flags;
+
+    for (i = 0; i <= 0x100; i++) {
+        flags = monitor_watch_page_flags(e_comp_space, (unsigned int)i);
+        if (flags & MONITOR_WATCH_LOAD) {
+            mem_read_tab_watch[i] = watch_read;
+        } else {
+            mem_read_tab_watch[i] = mem_read_tab[mem_config][i];
+        }
+        if (flags & MONITOR_WATCH_STORE) {
+            mem_write_tab_watch[i] = watch_store;
+        } else {
+            mem_write_tab_watch[i] = mem_write_tab[vbank][mem_config][i];
+        }
+    }
+}
+
+static void mem_update_tab_ptrs(void)
+{
+    if (watchpoints_active) {
+        mem_update_watch_tab();
         _mem_read_tab_ptr = mem_read_tab_watch;
         _mem_write_tab_ptr = mem_write_tab_watch;
     } else {
         _mem_read_tab_ptr = mem_read_tab[mem_config];
         _mem_write_tab_ptr = mem_write_tab[vbank][mem_config];
     }
+}
+
+void mem_toggle_watchpoints(int flag, void *context)
+{
     watchpoints_active = flag;
+    mem_update_tab_ptrs();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -190,13 +217,7 @@ void mem_update_config(int config)
 {
     mem_config = config;
 
-    if (watchpoints_active) {
-        _mem_read_tab_ptr = mem_read_tab_watch;
-        _mem_write_tab_ptr = mem_write_tab_watch;
-    } else {
-        _mem_read_tab_ptr = mem_read_tab[mem_config];
-        _mem_write_tab_ptr = mem_write_tab[vbank][mem_config];
-    }
+    mem_update_tab_ptrs();
 
     _mem_read_base_tab_ptr = mem_read_base_tab[config];
     mem_read_limit_tab_ptr = mem_read_limit_tab[config];
@@ -688,11 +709,6 @@ void mem_initialize_memory(void)
 
     mem_limit_init(mem_read_limit_tab);
 
-    for (i = 0; i <= 0x100; i++) {
-        mem_read_tab_watch[i] = watch_read;
-        mem_write_tab_watch[i] = watch_store;
-    }
-
     c128meminit();
 
     /* C64 mode configuration.  */
@@ -905,9 +905,11 @@ int machine_specific_init(void)
 
     c64_log = log_open("C64");
 
+    init_time_mark("machine");
     if (mem_load() < 0) {
         return -1;
     }
+    init_time_mark("ROMs");
 
     event_init();
 
@@ -935,8 +937,11 @@ int machine_specific_init(void)
     /* Initialize the datasette emulation.  */
     datasette_init();
 
+    init_time_mark("machine");
+
     /* Fire up the hardware-level drive emulation.  */
     drive_init();
+    init_time_mark("drives");
 
     disk_image_init();
 
@@ -38,6 +38,8 @@
 CLOCK maincpu_clk = 0L;
 /* if != 0, exit when this many cycles have been executed */
 CLOCK maincpu_clk_limit = 0L;
+/* if != 0, return from the main loop instead of exiting at the limit */
+int maincpu_clk_limit_return = 0;
 
 #define REWIND_FETCH_OPCODE(clock) /*clock-=2*/
 
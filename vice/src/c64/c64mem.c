@@ -147,16 +147,43 @@ static void store_watch(WORD addr, BYTE value)
     mem_write_tab[vbank][mem_config][addr >> 8](addr, value);
 }
 
-void mem_toggle_watchpoints(int flag, void *context)
+/* Only the pages that contain a watched address go through the checking
+   handlers, all other pages keep the handlers of the current config.  */
+static void mem_update_watch_tab(void)
 {
-    if (flag) {
+    int i, flags;
+
+    for (i = 0; i <= 0x100; i++) {
+        flags = monitor_watch_page_flags(e_comp_space, (unsigned int)i);
+        if (flags & MONITOR_WATCH_LOAD) {
+            mem_read_tab_watch[i] = (i == 0) ? zero_read_watch : read_watch;
+        } else {
+            mem_read_tab_watch[i] = mem_read_tab[mem_config][i];
+        }
+        if (flags & MONITOR_WATCH_STORE) {
+            mem_write_tab_watch[i] = (i == 0) ? zero_store_watch : store_watch;
+        } else {
+            mem_write_tab_watch[i] = mem_write_tab[vbank][mem_config][i];
+        }
+    }
+}
+
+static void mem_update_tab_ptrs(void)
+{
+    if (watchpoints_active) {
+        mem_update_watch_tab();
         _mem_read_tab_ptr = mem_read_tab_watch;
         _mem_write_tab_ptr = mem_write_tab_watch;
     } else {
         _mem_read_tab_ptr = mem_read_tab[mem_config];
         _mem_write_tab_ptr = mem_write_tab[vbank][mem_config];
     }
+}
+
+void mem_toggle_watchpoints(int flag, void *context)
+{
     watchpoints_active = flag;
+    mem_update_tab_ptrs();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -196,9 +223,20 @@ static void clk_overflow_callback(CLOCK sub, void *unused_data)
     }
 }
 
+/* Used by the REU for bulk transfers: non-zero if the page currently maps
+   plain RAM without side effects.  */
+static int c64_mem_ram_check(WORD page, int write)
+{
+    if (write) {
+        return _mem_write_tab_ptr[page] == ram_store;
+    }
+    return _mem_read_tab_ptr[page] == ram_read;
+}
+
 void c64_mem_init(void)
 {
     clk_guard_add_callback(maincpu_clk_guard, clk_overflow_callback, NULL);
+    reu_ram_check_register(c64_mem_ram_check);
 }
 
 void mem_pla_config_changed(void)
@@ -207,13 +245,7 @@ void mem_pla_config_changed(void)
 
     c64pla_config_changed(tape_sense, 1, 0x17);
 
-    if (watchpoints_active) {
-        _mem_read_tab_ptr = mem_read_tab_watch;
-        _mem_write_tab_ptr = mem_write_tab_watch;
-    } else {
-        _mem_read_tab_ptr = mem_read_tab[mem_config];
-        _mem_write_tab_ptr = mem_write_tab[vbank][mem_config];
-    }
+    mem_update_tab_ptrs();
 
     _mem_read_base_tab_ptr = mem_read_base_tab[mem_config];
     mem_read_limit_tab_ptr = mem_read_limit_tab[mem_config];
@@ -641,14 +673,6 @@ void mem_initialize_memory(void)
 
     mem_limit_init(mem_read_limit_tab);
 
-    /* setup watchpoint tables */
-    mem_read_tab_watch[0] = zero_read_watch;
-    mem_write_tab_watch[0] = zero_store_watch;
-    for (i = 1; i <= 0x100; i++) {
-        mem_read_tab_watch[i] = read_watch;
-        mem_write_tab_watch[i] = store_watch;
-    }
-
     resources_get_int("BoardType", &board);
 
     /* Default is RAM.  */
@@ -783,10 +807,7 @@ void mem_set_vbank(int new_vbank)
 {
     vbank = new_vbank;
 
-    /* Do not override watchpoints on vbank switches.  */
-    if (_mem_write_tab_ptr != mem_write_tab_watch) {
-        _mem_write_tab_ptr = mem_write_tab[new_vbank][mem_config];
-    }
+    mem_update_tab_ptrs();
 
     vicii_set_vbank(new_vbank);
 }
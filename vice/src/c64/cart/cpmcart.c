@@ -89,19 +89,55 @@ static BYTE reg_l2 = 0;
 static int z80_started = 0;
 static int cpmcart_enabled = 0;
 
+/* Batched execution: 0 runs the Z80 cycle exact; otherwise the BA callback,
+   alarms and interrupts are only handled before an access to the I/O area
+   and after at most this many cycles.  */
+static int cpmcart_batch_cycles = 0;
+
+/* Clock up to which the C64 side has been synchronized in batch mode.  */
+static CLOCK cpmcart_batch_clk = 0;
+
+static void cpmcart_batch_sync(void);
+
 static read_func_ptr_t cpmcart_mem_read_tab[0x101];
 static store_func_ptr_t cpmcart_mem_write_tab[0x101];
 
-static BYTE cpmcart_wrap_read(WORD addr)
+/* Z80 pages which map plain C64 RAM, pointing to the C64 page; NULL for the
+   I/O area.  ram_read() and ram_store() have no side effects, so these pages
+   are accessed directly.  */
+static BYTE *cpmcart_ram_tab[0x101];
+
+inline static BYTE cpmcart_wrap_read(WORD addr)
 {
-    DWORD address = ((DWORD)addr + 0x1000) & 0xffff;
+    DWORD address;
+
+    if (cpmcart_ram_tab[addr >> 8] != NULL) {
+        return cpmcart_ram_tab[addr >> 8][addr & 0xff];
+    }
+
+    if (cpmcart_batch_cycles) {
+        cpmcart_batch_sync();
+    }
+
+    address = ((DWORD)addr + 0x1000) & 0xffff;
 
     return cpmcart_mem_read_tab[addr >> 8]((WORD)address);
 }
 
-static void cpmcart_wrap_store(WORD addr, BYTE value)
+inline static void cpmcart_wrap_store(WORD addr, BYTE value)
 {
-    DWORD address = ((DWORD)addr + 0x1000) & 0xffff;
+    DWORD address;
+
+    if (cpmcart_ram_tab[addr >> 8] != NULL) {
+        cpmcart_ram_tab[addr >> 8][addr & 0xff] = value;
+        return;
+    }
+
+    if (cpmcart_batch_cycles) {
+        cpmcart_batch_sync();
+    }
+
+    address = ((DWORD)addr + 0x1000) & 0xffff;
 
     cpmcart_mem_write_tab[addr >> 8]((WORD)address, value);
 }
@@ -116,14 +152,20 @@ static void set_write_item(int index, void (*func)(WORD addr, BYTE val))
     cpmcart_mem_write_tab[index] = func;
 }
 
+static void set_ram_item(int index)
+{
+    set_read_item(index, ram_read);
+    set_write_item(index, ram_store);
+    cpmcart_ram_tab[index] = mem_ram + (((index + 0x10) & 0xff) << 8);
+}
+
 static void cpmcart_mem_init(void)
 {
     int i;
 
     /* z80 $0000-$bfff -> c64 $1000-$cfff (RAM) */
     for (i = 0; i < 0xc0; ++i) {
-        set_read_item(i, ram_read);
-        set_write_item(i, ram_store);
+        set_ram_item(i);
     }
 
     /* z80 $c000-$c7ff -> c64 $d000-$d7ff (VICII/SID I/O) */
@@ -168,14 +210,12 @@ static void cpmcart_mem_init(void)
 
     /* z80 $d000-$efff -> c64 $e000-$ffff (RAM) */
     for (i = 0xd0; i < 0xf0; ++i) {
-        set_read_item(i, ram_read);
-        set_write_item(i, ram_store);
+        set_ram_item(i);
     }
 
     /* z80 $f000-$ffff -> c64 $0000-$0fff (RAM) */
     for (i = 0xf0; i < 0x100; ++i) {
-        set_read_item(i, ram_read);
-        set_write_item(i, ram_store);
+        set_ram_item(i);
     }
 }
 
@@ -230,9 +270,26 @@ static int set_cpmcart_enabled(int value, void *param)
     return 0;
 }
 
+static int set_cpmcart_batch_cycles(int value, void *param)
+{
+    if (value < 0) {
+        return -1;
+    }
+
+    /* The C64 side is in sync when leaving the cycle exact mode.  */
+    if (!cpmcart_batch_cycles) {
+        cpmcart_batch_clk = maincpu_clk;
+    }
+    cpmcart_batch_cycles = value;
+
+    return 0;
+}
+
 static const resource_int_t resources_int[] = {
     { "CPMCart", 0, RES_EVENT_STRICT, (resource_value_t)0,
       &cpmcart_enabled, set_cpmcart_enabled, NULL },
+    { "CPMCartBatch", 0, RES_EVENT_STRICT, (resource_value_t)0,
+      &cpmcart_batch_cycles, set_cpmcart_batch_cycles, NULL },
     { NULL }
 };
 
@@ -255,6 +312,11 @@ static const cmdline_option_t cmdline_options[] =
       USE_PARAM_STRING, USE_DESCRIPTION_ID,
       IDCLS_UNUSED, IDCLS_DISABLE_CPM_CART,
       NULL, NULL },
+    { "-cpmcartbatch", SET_RESOURCE, 1,
+      NULL, NULL, "CPMCartBatch", NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_VALUE, IDCLS_SET_CPM_CART_BATCH,
+      NULL, NULL },
     { NULL }
 };
 
@@ -313,10 +375,19 @@ void cpmcart_reset(void)
 
 #define opcode_t DWORD
 
-#define FETCH_OPCODE(o) ((o) = (LOAD(z80_reg_pc)               \
-                                | (LOAD(z80_reg_pc + 1) << 8)  \
-                                | (LOAD(z80_reg_pc + 2) << 16) \
-                                | (LOAD(z80_reg_pc + 3) << 24)))
+/* Fetch all four opcode bytes at once when they are inside one RAM page. */
+inline static opcode_t cpmcart_fetch_opcode(DWORD pc)
+{
+    BYTE *p = cpmcart_ram_tab[(pc >> 8) & 0xff];
+
+    if (p != NULL && (pc & 0xff) <= 0xfc) {
+        p += pc & 0xff;
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((opcode_t)p[3] << 24);
+    }
+    return LOAD(pc) | (LOAD(pc + 1) << 8) | (LOAD(pc + 2) << 16) | ((opcode_t)LOAD(pc + 3) << 24);
+}
+
+#define FETCH_OPCODE(o) ((o) = cpmcart_fetch_opcode(z80_reg_pc))
 
 #define p0 (opcode & 0xff)
 #define p1 ((opcode >> 8) & 0xff)
@@ -338,6 +409,17 @@ inline static CLOCK z80cpu_clock_add(CLOCK clock, int amount)
     CLOCK tmp_clock = clock;
     int left = amount;
 
+    /* Without BA there is nothing to do per cycle; same result as the loop
+       below in constant time.  In batch mode BA is caught up later.  */
+    if (!cpmcart_ba.enabled || cpmcart_batch_cycles) {
+        if (left > 0 && z80_half_cycle) {
+            left--;
+            tmp_clock++;
+            z80_half_cycle = 0;
+        }
+        return tmp_clock + (left + 1) / 2;
+    }
+
     while (left > 0) {
         if (left >= (2 - z80_half_cycle)) {
             left -= (2 - z80_half_cycle);
@@ -361,7 +443,7 @@ inline static CLOCK z80cpu_clock_add(CLOCK clock, int amount)
 void cpmcart_clock_stretch(void)
 {
     z80_half_cycle = 0;
-    if (cpmcart_ba.enabled) {
+    if (cpmcart_ba.enabled && !cpmcart_batch_cycles) {
         CLK++;
         if (cpmcart_ba.check()) {
             cpmcart_ba.steal();
@@ -372,6 +454,30 @@ void cpmcart_clock_stretch(void)
 }
 #endif
 
+/* Bring the C64 side up to the Z80: run the BA callback for the cycles
+   since the last synchronization like z80cpu_clock_add() does, then the
+   alarms.  */
+static void cpmcart_batch_sync(void)
+{
+    CLOCK clk = CLK, c;
+
+    if (cpmcart_ba.enabled) {
+        for (c = cpmcart_batch_clk; c < clk; c++) {
+            CLK = c + 1;
+            if (cpmcart_ba.check()) {
+                cpmcart_ba.steal();
+            }
+        }
+        CLK = clk;
+    }
+
+    while (CLK >= alarm_context_next_pending_clk(maincpu_alarm_context)) {
+        alarm_context_dispatch(maincpu_alarm_context, CLK);
+    }
+
+    cpmcart_batch_clk = CLK;
+}
+
 /* ------------------------------------------------------------------------- */
 
 static unsigned int z80_last_opcode_info;
@@ -5701,18 +5807,28 @@ void cpmcart_mainloop(interrupt_cpu_status_t *cpu_int_status, alarm_context_t *c
 
     import_registers();
 
+    cpmcart_batch_clk = CLK;
+
     do {
-        while (CLK >= alarm_context_next_pending_clk(cpu_alarm_context)) {
-            alarm_context_dispatch(cpu_alarm_context, CLK);
-        }
-        {
-            enum cpu_int pending_interrupt;
-
-            pending_interrupt = cpu_int_status->global_pending_int;
-            if (pending_interrupt != IK_NONE) {
-                DO_INTERRUPT(pending_interrupt);
-                while (CLK >= alarm_context_next_pending_clk(cpu_alarm_context)) {
-                    alarm_context_dispatch(cpu_alarm_context, CLK);
+        /* In batch mode the C64 side only catches up once the budget is
+           used up or at an I/O access.  */
+        if (!cpmcart_batch_cycles
+            || CLK - cpmcart_batch_clk >= (CLOCK)cpmcart_batch_cycles) {
+            if (cpmcart_batch_cycles) {
+                cpmcart_batch_sync();
+            }
+            while (CLK >= alarm_context_next_pending_clk(cpu_alarm_context)) {
+                alarm_context_dispatch(cpu_alarm_context, CLK);
+            }
+            {
+                enum cpu_int pending_interrupt;
+
+                pending_interrupt = cpu_int_status->global_pending_int;
+                if (pending_interrupt != IK_NONE) {
+                    DO_INTERRUPT(pending_interrupt);
+                    while (CLK >= alarm_context_next_pending_clk(cpu_alarm_context)) {
+                        alarm_context_dispatch(cpu_alarm_context, CLK);
+                    }
                 }
             }
         }
@@ -6505,6 +6621,10 @@ void cpmcart_mainloop(interrupt_cpu_status_t *cpu_int_status, alarm_context_t *c
         cpu_int_status->num_dma_per_opcode = 0;
     } while (z80_started);
 
+    if (cpmcart_batch_cycles) {
+        cpmcart_batch_sync();
+    }
+
     export_registers();
 }
 
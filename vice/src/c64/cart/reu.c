@@ -43,6 +43,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "alarm.h"
 #include "archdep.h"
 #include "c64export.h"
 #include "cartio.h"
@@ -251,6 +252,10 @@ static struct reu_ba_s reu_ba = {
     NULL, NULL, NULL, 0, 0
 };
 
+/*! \brief machine callback telling which host pages are plain RAM, used
+    for the bulk transfers of x64 */
+static reu_ram_check_callback_t *reu_ram_check = NULL;
+
 static int reu_write_image = 0;
 
 /* ------------------------------------------------------------------------- */
@@ -600,6 +605,12 @@ void reu_ba_register(reu_ba_check_callback_t *ba_check,
     reu_ba.enabled = 1;
 }
 
+/*! \brief register the host RAM check used for bulk transfers */
+void reu_ram_check_register(reu_ram_check_callback_t *ram_check)
+{
+    reu_ram_check = ram_check;
+}
+
 /*! \brief reset the REU */
 void reu_reset(void)
 {
@@ -1131,6 +1142,90 @@ static void reu_dma_update_regs(WORD host_addr, unsigned int reu_addr, int len,
     }
 }
 
+/*! \brief determine how many bytes can be transferred in bulk
+
+  Transfers which touch plain host RAM only can copy the data directly and
+  advance the clock by the whole amount, as nothing else can observe the
+  intermediate state.  This is only done if
+
+  - the CPU is not stalled by BA (x64; x64sc clocks the VIC-II for every
+    transfer cycle),
+  - both addresses increment and neither wraps around,
+  - every host page in the range is plain RAM in the current configuration
+    (no I/O, no ROM, no watchpoints, no $FF00 trigger), and
+  - no alarm becomes due before the last byte.
+
+  \param host_addr
+    The host (computer) address where the operation continues
+
+  \param reu_addr
+    The REU address where the operation continues
+
+  \param host_step
+    The increment to use for the host address
+
+  \param reu_step
+    The increment to use for the REU address
+
+  \param len
+    The remaining transfer length
+
+  \param cycles
+    The number of cycles each byte takes
+
+  \param host_write
+    Non-zero if the operation writes to the host
+
+  \return
+    The number of bytes which can be transferred in bulk, possibly 0.
+*/
+static int reu_dma_bulk_length(WORD host_addr, unsigned int reu_addr, int host_step, int reu_step, int len, int cycles, int host_write)
+{
+    CLOCK next_alarm;
+    unsigned int n = (unsigned int)len;
+    unsigned int page, low, limit, dram;
+
+    if (reu_ba.enabled || reu_ram_check == NULL || !host_step || !reu_step) {
+        return 0;
+    }
+
+    /* stay clear of the next alarm */
+    next_alarm = alarm_context_next_pending_clk(maincpu_alarm_context);
+    if (next_alarm <= maincpu_clk + cycles) {
+        return 0;
+    }
+    if ((next_alarm - maincpu_clk - 1) / cycles < n) {
+        n = (next_alarm - maincpu_clk - 1) / cycles;
+    }
+
+    /* host side: plain RAM, no wrap around at $FFFF */
+    if (host_addr + n > 0x10000) {
+        n = 0x10000 - host_addr;
+    }
+    for (page = host_addr >> 8; page <= ((host_addr + n - 1) >> 8); page++) {
+        if (!reu_ram_check((WORD)page, 0) || (host_write && !reu_ram_check((WORD)page, 1))) {
+            n = (page << 8) - host_addr;
+            break;
+        }
+    }
+
+    /* REU side: DRAM without any wrap around */
+    low = reu_addr & 0x0007ffff;
+    limit = (rec_options.wrap_around < 0x80000) ? rec_options.wrap_around : 0x80000;
+    if (low + n >= limit) {
+        n = (limit > low) ? limit - low - 1 : 0;
+    }
+    dram = reu_addr & (rec_options.dram_wrap_around - 1);
+    if (dram + n > rec_options.not_backedup_addresses) {
+        n = (rec_options.not_backedup_addresses > dram) ? rec_options.not_backedup_addresses - dram : 0;
+    }
+    if (dram + n > rec_options.dram_wrap_around) {
+        n = rec_options.dram_wrap_around - dram;
+    }
+
+    return (int)n;
+}
+
 /*! \brief DMA operation writing from the host to the REU
 
   \param host_addr
@@ -1151,6 +1246,7 @@ static void reu_dma_update_regs(WORD host_addr, unsigned int reu_addr, int len,
 static void reu_dma_host_to_reu(WORD host_addr, unsigned int reu_addr, int host_step, int reu_step, int len)
 {
     BYTE value;
+    int n;
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "copy ext $%05X %s<= main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
 
@@ -1159,6 +1255,15 @@ static void reu_dma_host_to_reu(WORD host_addr, unsigned int reu_addr, int host_
     assert(len >= 1);
 
     while (len) {
+        n = reu_dma_bulk_length(host_addr, reu_addr, host_step, reu_step, len, 1, 0);
+        if (n > 0) {
+            memcpy(reu_ram + (reu_addr & (rec_options.dram_wrap_around - 1)), mem_ram + host_addr, n);
+            maincpu_clk += n;
+            host_addr = (host_addr + n) & 0xffff;
+            reu_addr += n;
+            len -= n;
+            continue;
+        }
         reu_clk_inc_pre();
         machine_handle_pending_alarms(0);
         value = mem_read(host_addr);
@@ -1194,6 +1299,7 @@ static void reu_dma_host_to_reu(WORD host_addr, unsigned int reu_addr, int host_
 static void reu_dma_reu_to_host(WORD host_addr, unsigned int reu_addr, int host_step, int reu_step, int len)
 {
     BYTE value;
+    int n;
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "copy ext $%05X %s=> main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
 
@@ -1202,6 +1308,15 @@ static void reu_dma_reu_to_host(WORD host_addr, unsigned int reu_addr, int host_
     assert(len >= 1);
 
     while (len) {
+        n = reu_dma_bulk_length(host_addr, reu_addr, host_step, reu_step, len, 1, 1);
+        if (n > 0) {
+            memcpy(mem_ram + host_addr, reu_ram + (reu_addr & (rec_options.dram_wrap_around - 1)), n);
+            maincpu_clk += n;
+            host_addr = (host_addr + n) & 0xffff;
+            reu_addr += n;
+            len -= n;
+            continue;
+        }
         DEBUG_LOG(DEBUG_LEVEL_TRANSFER_LOW_LEVEL, (reu_log, "Transferring byte: %x from ext $%05X to main $%04X.", reu_ram[reu_addr % reu_size], reu_addr, host_addr));
         reu_clk_inc_pre();
         value = read_from_reu(reu_addr);
@@ -1237,6 +1352,8 @@ static void reu_dma_swap(WORD host_addr, unsigned int reu_addr, int host_step, i
 {
     BYTE value_from_reu;
     BYTE value_from_c64;
+    BYTE *p;
+    int i, n;
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "swap ext $%05X %s<=> main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
 
@@ -1245,6 +1362,20 @@ static void reu_dma_swap(WORD host_addr, unsigned int reu_addr, int host_step, i
     assert(len >= 1);
 
     while (len) {
+        n = reu_dma_bulk_length(host_addr, reu_addr, host_step, reu_step, len, 2, 1);
+        if (n > 0) {
+            p = reu_ram + (reu_addr & (rec_options.dram_wrap_around - 1));
+            for (i = 0; i < n; i++) {
+                value_from_reu = p[i];
+                p[i] = mem_ram[host_addr + i];
+                mem_ram[host_addr + i] = value_from_reu;
+            }
+            maincpu_clk += 2 * n;
+            host_addr = (host_addr + n) & 0xffff;
+            reu_addr += n;
+            len -= n;
+            continue;
+        }
         value_from_reu = read_from_reu(reu_addr);
         reu_clk_inc_pre();
         machine_handle_pending_alarms(0);
@@ -1287,6 +1418,8 @@ static void reu_dma_compare(WORD host_addr, unsigned int reu_addr, int host_step
     BYTE value_from_c64;
 
     BYTE new_status_or_mask = 0;
+    BYTE *p;
+    int n, equal;
 
     DEBUG_LOG(DEBUG_LEVEL_TRANSFER_HIGH_LEVEL, (reu_log, "compare ext $%05X %s<=> main $%04X%s, $%04X (%d) bytes.",
                                                 reu_addr, reu_step ? "" : "(fixed) ", host_addr, host_step ? "" : " (fixed)", len, len));
@@ -1301,6 +1434,21 @@ static void reu_dma_compare(WORD host_addr, unsigned int reu_addr, int host_step
     /* rec.status &= ~ (REU_REG_R_STATUS_VERIFY_ERROR | REU_REG_R_STATUS_END_OF_BLOCK); */
 
     while (len) {
+        /* equal bytes are skipped in bulk, the first difference is handled
+           by the exact code below */
+        n = reu_dma_bulk_length(host_addr, reu_addr, host_step, reu_step, len, 1, 0);
+        if (n > 0) {
+            p = reu_ram + (reu_addr & (rec_options.dram_wrap_around - 1));
+            for (equal = 0; equal < n && p[equal] == mem_ram[host_addr + equal]; equal++) {
+            }
+            if (equal > 0) {
+                maincpu_clk += equal;
+                host_addr = (host_addr + equal) & 0xffff;
+                reu_addr += equal;
+                len -= equal;
+                continue;
+            }
+        }
         reu_clk_inc_pre();
         machine_handle_pending_alarms(0);
         value_from_reu = read_from_reu(reu_addr);
@@ -48,6 +48,12 @@ extern void reu_ba_register(reu_ba_check_callback_t *ba_check,
                             reu_ba_steal_callback_t *ba_steal,
                             int *ba_var, int ba_mask);
 
+/* returns non-zero if the host page reads (write == 0) or writes
+   (write != 0) plain RAM without side effects */
+typedef int reu_ram_check_callback_t (WORD page, int write);
+
+extern void reu_ram_check_register(reu_ram_check_callback_t *ram_check);
+
 extern void reu_reset(void);
 extern void reu_dma(int immed);
 extern void reu_dma_start(void);
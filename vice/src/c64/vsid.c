@@ -50,6 +50,7 @@
 #include "imagecontents.h"
 #include "init.h"
 #include "kbdbuf.h"
+#include "lib.h"
 #include "log.h"
 #include "machine-drive.h"
 #include "machine-video.h"
@@ -66,6 +67,8 @@
 #include "viciivsid.h"
 #include "vicii-mem.h"
 #include "video.h"
+#include "vsidbatch.h"
+#include "vsidend.h"
 #include "vsidui.h"
 #include "vsync.h"
 
@@ -109,6 +112,10 @@ int machine_resources_init(void)
         init_resource_fail("psid");
         return -1;
     }
+    if (vsid_end_resources_init() < 0) {
+        init_resource_fail("vsid end");
+        return -1;
+    }
     return 0;
 }
 
@@ -134,6 +141,14 @@ int machine_cmdline_options_init(void)
         init_cmdline_options_fail("psid");
         return -1;
     }
+    if (vsid_end_cmdline_options_init() < 0) {
+        init_cmdline_options_fail("vsid end");
+        return -1;
+    }
+    if (vsid_batch_cmdline_options_init() < 0) {
+        init_cmdline_options_fail("vsid batch");
+        return -1;
+    }
     return 0;
 }
 
@@ -229,6 +244,8 @@ void machine_specific_reset(void)
     /* The VIC-II must be the *last* to be reset.  */
     vicii_reset();
 
+    vsid_end_reset();
+
     if (psid_basic_rsid_to_autostart(&vsid_autostart_load_addr, &vsid_autostart_data, &vsid_autostart_length)) {
         vsid_autostart_delay = (int)(machine_timing.rfsh_per_sec * 23 / 10);
     } else {
@@ -258,6 +275,9 @@ void machine_specific_shutdown(void)
     sid_cmdline_options_shutdown();
 
     psid_shutdown();
+
+    vsid_batch_shutdown();
+    vsid_end_shutdown();
 }
 
 void machine_handle_pending_alarms(int num_write_cycles)
@@ -270,9 +290,10 @@ void machine_handle_pending_alarms(int num_write_cycles)
 /* This hook is called at the end of every frame.  */
 static void machine_vsync_hook(void)
 {
-    int i;
+    int i, end;
     unsigned int playtime;
     static unsigned int time = 0;
+    char *text;
 
     if (vsid_autostart_delay > 0) {
         if (-- vsid_autostart_delay == 0) {
@@ -291,6 +312,18 @@ static void machine_vsync_hook(void)
         vsid_ui_display_time(playtime);
         time = playtime;
     }
+
+    end = vsid_end_frame();
+    if (!vsid_batch_frame(end) && end != VSID_END_NONE) {
+        text = vsid_end_describe();
+        log_message(c64_log, "Tune ended after %s.", text);
+        lib_free(text);
+        /* A render from the command line is done.  */
+        if (console_mode) {
+            exit(EXIT_SUCCESS);
+        }
+    }
+
     clk_guard_prevent_overflow(maincpu_clk_guard);
 }
 
@@ -0,0 +1,601 @@
+/*
+ * vsidbatch.c - Render lists of SID files to sound files.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* With `-batch <list>' vsid renders every tune of every SID file in the
+   list to a file of its own through a sound recording driver, then exits.
+   It all runs from the vsync hook in warp mode: a tune ends after the
+   given time or when vsidend.c detects silence or a loop, and the next one
+   is reset and recorded.  With `-batchreport <file>' the length and the
+   end of every tune are appended to a tab separated report.
+
+   With `-batchjobs <n>' the machine is set up once and then forked into
+   n workers, which take the files from a pipe one at a time.  The ROMs,
+   the reSID tables and everything else that is only read stay shared
+   between the workers.
+
+   `-sidwriteplay <log>' renders a SID write log (see sid-writelog.c)
+   through the sound devices and exits; the machine only runs the first
+   frame.  */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_WORKING_FORK
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "archdep.h"
+#include "cmdline.h"
+#include "ioutil.h"
+#include "lib.h"
+#include "log.h"
+#include "machine.h"
+#include "psid.h"
+#include "resources.h"
+#include "sid-writelog.h"
+#include "sound.h"
+#include "translate.h"
+#include "types.h"
+#include "util.h"
+#include "vsidbatch.h"
+#include "vsidend.h"
+
+enum {
+    BATCH_OFF = 0,
+    BATCH_SETUP,
+    BATCH_START,
+    BATCH_RENDER
+};
+
+static int batch_state = BATCH_OFF;
+
+static char *batch_list = NULL;
+static char *batch_dir = NULL;
+static char *batch_device = NULL;
+static char *batch_report = NULL;
+static char *play_log = NULL;
+static int batch_time = 180;
+static int batch_jobs = 1;
+
+/* The SID files from the list.  */
+static char **files = NULL;
+static unsigned int file_count = 0;
+
+/* Next file when rendering in one process; workers read the file numbers
+   from `job_fd' instead.  */
+static unsigned int next_file = 0;
+static int job_fd = -1;
+
+/* The file and tune being rendered.  */
+static unsigned int file_nr;
+static int tune = 0, tunes = 0;
+static unsigned long frames;
+
+/* The SID files may change these, they are restored for every file.  */
+static int default_sid_model, default_video_standard;
+
+static unsigned int renders = 0, failed = 0;
+
+/* Shared by the workers, every line is written at once.  */
+static FILE *report_file = NULL;
+
+static log_t batch_log = LOG_ERR;
+
+/* ------------------------------------------------------------------------- */
+
+static int batch_read_list(void)
+{
+    FILE *f;
+    char *line;
+    unsigned int size = 0;
+    int len;
+
+    f = fopen(batch_list, MODE_READ_TEXT);
+    if (f == NULL) {
+        log_error(batch_log, "Cannot open the list `%s'.", batch_list);
+        return -1;
+    }
+
+    line = lib_malloc(ioutil_maxpathlen());
+    while ((len = util_get_line(line, (int)ioutil_maxpathlen(), f)) >= 0) {
+        if (len == 0 || line[0] == '#') {
+            continue;
+        }
+        if (file_count == size) {
+            size = size ? size * 2 : 256;
+            files = lib_realloc(files, size * sizeof(char *));
+        }
+        files[file_count++] = lib_stralloc(line);
+    }
+    lib_free(line);
+    fclose(f);
+
+    log_message(batch_log, "%u files in `%s'.", file_count, batch_list);
+
+    return 0;
+}
+
+/* Output file for the current tune: the listed path below the output
+   directory, with the extension replaced by the tune number and the
+   record device name.  Missing directories are created.  */
+static char *batch_output_name(void)
+{
+    const char *path = files[file_nr];
+    char *name, *output, *p;
+    char number[16];
+
+    /* Keep the output below the output directory.  */
+    while (1) {
+        if (path[0] == FSDEV_DIR_SEP_CHR) {
+            path++;
+        } else if (strncmp(path, "." FSDEV_DIR_SEP_STR, 2) == 0) {
+            path += 2;
+        } else if (strncmp(path, ".." FSDEV_DIR_SEP_STR, 3) == 0) {
+            path += 3;
+        } else {
+            break;
+        }
+    }
+
+    name = util_concat(batch_dir, FSDEV_DIR_SEP_STR, path, NULL);
+    p = strrchr(name, FSDEV_EXT_SEP_CHR);
+    if (p != NULL && strchr(p, FSDEV_DIR_SEP_CHR) == NULL) {
+        *p = 0;
+    }
+    sprintf(number, "-%d" FSDEV_EXT_SEP_STR, tune);
+    output = util_concat(name, number, batch_device, NULL);
+    lib_free(name);
+
+    for (p = strchr(output + 1, FSDEV_DIR_SEP_CHR); p != NULL; p = strchr(p + 1, FSDEV_DIR_SEP_CHR)) {
+        *p = 0;
+        ioutil_mkdir(output, 0755);
+        *p = FSDEV_DIR_SEP_CHR;
+    }
+
+    return output;
+}
+
+static void batch_restore_settings(void)
+{
+    int value;
+
+    resources_get_int("SidModel", &value);
+    if (value != default_sid_model) {
+        resources_set_int("SidModel", default_sid_model);
+    }
+    resources_get_int("MachineVideoStandard", &value);
+    if (value != default_video_standard) {
+        resources_set_int("MachineVideoStandard", default_video_standard);
+    }
+}
+
+static int batch_next_job(void)
+{
+#ifdef HAVE_WORKING_FORK
+    if (job_fd >= 0) {
+        ssize_t len;
+
+        do {
+            len = read(job_fd, &file_nr, sizeof(file_nr));
+        } while (len < 0 && errno == EINTR);
+
+        return (len == sizeof(file_nr)) ? 0 : -1;
+    }
+#endif
+
+    if (next_file >= file_count) {
+        return -1;
+    }
+    file_nr = next_file++;
+
+    return 0;
+}
+
+/* Load the next file with at least one tune.  */
+static int batch_next_file(void)
+{
+    int default_tune;
+
+    while (batch_next_job() == 0) {
+        batch_restore_settings();
+        if (psid_load_file(files[file_nr]) < 0) {
+            log_error(batch_log, "`%s' is not a valid SID file.", files[file_nr]);
+            failed++;
+            continue;
+        }
+        tunes = psid_tunes(&default_tune);
+        tune = 0;
+        if (tunes > 0) {
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+static void batch_finish(void)
+{
+    sound_stop_recording();
+
+    log_message(batch_log, "%u tunes rendered, %u files failed.", renders, failed);
+
+    exit(failed ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+static void batch_next_tune(void)
+{
+    char *name;
+
+    if (tune >= tunes && batch_next_file() < 0) {
+        batch_finish();
+        return;
+    }
+    tune++;
+
+    frames = 0;
+
+    psid_init_driver();
+    machine_play_psid(tune);
+    machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+
+    /* Setting the device again also closes the previous file.  */
+    name = batch_output_name();
+    resources_set_string("SoundRecordDeviceArg", name);
+    resources_set_string("SoundRecordDeviceName", batch_device);
+    lib_free(name);
+}
+
+static void batch_write_report(void)
+{
+    static const char *reasons[] = { "time", "silence", "loop" };
+    vsid_end_t end;
+
+    vsid_end_get(&end);
+    fprintf(report_file, "%s\t%d\t%.2f\t%s\t%.2f\t%.2f\n",
+            files[file_nr], tune, end.length, reasons[end.reason],
+            end.loop_start, end.loop_length);
+    fflush(report_file);
+}
+
+static void batch_render_frame(int end)
+{
+    char *text;
+
+    frames++;
+    if (end == VSID_END_NONE
+        && (double)frames * (double)machine_get_cycles_per_frame()
+           < (double)batch_time * (double)machine_get_cycles_per_second()) {
+        return;
+    }
+
+    text = vsid_end_describe();
+    log_message(batch_log, "`%s' tune %d: %s.", files[file_nr], tune, text);
+    lib_free(text);
+    if (report_file != NULL) {
+        batch_write_report();
+    }
+    renders++;
+
+    batch_next_tune();
+}
+
+/* ------------------------------------------------------------------------- */
+
+#ifdef HAVE_WORKING_FORK
+/* Fork the workers and feed them the file numbers.  Only the workers
+   return; if none could be started, the files are rendered here.  */
+static void batch_fork(void)
+{
+    int fds[2];
+    pid_t *pids;
+    unsigned int i;
+    int n, status, failed_workers = 0;
+
+    if (pipe(fds) < 0) {
+        log_error(batch_log, "Cannot create the job pipe: %s.", strerror(errno));
+        return;
+    }
+
+    /* Threads do not survive fork().  */
+#ifdef HAVE_PTHREAD
+    resources_set_int("LogThread", 0);
+    resources_set_int("SoundThread", 0);
+#endif
+    fflush(NULL);
+
+    pids = lib_calloc((size_t)batch_jobs, sizeof(pid_t));
+
+    for (n = 0; n < batch_jobs; n++) {
+        pids[n] = fork();
+        if (pids[n] < 0) {
+            log_error(batch_log, "fork() failed: %s.", strerror(errno));
+            break;
+        }
+        if (pids[n] == 0) {
+            close(fds[1]);
+            job_fd = fds[0];
+            lib_free(pids);
+            return;
+        }
+    }
+
+    close(fds[0]);
+
+    if (n == 0) {
+        close(fds[1]);
+        lib_free(pids);
+        return;
+    }
+
+    log_message(batch_log, "Rendering with %d workers.", n);
+
+    i = 0;
+    while (i < file_count) {
+        if (write(fds[1], &i, sizeof(i)) == sizeof(i)) {
+            i++;
+        } else if (errno != EINTR) {
+            log_error(batch_log, "Cannot pass on the jobs: %s.", strerror(errno));
+            break;
+        }
+    }
+    close(fds[1]);
+
+    while (n-- > 0) {
+        while (waitpid(pids[n], &status, 0) < 0) {
+            if (errno != EINTR) {
+                status = -1;
+                break;
+            }
+        }
+        if (status != 0) {
+            failed_workers++;
+        }
+    }
+    lib_free(pids);
+
+    if (failed_workers > 0) {
+        log_error(batch_log, "%d workers reported failures.", failed_workers);
+    }
+
+    exit(failed_workers ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+#endif
+
+/* The first frame switches to the dummy sound device, which is open when
+   the second one starts the renders, so the workers inherit the SID
+   engine tables.  */
+static void batch_setup(void)
+{
+    batch_log = log_open("VsidBatch");
+
+    if (!console_mode) {
+        log_error(batch_log, "Batch rendering needs -console.");
+        exit(EXIT_FAILURE);
+    }
+
+    resources_get_int("SidModel", &default_sid_model);
+    resources_get_int("MachineVideoStandard", &default_video_standard);
+
+    resources_set_int("WarpMode", 1);
+    resources_set_int("Sound", 1);
+    resources_set_string("SoundDeviceName", "dummy");
+    resources_set_string("SoundRecordDeviceName", "");
+
+    batch_state = BATCH_START;
+}
+
+static void batch_start(void)
+{
+    if (batch_read_list() < 0) {
+        exit(EXIT_FAILURE);
+    }
+
+    /* Opened before forking, so all lines go to the end of the file.  */
+    if (batch_report != NULL) {
+        report_file = fopen(batch_report, MODE_APPEND);
+        if (report_file == NULL) {
+            log_error(batch_log, "Cannot open the report `%s'.", batch_report);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+#ifdef HAVE_WORKING_FORK
+    if (batch_jobs > 1) {
+        batch_fork();
+    }
+#else
+    if (batch_jobs > 1) {
+        log_warning(batch_log, "No worker processes on this platform, rendering in one.");
+    }
+#endif
+
+    batch_state = BATCH_RENDER;
+    batch_next_tune();
+}
+
+static void batch_play_log(void)
+{
+    batch_log = log_open("VsidBatch");
+
+    if (!console_mode) {
+        log_error(batch_log, "Playing a SID write log needs -console.");
+        exit(EXIT_FAILURE);
+    }
+
+    if (sid_writelog_play(play_log) < 0) {
+        exit(EXIT_FAILURE);
+    }
+    sound_stop_recording();
+
+    exit(EXIT_SUCCESS);
+}
+
+int vsid_batch_frame(int end)
+{
+    if (play_log != NULL) {
+        batch_play_log();
+    }
+
+    switch (batch_state) {
+        case BATCH_SETUP:
+            batch_setup();
+            break;
+        case BATCH_START:
+            batch_start();
+            break;
+        case BATCH_RENDER:
+            batch_render_frame(end);
+            break;
+        default:
+            return 0;
+    }
+
+    return 1;
+}
+
+void vsid_batch_shutdown(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < file_count; i++) {
+        lib_free(files[i]);
+    }
+    lib_free(files);
+    files = NULL;
+    file_count = 0;
+
+    lib_free(batch_list);
+    lib_free(batch_dir);
+    lib_free(batch_device);
+    lib_free(batch_report);
+    lib_free(play_log);
+    batch_list = batch_dir = batch_device = batch_report = play_log = NULL;
+
+    if (report_file != NULL) {
+        fclose(report_file);
+        report_file = NULL;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int set_batch_list(const char *param, void *extra_param)
+{
+    util_string_set(&batch_list, param);
+    batch_state = BATCH_SETUP;
+
+    return 0;
+}
+
+static int set_batch_dir(const char *param, void *extra_param)
+{
+    util_string_set(&batch_dir, param);
+
+    return 0;
+}
+
+static int set_batch_device(const char *param, void *extra_param)
+{
+    util_string_set(&batch_device, param);
+
+    return 0;
+}
+
+static int set_batch_report(const char *param, void *extra_param)
+{
+    util_string_set(&batch_report, param);
+
+    return 0;
+}
+
+static int set_play_log(const char *param, void *extra_param)
+{
+    util_string_set(&play_log, param);
+
+    return 0;
+}
+
+static int set_batch_number(const char *param, void *extra_param)
+{
+    int *value = (int *)extra_param;
+
+    *value = atoi(param);
+    if (*value <= 0) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static const cmdline_option_t cmdline_options[] = {
+    { "-batch", CALL_FUNCTION, 1,
+      set_batch_list, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_FILE, IDCLS_SPECIFY_BATCH_LIST_FILE,
+      NULL, NULL },
+    { "-batchdir", CALL_FUNCTION, 1,
+      set_batch_dir, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_PATH, IDCLS_SPECIFY_BATCH_OUTPUT_DIR,
+      NULL, NULL },
+    { "-batchdev", CALL_FUNCTION, 1,
+      set_batch_device, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_DEVICE, IDCLS_SPECIFY_BATCH_RECORD_DEVICE,
+      NULL, NULL },
+    { "-batchtime", CALL_FUNCTION, 1,
+      set_batch_number, (void *)&batch_time, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_NUMBER, IDCLS_SET_BATCH_TIME,
+      NULL, NULL },
+    { "-batchreport", CALL_FUNCTION, 1,
+      set_batch_report, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_FILE, IDCLS_SPECIFY_BATCH_REPORT_FILE,
+      NULL, NULL },
+    { "-batchjobs", CALL_FUNCTION, 1,
+      set_batch_number, (void *)&batch_jobs, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_NUMBER, IDCLS_SET_BATCH_JOBS,
+      NULL, NULL },
+    { "-sidwriteplay", CALL_FUNCTION, 1,
+      set_play_log, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_FILE, IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE,
+      NULL, NULL },
+    { NULL }
+};
+
+int vsid_batch_cmdline_options_init(void)
+{
+    batch_dir = lib_stralloc(".");
+    batch_device = lib_stralloc("wav");
+
+    return cmdline_register_options(cmdline_options);
+}
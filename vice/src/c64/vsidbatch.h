@@ -0,0 +1,34 @@
+/*
+ * vsidbatch.h - Render lists of SID files to sound files.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_VSIDBATCH_H
+#define VICE_VSIDBATCH_H
+
+extern int vsid_batch_cmdline_options_init(void);
+extern void vsid_batch_shutdown(void);
+
+/* Called at the end of every frame with the result of `vsid_end_frame()'.
+   Returns nonzero while rendering a batch.  */
+extern int vsid_batch_frame(int end);
+
+#endif
@@ -0,0 +1,410 @@
+/*
+ * vsidend.c - Detect the end of a tune by silence or a loop.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* Silence is taken from the samples written to the sound devices: a frame
+   is silent when the samples of every channel stay within a small peak to
+   peak level, so a DC offset does not count as sound.
+
+   For loops, the SID writes of every frame (chip, register and value, but
+   not the cycle) are hashed.  A loop is a period of at least
+   VSID_LOOP_MIN_SECONDS over which the frame hashes repeat for a whole
+   period and at least VSID_LOOP_CONFIRM_SECONDS, so repeated phrases in
+   the tune itself are not taken for the loop.  Candidate periods are
+   found by looking up the hash of the last VSID_LOOP_KGRAM frames; a
+   sequence only becomes visible to the lookup VSID_LOOP_MIN_SECONDS after
+   it was played, so the shortest period found is never below that.  */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmdline.h"
+#include "lib.h"
+#include "machine.h"
+#include "resources.h"
+#include "sound.h"
+#include "translate.h"
+#include "types.h"
+#include "vsidend.h"
+
+/* Peak to peak level up to which samples count as silent.  */
+#define VSID_SILENCE_LEVEL 16
+
+#define VSID_LOOP_KGRAM           32
+#define VSID_LOOP_MIN_SECONDS     2
+#define VSID_LOOP_CONFIRM_SECONDS 30
+
+#define VSID_HASH_BASIS 2166136261U
+#define VSID_HASH_PRIME 16777619U
+
+static int silence_end = 0;
+static int loop_end = 0;
+
+/* The settings for the current tune.  */
+static int silence_seconds = 0;
+static int loop_active = 0;
+
+static int detected = VSID_END_NONE;
+static unsigned long frames = 0;
+
+/* End of the tune, start and length of the loop, in frames.  */
+static unsigned long end_frames, loop_start_frames, loop_frames;
+
+/* Silence.  */
+static int frame_samples = 0, frame_loud = 0;
+static unsigned long silent_frames = 0;
+
+/* Frame hashes of the tune.  */
+static DWORD frame_hash = VSID_HASH_BASIS;
+static DWORD *hashes = NULL;
+static unsigned long hashes_size = 0;
+
+/* Last frame (plus one, 0: empty) that ended a sequence with the given
+   hash, open addressing.  */
+static DWORD *kgram_keys = NULL;
+static unsigned long *kgram_frames = NULL;
+static unsigned long kgram_size = 0, kgram_count = 0;
+
+/* Candidate loop period and the number of frames that repeated it.  */
+static unsigned long period = 0, run = 0;
+
+/* ------------------------------------------------------------------------- */
+
+static double frames_to_seconds(unsigned long n)
+{
+    return (double)n * (double)machine_get_cycles_per_frame()
+           / (double)machine_get_cycles_per_second();
+}
+
+static unsigned long seconds_to_frames(int seconds)
+{
+    return (unsigned long)((double)seconds * (double)machine_get_cycles_per_second()
+                           / (double)machine_get_cycles_per_frame());
+}
+
+static void vsid_end_store(WORD addr, BYTE val, int chipno)
+{
+    frame_hash = (frame_hash ^ (DWORD)((chipno << 16) | (addr << 8) | val)) * VSID_HASH_PRIME;
+}
+
+/* The samples are interleaved, each channel is measured on its own.  */
+static void vsid_end_write(const SWORD *pbuf, size_t nr, int channels)
+{
+    SWORD min, max;
+    size_t i;
+    int c;
+
+    if (nr == 0 || channels <= 0) {
+        return;
+    }
+
+    frame_samples = 1;
+    if (frame_loud) {
+        return;
+    }
+
+    for (c = 0; c < channels && (size_t)c < nr; c++) {
+        min = max = pbuf[c];
+        for (i = c + channels; i < nr; i += channels) {
+            if (pbuf[i] < min) {
+                min = pbuf[i];
+            } else if (pbuf[i] > max) {
+                max = pbuf[i];
+            }
+        }
+
+        if (max - min > VSID_SILENCE_LEVEL) {
+            frame_loud = 1;
+            return;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+static DWORD kgram_hash(unsigned long last)
+{
+    DWORD h = VSID_HASH_BASIS;
+    unsigned long i;
+
+    for (i = last + 1 - VSID_LOOP_KGRAM; i <= last; i++) {
+        h = (h ^ hashes[i]) * VSID_HASH_PRIME;
+    }
+    return h;
+}
+
+static void kgram_insert(DWORD key, unsigned long frame);
+
+static void kgram_grow(void)
+{
+    DWORD *old_keys = kgram_keys;
+    unsigned long *old_frames = kgram_frames;
+    unsigned long i, old_size = kgram_size;
+
+    kgram_size = kgram_size ? kgram_size * 2 : 4096;
+    kgram_keys = lib_malloc(kgram_size * sizeof(DWORD));
+    kgram_frames = lib_calloc(kgram_size, sizeof(unsigned long));
+    kgram_count = 0;
+
+    for (i = 0; i < old_size; i++) {
+        if (old_frames[i] != 0) {
+            kgram_insert(old_keys[i], old_frames[i] - 1);
+        }
+    }
+    lib_free(old_keys);
+    lib_free(old_frames);
+}
+
+static void kgram_insert(DWORD key, unsigned long frame)
+{
+    unsigned long i;
+
+    if ((kgram_count + 1) * 2 > kgram_size) {
+        kgram_grow();
+    }
+
+    for (i = key & (kgram_size - 1); kgram_frames[i] != 0; i = (i + 1) & (kgram_size - 1)) {
+        if (kgram_keys[i] == key) {
+            kgram_frames[i] = frame + 1;
+            return;
+        }
+    }
+    kgram_keys[i] = key;
+    kgram_frames[i] = frame + 1;
+    kgram_count++;
+}
+
+static int kgram_lookup(DWORD key, unsigned long *frame)
+{
+    unsigned long i;
+
+    if (kgram_size == 0) {
+        return 0;
+    }
+
+    for (i = key & (kgram_size - 1); kgram_frames[i] != 0; i = (i + 1) & (kgram_size - 1)) {
+        if (kgram_keys[i] == key) {
+            *frame = kgram_frames[i] - 1;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int vsid_end_silence_frame(void)
+{
+    if (frame_samples) {
+        silent_frames = frame_loud ? 0 : silent_frames + 1;
+    }
+
+    if (silent_frames > 0 && silent_frames >= seconds_to_frames(silence_seconds)) {
+        end_frames = frames + 1 - silent_frames;
+        return VSID_END_SILENCE;
+    }
+    return VSID_END_NONE;
+}
+
+static int vsid_end_loop_frame(void)
+{
+    unsigned long n = frames, min_frames, start, match;
+
+    if (n >= hashes_size) {
+        hashes_size = (n + 1) * 2;
+        hashes = lib_realloc(hashes, hashes_size * sizeof(DWORD));
+    }
+    hashes[n] = frame_hash;
+
+    min_frames = seconds_to_frames(VSID_LOOP_MIN_SECONDS);
+    if (n + 1 >= min_frames + VSID_LOOP_KGRAM) {
+        kgram_insert(kgram_hash(n - min_frames), n - min_frames);
+    }
+
+    if (period > 0) {
+        if (hashes[n] == hashes[n - period]) {
+            run++;
+            if (run >= period && run >= seconds_to_frames(VSID_LOOP_CONFIRM_SECONDS)) {
+                /* The loop starts where the repetition does.  */
+                start = n + 1 - run;
+                while (start > period && hashes[start - 1] == hashes[start - 1 - period]) {
+                    start--;
+                }
+                end_frames = start;
+                loop_start_frames = start - period;
+                loop_frames = period;
+                return VSID_END_LOOP;
+            }
+            return VSID_END_NONE;
+        }
+        period = 0;
+    }
+
+    if (n + 1 >= VSID_LOOP_KGRAM
+        && kgram_lookup(kgram_hash(n), &match)
+        && memcmp(hashes + n + 1 - VSID_LOOP_KGRAM, hashes + match + 1 - VSID_LOOP_KGRAM,
+                  VSID_LOOP_KGRAM * sizeof(DWORD)) == 0) {
+        period = n - match;
+        run = VSID_LOOP_KGRAM;
+    }
+
+    return VSID_END_NONE;
+}
+
+int vsid_end_frame(void)
+{
+    int reason = VSID_END_NONE;
+
+    if (detected == VSID_END_NONE) {
+        if (silence_seconds > 0) {
+            reason = vsid_end_silence_frame();
+        }
+        if (reason == VSID_END_NONE && loop_active) {
+            reason = vsid_end_loop_frame();
+        }
+        detected = reason;
+    }
+
+    frames++;
+    frame_samples = frame_loud = 0;
+    frame_hash = VSID_HASH_BASIS;
+
+    return reason;
+}
+
+void vsid_end_reset(void)
+{
+    detected = VSID_END_NONE;
+    frames = 0;
+    end_frames = loop_start_frames = loop_frames = 0;
+
+    frame_samples = frame_loud = 0;
+    silent_frames = 0;
+
+    frame_hash = VSID_HASH_BASIS;
+    period = run = 0;
+    if (kgram_count > 0) {
+        memset(kgram_frames, 0, kgram_size * sizeof(unsigned long));
+        kgram_count = 0;
+    }
+
+    silence_seconds = silence_end;
+    loop_active = loop_end;
+
+    sound_set_observers(loop_active ? vsid_end_store : NULL,
+                        (silence_seconds > 0) ? vsid_end_write : NULL);
+}
+
+void vsid_end_get(vsid_end_t *end)
+{
+    end->reason = detected;
+    end->length = frames_to_seconds((detected == VSID_END_NONE) ? frames : end_frames);
+    end->loop_start = frames_to_seconds(loop_start_frames);
+    end->loop_length = frames_to_seconds(loop_frames);
+}
+
+char *vsid_end_describe(void)
+{
+    vsid_end_t end;
+
+    vsid_end_get(&end);
+
+    switch (end.reason) {
+        case VSID_END_SILENCE:
+            return lib_msprintf("%.2f s (silence)", end.length);
+        case VSID_END_LOOP:
+            return lib_msprintf("%.2f s (loop at %.2f s, %.2f s long)",
+                                end.length, end.loop_start, end.loop_length);
+        default:
+            return lib_msprintf("%.2f s", end.length);
+    }
+}
+
+void vsid_end_shutdown(void)
+{
+    sound_set_observers(NULL, NULL);
+
+    lib_free(hashes);
+    lib_free(kgram_keys);
+    lib_free(kgram_frames);
+    hashes = NULL;
+    kgram_keys = NULL;
+    kgram_frames = NULL;
+    hashes_size = kgram_size = kgram_count = 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/* Both take effect at the next tune.  */
+
+static int set_silence_end(int val, void *param)
+{
+    silence_end = (val < 0) ? 0 : val;
+
+    return 0;
+}
+
+static int set_loop_end(int val, void *param)
+{
+    loop_end = val ? 1 : 0;
+
+    return 0;
+}
+
+static const resource_int_t resources_int[] = {
+    { "PSIDSilenceEnd", 0, RES_EVENT_NO, NULL,
+      &silence_end, set_silence_end, NULL },
+    { "PSIDLoopEnd", 0, RES_EVENT_NO, NULL,
+      &loop_end, set_loop_end, NULL },
+    { NULL }
+};
+
+int vsid_end_resources_init(void)
+{
+    return resources_register_int(resources_int);
+}
+
+static const cmdline_option_t cmdline_options[] = {
+    { "-silenceend", SET_RESOURCE, 1,
+      NULL, NULL, "PSIDSilenceEnd", NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_NUMBER, IDCLS_SET_PSID_SILENCE_END,
+      NULL, NULL },
+    { "-loopend", SET_RESOURCE, 0,
+      NULL, NULL, "PSIDLoopEnd", (resource_value_t)1,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_ENABLE_PSID_LOOP_END,
+      NULL, NULL },
+    { "+loopend", SET_RESOURCE, 0,
+      NULL, NULL, "PSIDLoopEnd", (resource_value_t)0,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_DISABLE_PSID_LOOP_END,
+      NULL, NULL },
+    { NULL }
+};
+
+int vsid_end_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
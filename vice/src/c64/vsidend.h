@@ -0,0 +1,61 @@
+/*
+ * vsidend.h - Detect the end of a tune by silence or a loop.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_VSIDEND_H
+#define VICE_VSIDEND_H
+
+#define VSID_END_NONE    0
+#define VSID_END_SILENCE 1
+#define VSID_END_LOOP    2
+
+typedef struct vsid_end_s {
+    /* VSID_END_... */
+    int reason;
+
+    /* Seconds played so far, or up to the detected end: the start of the
+       silence, or the end of the first pass through the loop.  */
+    double length;
+
+    /* Start and length of the loop in seconds.  */
+    double loop_start;
+    double loop_length;
+} vsid_end_t;
+
+extern int vsid_end_resources_init(void);
+extern int vsid_end_cmdline_options_init(void);
+extern void vsid_end_shutdown(void);
+
+/* Start over at the start of a tune.  */
+extern void vsid_end_reset(void);
+
+/* Called at the end of every frame.  Returns the reason in the frame the
+   end is detected and VSID_END_NONE otherwise.  */
+extern int vsid_end_frame(void);
+
+extern void vsid_end_get(vsid_end_t *end);
+
+/* Text like "123.45 s (loop at 12.34 s, 111.11 s long)"; free it with
+   `lib_free()'.  */
+extern char *vsid_end_describe(void);
+
+#endif
@@ -51,10 +51,45 @@
 static unsigned int num_options, num_allocated_options;
 static cmdline_option_ram_t *options;
 
+/* use a hash table with 1024 entries */
+static const unsigned int logHashSize = 10;
+
+static int *hashTable = NULL;
+
+/* calculate the hash key */
+static unsigned int cmdline_calc_hash_key(const char *name)
+{
+    unsigned int key, i, shift;
+
+    key = 0; shift = 0;
+    for (i = 0; name[i] != '\0'; i++) {
+        unsigned int sym = (unsigned int)(unsigned char)name[i];
+
+        if (shift >= logHashSize) {
+            shift = 0;
+        }
+
+        key ^= (sym << shift);
+        if (shift + 8 > logHashSize) {
+            key ^= (sym >> (logHashSize - shift));
+        }
+        shift++;
+    }
+    return (key & ((1 << logHashSize) - 1));
+}
+
 int cmdline_init(void)
 {
+    unsigned int i;
+
     lib_free(options);
     options = NULL;
+    lib_free(hashTable);
+
+    hashTable = lib_malloc((1 << logHashSize) * sizeof(int));
+    for (i = 0; i < (1 << logHashSize); i++) {
+        hashTable[i] = -1;
+    }
 
     num_allocated_options = 100;
     num_options = 0;
@@ -65,9 +100,9 @@ int cmdline_init(void)
 
 static cmdline_option_ram_t *lookup_exact(const char *name)
 {
-    unsigned int i;
+    int i;
 
-    for (i = 0; i < num_options; i++) {
+    for (i = hashTable[cmdline_calc_hash_key(name)]; i >= 0; i = options[i].hash_next) {
         if (strcmp(options[i].name, name) == 0) {
             return &options[i];
         }
@@ -81,6 +116,8 @@ int cmdline_register_options(const cmdline_option_t *c)
 
     p = options + num_options;
     for (; c->name != NULL; c++, p++) {
+        unsigned int hashkey;
+
         if (lookup_exact(c->name)) {
             archdep_startup_log_error("CMDLINE: (%d) Duplicated option '%s'.\n", num_options, c->name);
             return -1;
@@ -124,6 +161,10 @@ int cmdline_register_options(const cmdline_option_t *c)
 
         p->combined_string = NULL;
 
+        hashkey = cmdline_calc_hash_key(c->name);
+        p->hash_next = hashTable[hashkey];
+        hashTable[hashkey] = (int)num_options;
+
         num_options++;
     }
 
@@ -148,6 +189,8 @@ void cmdline_shutdown(void)
     cmdline_free();
 
     lib_free(options);
+    lib_free(hashTable);
+    hashTable = NULL;
 }
 
 static cmdline_option_ram_t *lookup(const char *name, int *is_ambiguous)
@@ -156,10 +199,15 @@ static cmdline_option_ram_t *lookup(const char *name, int *is_ambiguous)
     size_t name_len;
     unsigned int i;
 
+    /* return exact matches immediately */
+    match = lookup_exact(name);
+    *is_ambiguous = 0;
+    if (match != NULL) {
+        return match;
+    }
+
     name_len = strlen(name);
 
-    match = NULL;
-    *is_ambiguous = 0;
     for (i = 0; i < num_options; i++) {
         if (strncmp(options[i].name, name, name_len) == 0) {
             if (options[i].name[name_len] == '\0') {
@@ -122,6 +122,9 @@ typedef struct cmdline_option_ram_s {
 
     /* Place holder for translated combined string */
     char *combined_string;
+
+    /* Index of the next option in the hash collision list, or -1.  */
+    int hash_next;
 } cmdline_option_ram_t;
 
 extern int cmdline_init(void);
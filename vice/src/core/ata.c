@@ -40,6 +40,7 @@
 #include <string.h>
 
 #include "archdep.h"
+#include "blockcache.h"
 #include "log.h"
 #include "ata.h"
 #include "snapshot.h"
@@ -89,6 +90,8 @@ struct ata_drive_s {
     int bufp;
     BYTE *buffer;
     FILE *file;
+    blockcache_t *cache;
+    off_t file_pos;
     char *filename;
     char *myname;
     ata_drive_geometry_t geometry;
@@ -252,9 +255,7 @@ static int seek_sector(ata_drive_t *drv)
     drv->busy |= 2;
     alarm_set(drv->head_alarm, maincpu_clk + (CLOCK)(abs(drv->pos - lba) * drv->seek_time / drv->geometry.size));
     ata_change_power_mode(drv, 0xff);
-    if (fseeko(drv->file, (off_t)lba * drv->sector_size, SEEK_SET)) {
-        drv->error = drv->atapi ? 0x54 : ATA_IDNF;
-    }
+    drv->file_pos = (off_t)lba * drv->sector_size;
     drv->pos = lba;
     return drv->error;
 }
@@ -287,16 +288,12 @@ static int read_sector(ata_drive_t *drv)
         return drv->error;
     }
 
-    clearerr(drv->file);
-    if (fread(drv->buffer, drv->sector_size, 1, drv->file) != 1) {
-        memset(drv->buffer, 0, drv->sector_size);
-    }
-
-    if (ferror(drv->file)) {
+    if (blockcache_read(drv->cache, drv->file_pos, drv->buffer, drv->sector_size) < 0) {
         ata_set_command_block(drv);
         drv->error = drv->atapi ? 0x54 : (ATA_UNC | ATA_ABRT);
         drv->cmd = 0x00;
     } else {
+        drv->file_pos += drv->sector_size;
         drv->pos++;
         drv->bufp = 0;
     }
@@ -329,16 +326,19 @@ static int write_sector(ata_drive_t *drv)
         return drv->error;
     }
 
-    if (fwrite(drv->buffer, 1, drv->sector_size, drv->file) != (size_t)drv->sector_size) {
+    if (blockcache_write(drv->cache, drv->file_pos, drv->buffer, drv->sector_size) < 0) {
         ata_set_command_block(drv);
         drv->error = drv->atapi ? 0x54 : (ATA_UNC | ATA_ABRT);
         drv->cmd = 0x00;
     } else {
+        drv->file_pos += drv->sector_size;
         drv->pos++;
     }
 
+    /* with the write cache enabled the data is written back on
+       FLUSH CACHE, when the cache is disabled or on detach */
     if (!drv->wcache) {
-        if (fflush(drv->file)) {
+        if (blockcache_flush(drv->cache)) {
             ata_set_command_block(drv);
             drv->error = drv->atapi ? 0x54 : (ATA_UNC | ATA_ABRT);
             drv->cmd = 0x00;
@@ -542,6 +542,8 @@ ata_drive_t *ata_init(int drive)
     drv->myname = lib_msprintf("ATA%d", drive);
     drv->log = log_open(drv->myname);
     drv->file = NULL;
+    drv->cache = NULL;
+    drv->file_pos = 0;
     drv->filename = NULL;
     drv->buffer = lib_malloc(2048);
     drv->slave = drive & 1;
@@ -561,6 +563,7 @@ ata_drive_t *ata_init(int drive)
 
 void ata_shutdown(ata_drive_t *drv)
 {
+    ata_image_detach(drv); /* write back cached sectors */
     if (drv->filename) {
         lib_free(drv->filename);
         drv->filename = NULL;
@@ -731,7 +734,7 @@ static void ata_execute_command(ata_drive_t *drv, BYTE value)
             }
             debug((drv->log, "FLUSH CACHE"));
             if (drv->file) {
-                if (fflush(drv->file)) {
+                if (blockcache_flush(drv->cache)) {
                     drv->error = drv->atapi ? 0x54 : (ATA_UNC | ATA_ABRT);
                 }
             }
@@ -836,7 +839,7 @@ static void ata_execute_command(ata_drive_t *drv, BYTE value)
                     debug((drv->log, "SET DISABLE WRITE CACHE"));
                     drv->wcache = 0;
                     if (drv->file) {
-                        fflush(drv->file);
+                        blockcache_flush(drv->cache);
                     }
                     return;
                 case 0x99:
@@ -1198,7 +1201,7 @@ void ata_register_store(ata_drive_t *drv, WORD addr, WORD value)
                                     drv->bufp = 0;
                                     return;
                                 }
-                                if (!drv->file || fflush(drv->file)) {
+                                if (!drv->file) {
                                     drv->error = drv->atapi ? 0x54 : (ATA_UNC | ATA_ABRT);
                                     break;
                                 }
@@ -1262,7 +1265,11 @@ void ata_register_store(ata_drive_t *drv, WORD addr, WORD value)
 
 void ata_image_attach(ata_drive_t *drv, char *filename, ata_drive_type_t type, ata_drive_geometry_t geometry)
 {
+    int readonly = 0;
+
     if (drv->file != NULL) {
+        blockcache_close(drv->cache);
+        drv->cache = NULL;
         fclose(drv->file);
         drv->file = NULL;
     }
@@ -1279,6 +1286,11 @@ void ata_image_attach(ata_drive_t *drv, char *filename, ata_drive_type_t type, a
             }
             if (!drv->file) {
                 drv->file = fopen(drv->filename, MODE_READ);
+                readonly = 1;
+            }
+            if (drv->file) {
+                drv->cache = blockcache_open(drv->file, readonly);
+                drv->file_pos = 0;
             }
         }
 
@@ -1323,6 +1335,10 @@ void ata_image_attach(ata_drive_t *drv, char *filename, ata_drive_type_t type, a
 void ata_image_detach(ata_drive_t *drv)
 {
     if (drv->file != NULL) {
+        if (blockcache_close(drv->cache)) {
+            log_error(drv->log, "Cannot write back cached sectors.");
+        }
+        drv->cache = NULL;
         fclose(drv->file);
         drv->file = NULL;
         log_message(drv->log, "Detached.");
@@ -1392,10 +1408,7 @@ int ata_snapshot_write_module(ata_drive_t *drv, snapshot_t *s)
         standby_clk = drv->standby_alarm->context->pending_alarms[drv->standby_alarm->pending_idx].clk;
     }
     if (drv->file) {
-        pos = ftello(drv->file);
-        if (pos < 0) {
-            pos = 0;
-        }
+        pos = drv->file_pos;
     }
 
     SMW_STR(m, drv->filename);
@@ -1555,7 +1568,7 @@ int ata_snapshot_read_module(ata_drive_t *drv, snapshot_t *s)
     }
 
     if (drv->file) {
-        fseeko(drv->file, (off_t)pos * drv->sector_size, SEEK_SET);
+        drv->file_pos = (off_t)pos * drv->sector_size;
     }
     if (!drv->atapi) { /* atapi supports disc change events */
         drv->readonly = 1; /* make sure for ata that there's no filesystem corruption */
@@ -0,0 +1,306 @@
+/*
+ * blockcache.c - Cached block access to disk images.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/*
+ * The image is cached in lines of BLOCKCACHE_LINE_SIZE bytes, so a miss
+ * reads many sectors with one fread().  When a miss hits the line right
+ * after the previous miss, the access is treated as sequential and the
+ * following line is read as well.  Writes only go to the cache and mark
+ * the touched sectors dirty; dirty sectors are written back in runs when
+ * their line is evicted, on blockcache_flush() and on blockcache_close().
+ */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "blockcache.h"
+#include "lib.h"
+#include "types.h"
+
+#ifndef HAVE_FSEEKO
+#define fseeko(a, b, c) fseek(a, b, c)
+#define ftello(a) ftell(a)
+#endif
+
+#define BLOCKCACHE_SECTOR_SIZE  512
+#define BLOCKCACHE_LINE_SECTORS 32
+#define BLOCKCACHE_LINE_SIZE    (BLOCKCACHE_SECTOR_SIZE * BLOCKCACHE_LINE_SECTORS)
+#define BLOCKCACHE_LINES        32
+
+typedef struct blockcache_line_s {
+    off_t base;             /* offset of the first byte, -1 if unused */
+    DWORD dirty;            /* one bit per sector */
+    unsigned long last_use;
+    BYTE data[BLOCKCACHE_LINE_SIZE];
+} blockcache_line_t;
+
+struct blockcache_s {
+    FILE *file;
+    int readonly;
+    off_t size;             /* current size of the image */
+    unsigned long use_count;
+    off_t last_miss;
+    blockcache_line_t *hit; /* line of the last access */
+    blockcache_line_t line[BLOCKCACHE_LINES];
+};
+
+blockcache_t *blockcache_open(FILE *file, int readonly)
+{
+    blockcache_t *bc;
+    int i;
+
+    bc = lib_malloc(sizeof(blockcache_t));
+    bc->file = file;
+    bc->readonly = readonly;
+    bc->use_count = 0;
+    bc->last_miss = -1;
+    bc->hit = NULL;
+    for (i = 0; i < BLOCKCACHE_LINES; i++) {
+        bc->line[i].base = -1;
+        bc->line[i].dirty = 0;
+        bc->line[i].last_use = 0;
+    }
+
+    if (fseeko(file, 0, SEEK_END) == 0) {
+        bc->size = ftello(file);
+    } else {
+        bc->size = 0;
+    }
+    if (bc->size < 0) {
+        bc->size = 0;
+    }
+
+    return bc;
+}
+
+/* Write back the dirty sectors of a line, merging neighbours into one
+   write.  Nothing past the current end of the image is written.  */
+static int blockcache_line_flush(blockcache_t *bc, blockcache_line_t *line)
+{
+    int start, end;
+    off_t from, to;
+
+    start = 0;
+    while (line->dirty) {
+        while (!(line->dirty & ((DWORD)1 << start))) {
+            start++;
+        }
+        end = start;
+        while (end < BLOCKCACHE_LINE_SECTORS && (line->dirty & ((DWORD)1 << end))) {
+            line->dirty &= ~((DWORD)1 << end);
+            end++;
+        }
+
+        from = line->base + start * BLOCKCACHE_SECTOR_SIZE;
+        to = line->base + end * BLOCKCACHE_SECTOR_SIZE;
+        if (to > bc->size) {
+            to = bc->size;
+        }
+        if (from < to) {
+            if (fseeko(bc->file, from, SEEK_SET)
+                || fwrite(line->data + start * BLOCKCACHE_SECTOR_SIZE, 1, (size_t)(to - from), bc->file) != (size_t)(to - from)) {
+                line->dirty = 0;
+                return -1;
+            }
+        }
+        start = end;
+    }
+    return 0;
+}
+
+/* Fill an unused or least recently used line with the data at `base'.  */
+static blockcache_line_t *blockcache_line_load(blockcache_t *bc, off_t base)
+{
+    blockcache_line_t *line = &bc->line[0];
+    size_t n = 0;
+    int i;
+
+    for (i = 1; i < BLOCKCACHE_LINES; i++) {
+        if (bc->line[i].last_use < line->last_use) {
+            line = &bc->line[i];
+        }
+    }
+
+    if (line->base >= 0 && blockcache_line_flush(bc, line) < 0) {
+        return NULL;
+    }
+
+    line->base = -1;
+    line->dirty = 0;
+    line->last_use = ++bc->use_count;
+
+    if (base < bc->size) {
+        clearerr(bc->file);
+        if (fseeko(bc->file, base, SEEK_SET)) {
+            return NULL;
+        }
+        n = fread(line->data, 1, BLOCKCACHE_LINE_SIZE, bc->file);
+        if (ferror(bc->file)) {
+            return NULL;
+        }
+    }
+    memset(line->data + n, 0, BLOCKCACHE_LINE_SIZE - n);
+    line->base = base;
+
+    return line;
+}
+
+static blockcache_line_t *blockcache_line_get(blockcache_t *bc, off_t base)
+{
+    blockcache_line_t *line;
+    int i;
+
+    if (bc->hit && bc->hit->base == base) {
+        bc->hit->last_use = ++bc->use_count;
+        return bc->hit;
+    }
+
+    for (i = 0; i < BLOCKCACHE_LINES; i++) {
+        if (bc->line[i].base == base) {
+            bc->hit = &bc->line[i];
+            bc->hit->last_use = ++bc->use_count;
+            return bc->hit;
+        }
+    }
+
+    line = blockcache_line_load(bc, base);
+    if (line == NULL) {
+        return NULL;
+    }
+
+    /* read ahead on sequential access */
+    if (bc->last_miss >= 0 && base == bc->last_miss + BLOCKCACHE_LINE_SIZE
+        && base + BLOCKCACHE_LINE_SIZE < bc->size) {
+        off_t next = base + BLOCKCACHE_LINE_SIZE;
+
+        for (i = 0; i < BLOCKCACHE_LINES; i++) {
+            if (bc->line[i].base == next) {
+                break;
+            }
+        }
+        if (i == BLOCKCACHE_LINES) {
+            blockcache_line_load(bc, next);
+            line->last_use = ++bc->use_count;
+        }
+    }
+    bc->last_miss = base;
+    bc->hit = line;
+
+    return line;
+}
+
+int blockcache_read(blockcache_t *bc, off_t offset, BYTE *buf, unsigned int len)
+{
+    blockcache_line_t *line;
+    unsigned int pos, n;
+    int inside;
+
+    if (offset >= bc->size) {
+        inside = 0;
+    } else if (offset + (off_t)len > bc->size) {
+        inside = (int)(bc->size - offset);
+    } else {
+        inside = (int)len;
+    }
+
+    while (len) {
+        pos = (unsigned int)(offset % BLOCKCACHE_LINE_SIZE);
+        n = BLOCKCACHE_LINE_SIZE - pos;
+        if (n > len) {
+            n = len;
+        }
+        line = blockcache_line_get(bc, offset - pos);
+        if (line == NULL) {
+            return -1;
+        }
+        memcpy(buf, line->data + pos, n);
+        buf += n;
+        offset += n;
+        len -= n;
+    }
+
+    return inside;
+}
+
+int blockcache_write(blockcache_t *bc, off_t offset, const BYTE *buf, unsigned int len)
+{
+    blockcache_line_t *line;
+    unsigned int pos, n, s;
+
+    if (bc->readonly) {
+        return -1;
+    }
+
+    while (len) {
+        pos = (unsigned int)(offset % BLOCKCACHE_LINE_SIZE);
+        n = BLOCKCACHE_LINE_SIZE - pos;
+        if (n > len) {
+            n = len;
+        }
+        line = blockcache_line_get(bc, offset - pos);
+        if (line == NULL) {
+            return -1;
+        }
+        memcpy(line->data + pos, buf, n);
+        for (s = pos / BLOCKCACHE_SECTOR_SIZE; s <= (pos + n - 1) / BLOCKCACHE_SECTOR_SIZE; s++) {
+            line->dirty |= (DWORD)1 << s;
+        }
+        buf += n;
+        offset += n;
+        len -= n;
+        if (offset > bc->size) {
+            bc->size = offset;
+        }
+    }
+
+    return 0;
+}
+
+int blockcache_flush(blockcache_t *bc)
+{
+    int i, ret = 0;
+
+    for (i = 0; i < BLOCKCACHE_LINES; i++) {
+        if (bc->line[i].dirty && blockcache_line_flush(bc, &bc->line[i]) < 0) {
+            ret = -1;
+        }
+    }
+    if (fflush(bc->file)) {
+        ret = -1;
+    }
+    return ret;
+}
+
+int blockcache_close(blockcache_t *bc)
+{
+    int ret;
+
+    if (bc == NULL) {
+        return 0;
+    }
+    ret = blockcache_flush(bc);
+    lib_free(bc);
+    return ret;
+}
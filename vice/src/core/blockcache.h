@@ -0,0 +1,65 @@
+/*
+ * blockcache.h - Cached block access to disk images.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_BLOCKCACHE_H
+#define VICE_BLOCKCACHE_H
+
+/* required for off_t on some platforms */
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+/* VAC++ has off_t in sys/stat.h */
+#ifdef __IBMC__
+#include <sys/stat.h>
+#endif
+
+#include <stdio.h>
+
+#include "types.h"
+
+typedef struct blockcache_s blockcache_t;
+
+/* Create a cache for an already opened image file.  The file stays owned
+   by the caller and must not be accessed directly while the cache exists.
+   Writes fail if `readonly' is set.  */
+extern blockcache_t *blockcache_open(FILE *file, int readonly);
+
+/* Write back all modified data and free the cache.  Returns 0 on success. */
+extern int blockcache_close(blockcache_t *bc);
+
+/* Read `len' bytes at `offset'.  Data beyond the end of the image reads as
+   zero.  Returns the number of bytes that were inside the image, or -1 on
+   a read error.  */
+extern int blockcache_read(blockcache_t *bc, off_t offset, BYTE *buf, unsigned int len);
+
+/* Write `len' bytes at `offset'.  The data is written back to the file
+   later, by blockcache_flush(), on eviction or when the cache is closed.
+   Returns 0 on success, -1 if the image is read only or on a read error
+   filling the cache.  */
+extern int blockcache_write(blockcache_t *bc, off_t offset, const BYTE *buf, unsigned int len);
+
+/* Write back all modified data.  Returns 0 on success, -1 on error.  */
+extern int blockcache_flush(blockcache_t *bc);
+
+#endif
@@ -32,6 +32,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "blockcache.h"
 #include "log.h"
 #include "snapshot.h"
 #include "spi-sdcard.h"
@@ -95,10 +96,14 @@ static int mmc_card_rw = 0;
 
 /* Image file */
 static FILE *mmc_image_file = NULL;
+static blockcache_t *mmc_image_cache = NULL;
 
 /* Pointer inside image */
 static sd_addr_t mmc_image_pointer;
 
+/* Start address of the block being written */
+static sd_addr_t mmc_write_address;
+
 /* write sequence counter */
 static unsigned int mmc_write_sequence;
 
@@ -634,29 +639,20 @@ static void mmc_execute_cmd(void)
 #endif
                     mmc_card_state = MMC_CARD_DUMMY_READ;
                 } else {
+                    BYTE readbuf[0x1000];    /* FIXME */
 #ifdef DEBUG_MMC
                     log_debug("Address: %08x", mmc_current_address_pointer);
+                    log_debug("Buffering: %08x", mmc_current_address_pointer);
 #endif
-                    if (fseek(mmc_image_file, mmc_current_address_pointer, SEEK_SET) != 0) {
-                        mmc_card_state = MMC_CARD_DUMMY_READ;
-                    } else {
-                        BYTE readbuf[0x1000];    /* FIXME */
-#ifdef DEBUG_MMC
-                        log_debug("Buffering: %08x", mmc_current_address_pointer);
-#endif
-                        fseek(mmc_image_file, mmc_current_address_pointer, SEEK_SET);
-                        if (!feof(mmc_image_file)) {
-                            if (fread(readbuf, 1, mmc_block_size, mmc_image_file) > 0) {
-                                mmc_read_buffer_readptr = 0;
-                                mmc_read_buffer_writeptr = 0;
-                                mmc_read_buffer_set(readbuf, mmc_block_size);
+                    if (blockcache_read(mmc_image_cache, (off_t)mmc_current_address_pointer, readbuf, mmc_block_size) > 0) {
+                        mmc_read_buffer_readptr = 0;
+                        mmc_read_buffer_writeptr = 0;
+                        mmc_read_buffer_set(readbuf, mmc_block_size);
 #ifdef DEBUG_MMC
-                                log_debug("Buffered: %02x %02x", readbuf[0], readbuf[1]);
+                        log_debug("Buffered: %02x %02x", readbuf[0], readbuf[1]);
 #endif
-                            } else {
-                                /* FIXME: handle error */
-                            }
-                        }
+                    } else {
+                        mmc_card_state = MMC_CARD_DUMMY_READ;
                     }
                 }
             } else {
@@ -680,6 +676,7 @@ static void mmc_execute_cmd(void)
 #endif
                 } else {
                     mmc_write_sequence = 0;
+                    mmc_write_address = mmc_current_address_pointer;
                     mmc_card_state = MMC_CARD_WRITE;
                 }
             } else {
@@ -801,7 +798,7 @@ static void mmc_write_to_mmc(BYTE value)
             break;
         case 1:
             if (mmc_card_state == MMC_CARD_WRITE) {
-                if (fwrite(&value, 1, 1, mmc_image_file) != 1) {
+                if (blockcache_write(mmc_image_cache, (off_t)(mmc_write_address + mmc_image_pointer), &value, 1) < 0) {
                     LOG(("could not write to mmc image file"));
                     /* FIXME: handle error */
                 }
@@ -859,6 +856,7 @@ int mmc_open_card_image(char *name, int rw)
             LOG(("could not open sd card image: %s", mmc_image_filename));
             return 1;
         } else {
+            mmc_image_cache = blockcache_open(mmc_image_file, 1);
             /* FIXME */
             spi_mmc_set_card_inserted(MMC_CARD_INSERTED);
             LOG(("opened sd card image (ro): %s", mmc_image_filename));
@@ -867,6 +865,7 @@ int mmc_open_card_image(char *name, int rw)
             /* mmcreplay_writeprotect = MMC_WRITEPROT; */
         }
     } else {
+        mmc_image_cache = blockcache_open(mmc_image_file, 0);
         /* mmc_image_file_readonly = 0; */
         spi_mmc_set_card_inserted(MMC_CARD_INSERTED);
         LOG(("opened sd card image (rw): %s", mmc_image_filename));
@@ -879,6 +878,10 @@ void mmc_close_card_image(void)
 {
     /* unmount mmc cart image */
     if (mmc_image_file != NULL) {
+        if (blockcache_close(mmc_image_cache)) {
+            LOG(("could not write back cached sd card sectors"));
+        }
+        mmc_image_cache = NULL;
         fclose(mmc_image_file);
         mmc_image_file = NULL;
         spi_mmc_set_card_inserted(MMC_CARD_NOTINSERTED);
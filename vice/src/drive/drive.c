@@ -57,6 +57,7 @@
 #include "driverom.h"
 #include "drivetypes.h"
 #include "gcr.h"
+#include "hosttimer.h"
 #include "iecbus.h"
 #include "iecdrive.h"
 #include "lib.h"
@@ -802,12 +803,16 @@ void drive_cpu_execute_all(CLOCK clk_value)
     unsigned int dnr;
     drive_t *drive;
 
+    HOSTTIMER_ENTER(HOSTTIMER_DRIVE);
+
     for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
         drive = drive_context[dnr]->drive;
         if (drive->enable) {
             drive_cpu_execute_one(drive_context[dnr], clk_value);
         }
     }
+
+    HOSTTIMER_LEAVE();
 }
 
 void drive_cpu_set_overflow(drive_context_t *drv)
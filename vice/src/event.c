@@ -40,6 +40,8 @@
 #include "crc32.h"
 #include "datasette.h"
 #include "debug.h"
+#include "drive.h"
+#include "drivetypes.h"
 #include "interrupt.h"
 #include "joystick.h"
 #include "keyboard.h"
@@ -47,6 +49,9 @@
 #include "log.h"
 #include "machine.h"
 #include "maincpu.h"
+#include "mem.h"
+#include "mon_register.h"
+#include "monitor.h"
 #include "network.h"
 #include "resources.h"
 #include "snapshot.h"
@@ -94,6 +99,20 @@ static char *event_end_snapshot = NULL;
 static char *event_snapshot_path_str = NULL;
 static int event_start_mode;
 static int event_image_include;
+static int event_state_hash;
+
+/* State hashes: while recording, a hash of the machine state is added to
+   the event list once per frame; playback compares against them.  */
+#define EVENT_HASH_MODULES_MAX  64
+#define EVENT_HASH_NAME_LEN     32
+
+static alarm_t *event_hash_alarm = NULL;
+static unsigned int hash_record_active = 0;
+static CLOCK next_hash_clk;
+static DWORD hash_frame;
+static unsigned int hash_frames_checked;
+static int hash_diverged;
+static char hash_module_names[EVENT_HASH_MODULES_MAX][EVENT_HASH_NAME_LEN];
 
 static char *event_snapshot_path(const char *snapshot_file)
 {
@@ -281,6 +300,191 @@ error:
 }
 
 
+/*-----------------------------------------------------------------------*/
+/* machine state hashes                                                  */
+
+#define EVENT_HASH_INIT 2166136261U
+
+/* FNV-1a, cheap enough to run every frame */
+static DWORD event_hash_byte(DWORD hash, BYTE value)
+{
+    return (hash ^ value) * 16777619U;
+}
+
+static DWORD event_hash_dword(DWORD hash, DWORD value)
+{
+    hash = event_hash_byte(hash, (BYTE)(value & 0xff));
+    hash = event_hash_byte(hash, (BYTE)((value >> 8) & 0xff));
+    hash = event_hash_byte(hash, (BYTE)((value >> 16) & 0xff));
+    return event_hash_byte(hash, (BYTE)((value >> 24) & 0xff));
+}
+
+static DWORD event_hash_regs(DWORD hash, int mem)
+{
+    mon_reg_list_t *regs, *p;
+
+    regs = mon_register_list_get(mem);
+    for (p = regs; p->name != NULL; p++) {
+        hash = event_hash_dword(hash, (DWORD)p->val);
+    }
+    lib_free(regs);
+
+    return hash;
+}
+
+static DWORD event_hash_bank(DWORD hash, monitor_interface_t *mi, int bank,
+                             unsigned int start, unsigned int end)
+{
+    unsigned int addr;
+
+    for (addr = start; addr <= end; addr++) {
+        hash = event_hash_byte(hash, mi->mem_bank_peek(bank, (WORD)addr, mi->context));
+    }
+
+    return hash;
+}
+
+static unsigned int event_hash_add(DWORD *hashes, unsigned int n, const char *name, DWORD hash)
+{
+    if (n < EVENT_HASH_MODULES_MAX) {
+        strncpy(hash_module_names[n], name, EVENT_HASH_NAME_LEN - 1);
+        hash_module_names[n][EVENT_HASH_NAME_LEN - 1] = 0;
+        hashes[n++] = hash;
+    }
+    return n;
+}
+
+/* Hash CPU registers, RAM, the I/O chips and the RAM of the active drives,
+   one hash per module.  Returns the number of hashes.  */
+static unsigned int event_hash_state(DWORD *hashes)
+{
+    monitor_interface_t *mi = maincpu_monitor_interface_get();
+    mem_ioreg_list_t *ioregs;
+    drive_t *drive;
+    unsigned int n = 0, i, dnr;
+    int bank;
+    char name[EVENT_HASH_NAME_LEN];
+
+    n = event_hash_add(hashes, n, "CPU", event_hash_regs(EVENT_HASH_INIT, e_comp_space));
+
+    bank = mi->mem_bank_from_name("ram");
+    n = event_hash_add(hashes, n, "RAM",
+                       event_hash_bank(EVENT_HASH_INIT, mi, bank < 0 ? 0 : bank, 0, 0xffff));
+
+    if (mi->mem_ioreg_list_get != NULL) {
+        ioregs = mi->mem_ioreg_list_get(mi->context);
+        bank = mi->mem_bank_from_name("io");
+        for (i = 0; ioregs != NULL; i++) {
+            n = event_hash_add(hashes, n, ioregs[i].name,
+                               event_hash_bank(EVENT_HASH_INIT, mi, bank < 0 ? 0 : bank,
+                                               ioregs[i].start, ioregs[i].end));
+            if (ioregs[i].next == 0) {
+                break;
+            }
+        }
+        lib_free(ioregs);
+    }
+
+    for (dnr = 0; dnr < DRIVE_NUM; dnr++) {
+        DWORD hash;
+
+        if (drive_context[dnr] == NULL) {
+            continue;
+        }
+        drive = drive_context[dnr]->drive;
+        if (drive == NULL || !drive->enable) {
+            continue;
+        }
+        hash = event_hash_regs(EVENT_HASH_INIT, monitor_diskspace_mem(dnr));
+        for (i = 0; i < DRIVE_RAM_SIZE; i++) {
+            hash = event_hash_byte(hash, drive->drive_ram[i]);
+        }
+        sprintf(name, "Drive %u", dnr + 8);
+        n = event_hash_add(hashes, n, name, hash);
+    }
+
+    return n;
+}
+
+static void event_hash_alarm_handler(CLOCK offset, void *data)
+{
+    DWORD buf[EVENT_HASH_MODULES_MAX + 2];
+    unsigned int n;
+
+    alarm_unset(event_hash_alarm);
+
+    if (!record_active || !hash_record_active) {
+        return;
+    }
+
+    n = event_hash_state(&buf[2]);
+    buf[0] = hash_frame++;
+    buf[1] = (DWORD)n;
+    event_record(EVENT_STATE_HASH, (void *)buf, (n + 2) * sizeof(DWORD));
+
+    next_hash_clk += machine_get_cycles_per_frame();
+    alarm_set(event_hash_alarm, next_hash_clk);
+}
+
+static void event_hash_record_start(void)
+{
+    event_list_t *curr;
+
+    hash_record_active = event_state_hash;
+    if (!hash_record_active) {
+        return;
+    }
+
+    /* continue the frame numbering of an appended history */
+    hash_frame = 0;
+    for (curr = event_list->base; curr != NULL && curr->type != EVENT_LIST_END; curr = curr->next) {
+        if (curr->type == EVENT_STATE_HASH) {
+            hash_frame++;
+        }
+    }
+
+    next_hash_clk = maincpu_clk + machine_get_cycles_per_frame();
+    alarm_set(event_hash_alarm, next_hash_clk);
+}
+
+static void event_hash_check(void *data, unsigned int size)
+{
+    DWORD hashes[EVENT_HASH_MODULES_MAX];
+    DWORD *recorded = (DWORD *)data;
+    unsigned int n, i;
+    char *msg = NULL;
+
+    hash_frames_checked++;
+
+    if (hash_diverged || size < 2 * sizeof(DWORD)) {
+        return;
+    }
+
+    n = event_hash_state(hashes);
+
+    if (recorded[1] != n || size != (n + 2) * sizeof(DWORD)) {
+        msg = lib_msprintf("Playback diverged at frame %u: machine configuration differs from recording.",
+                           (unsigned int)recorded[0]);
+    } else {
+        for (i = 0; i < n; i++) {
+            if (recorded[i + 2] != hashes[i]) {
+                msg = lib_msprintf("Playback diverged at frame %u in %s.",
+                                   (unsigned int)recorded[0], hash_module_names[i]);
+                break;
+            }
+        }
+    }
+
+    if (msg != NULL) {
+        hash_diverged = 1;
+        log_error(event_log, "%s", msg);
+        ui_display_statustext(msg, 0);
+        lib_free(msg);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+
 void event_record_in_list(event_list_state_t *list, unsigned int type,
                           void *data, unsigned int size)
 {
@@ -291,6 +495,7 @@ void event_record_in_list(event_list_state_t *list, unsigned int type,
     switch (type) {
         case EVENT_RESETCPU:
             next_timestamp_clk -= maincpu_clk;
+            next_hash_clk -= maincpu_clk;
         case EVENT_KEYBOARD_MATRIX:
         case EVENT_KEYBOARD_RESTORE:
         case EVENT_KEYBOARD_DELAY:
@@ -302,6 +507,7 @@ void event_record_in_list(event_list_state_t *list, unsigned int type,
         case EVENT_INITIAL:
         case EVENT_SYNC_TEST:
         case EVENT_RESOURCE:
+        case EVENT_STATE_HASH:
             event_data = lib_malloc(size);
             memcpy(event_data, data, size);
             break;
@@ -405,6 +611,10 @@ static void event_alarm_handler(CLOCK offset, void *data)
         case EVENT_TIMESTAMP:
             ui_display_event_time(current_timestamp++, playback_time);
             break;
+        case EVENT_STATE_HASH:
+            event_hash_check(event_list->current->data,
+                             event_list->current->size);
+            break;
         case EVENT_LIST_END:
             event_playback_stop();
             break;
@@ -429,6 +639,7 @@ void event_playback_event_list(event_list_state_t *list)
     while (current->type != EVENT_LIST_END) {
         switch (current->type) {
             case EVENT_SYNC_TEST:
+            case EVENT_STATE_HASH:
                 break;
             case EVENT_KEYBOARD_DELAY:
                 keyboard_register_delay(*(unsigned int*)current->data);
@@ -694,6 +905,8 @@ static void event_record_start_trap(WORD addr, void *data)
     /* use alarm for timestamps */
     milestone_timestamp_alarm = 0;
     alarm_set(event_alarm, next_timestamp_clk);
+
+    event_hash_record_start();
 }
 
 int event_record_start(void)
@@ -726,6 +939,7 @@ static void event_record_stop_trap(WORD addr, void *data)
         return;
     }
     record_active = 0;
+    hash_record_active = 0;
 
 #ifdef  DEBUG
     debug_stop_recording();
@@ -745,6 +959,7 @@ int event_record_stop(void)
     ui_display_recording(0);
 
     alarm_unset(event_alarm);
+    alarm_unset(event_hash_alarm);
 
     return 0;
 }
@@ -772,6 +987,9 @@ void event_reset_ack(void)
     /* timestamp alarm needs to be set */
     if (record_active) {
         alarm_set(event_alarm, next_timestamp_clk);
+        if (hash_record_active) {
+            alarm_set(event_hash_alarm, next_hash_clk);
+        }
     }
 }
 
@@ -853,6 +1071,8 @@ static void event_playback_start_trap(WORD addr, void *data)
 
     playback_active = 1;
     current_timestamp = 0;
+    hash_frames_checked = 0;
+    hash_diverged = 0;
 
     ui_display_playback(1, event_version);
 
@@ -883,6 +1103,11 @@ int event_playback_stop(void)
 
     alarm_unset(event_alarm);
 
+    if (hash_frames_checked > 0 && !hash_diverged) {
+        log_message(event_log, "Playback matched the recorded state in all %u checked frames.",
+                    hash_frames_checked);
+    }
+
     ui_display_playback(0, NULL);
 
 #ifdef  DEBUG
@@ -936,6 +1161,7 @@ static void event_record_reset_milestone_trap(WORD addr, void *data)
         next_timestamp_clk = milestone_timestamp_alarm;
         current_timestamp = milestone_timestamp;
     }
+    event_hash_record_start();
 #ifdef  DEBUG
     debug_reset_milestone();
 #endif
@@ -1189,6 +1415,13 @@ static int set_event_image_include(int enable, void *param)
     return 0;
 }
 
+static int set_event_state_hash(int enable, void *param)
+{
+    event_state_hash = enable ? 1 : 0;
+
+    return 0;
+}
+
 static const resource_string_t resources_string[] = {
     { "EventSnapshotDir",
       FSDEVICE_DEFAULT_DIR FSDEV_DIR_SEP_STR, RES_EVENT_NO, NULL,
@@ -1205,6 +1438,8 @@ static const resource_int_t resources_int[] = {
       &event_start_mode, set_event_start_mode, NULL },
     { "EventImageInclude", 1, RES_EVENT_NO, NULL,
       &event_image_include, set_event_image_include, NULL },
+    { "EventStateHash", 0, RES_EVENT_NO, NULL,
+      &event_state_hash, set_event_state_hash, NULL },
     { NULL }
 };
 
@@ -1270,6 +1505,16 @@ static const cmdline_option_t cmdline_options[] = {
       USE_PARAM_STRING, USE_DESCRIPTION_ID,
       IDCLS_UNUSED, IDCLS_DISABLE_EVENT_IMAGE_INCLUDE,
       NULL, NULL },
+    { "-eventstatehash", SET_RESOURCE, 0,
+      NULL, NULL, "EventStateHash", (resource_value_t)1,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_ENABLE_EVENT_STATE_HASH,
+      NULL, NULL },
+    { "+eventstatehash", SET_RESOURCE, 0,
+      NULL, NULL, "EventStateHash", (resource_value_t)0,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_DISABLE_EVENT_STATE_HASH,
+      NULL, NULL },
     { NULL }
 };
 
@@ -1289,6 +1534,10 @@ static void clk_overflow_callback(CLOCK sub, void *data)
     if (next_timestamp_clk) {
         next_timestamp_clk -= sub;
     }
+
+    if (hash_record_active) {
+        next_hash_clk -= sub;
+    }
 }
 
 
@@ -1298,6 +1547,8 @@ void event_init(void)
 
     event_alarm = alarm_new(maincpu_alarm_context, "Event",
                             event_alarm_handler, NULL);
+    event_hash_alarm = alarm_new(maincpu_alarm_context, "EventStateHash",
+                                 event_hash_alarm_handler, NULL);
 
     clk_guard_add_callback(maincpu_clk_guard, clk_overflow_callback, NULL);
 }
@@ -31,6 +31,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "archdep.h"
 #include "cmdline.h"
 #include "ffmpegdrv.h"
@@ -155,6 +159,36 @@ static int audio_codec;
 static int video_codec;
 static int video_halve_framerate;
 
+/* encoder queue */
+#define FFMPEGDRV_JOB_VIDEO     0
+#define FFMPEGDRV_JOB_AUDIO     1
+
+#define FFMPEGDRV_QUEUE_SIZE    32
+
+typedef struct ffmpegdrv_job_s {
+    int type;
+    int64_t pts;
+    /* video: video_width * video_height palette indices,
+       audio: one buffer of samples as handed over by soundmovie */
+    BYTE *data;
+    /* video: RGB triplets of the palette */
+    BYTE rgb[256 * 3];
+} ffmpegdrv_job_t;
+
+#ifdef HAVE_PTHREAD
+static pthread_t worker_thread;
+static pthread_mutex_t queue_lock;
+static pthread_cond_t queue_job_cond;
+static pthread_cond_t queue_space_cond;
+static ffmpegdrv_job_t queue[FFMPEGDRV_QUEUE_SIZE];
+static int queue_head;
+static int queue_count;
+static int queue_stop;
+static volatile int worker_error;
+#endif
+static int worker_running;
+static unsigned int frames_dropped;
+
 static int ffmpegdrv_init_file(void);
 
 static int set_container_format(const char *val, void *param)
@@ -504,8 +538,9 @@ static int ffmpegmovie_init_audio(int speed, int channels, soundmovie_buffer_t *
     return 0;
 }
 
-/* triggered by soundffmpegaudio->write */
-static int ffmpegmovie_encode_audio(soundmovie_buffer_t *audio_in)
+/* convert and encode one buffer of samples, runs on the encoder thread
+   if there is one */
+static int ffmpegdrv_encode_audio_frame(const SWORD *samples, int64_t pts)
 {
     int got_packet;
     int dst_nb_samples;
@@ -518,59 +553,98 @@ static int ffmpegmovie_encode_audio(soundmovie_buffer_t *audio_in)
     AVRational tmp;
 #endif
 
-    if (audio_st.st) {
-        audio_st.frame->pts = audio_st.next_pts;
-        audio_st.next_pts += audio_in->size;
+    audio_st.frame->pts = pts;
 
-        VICE_P_AV_INIT_PACKET(&pkt);
-        c = audio_st.st->codec;
+    VICE_P_AV_INIT_PACKET(&pkt);
+    c = audio_st.st->codec;
 
-        frame = audio_st.tmp_frame;
+    frame = audio_st.tmp_frame;
 
-        if (frame) {
-            /* convert samples from native format to destination codec format, using the resampler */
-            /* compute destination number of samples */
+    if (frame) {
+        if (samples != (SWORD *)frame->data[0]) {
+            memcpy(frame->data[0], samples, ffmpegdrv_audio_in.size * sizeof(SWORD));
+        }
+
+        /* convert samples from native format to destination codec format, using the resampler */
+        /* compute destination number of samples */
 #ifndef HAVE_FFMPEG_AVRESAMPLE
-            dst_nb_samples = (int)VICE_P_AV_RESCALE_RND(VICE_P_SWR_GET_DELAY(swr_ctx, c->sample_rate) + frame->nb_samples, c->sample_rate, c->sample_rate, AV_ROUND_UP);
+        dst_nb_samples = (int)VICE_P_AV_RESCALE_RND(VICE_P_SWR_GET_DELAY(swr_ctx, c->sample_rate) + frame->nb_samples, c->sample_rate, c->sample_rate, AV_ROUND_UP);
 #else
-            dst_nb_samples = (int)VICE_P_AV_RESCALE_RND(VICE_P_AVRESAMPLE_GET_DELAY(avr_ctx, c->sample_rate) + frame->nb_samples, c->sample_rate, c->sample_rate, AV_ROUND_UP);
+        dst_nb_samples = (int)VICE_P_AV_RESCALE_RND(VICE_P_AVRESAMPLE_GET_DELAY(avr_ctx, c->sample_rate) + frame->nb_samples, c->sample_rate, c->sample_rate, AV_ROUND_UP);
 #endif
 
-            /* when we pass a frame to the encoder, it may keep a reference to it
-            * internally;
-            * make sure we do not overwrite it here
-            */
-            ret = VICE_P_AV_FRAME_MAKE_WRITABLE(audio_st.frame);
-            if (ret < 0)
-                return -1;
+        /* when we pass a frame to the encoder, it may keep a reference to it
+        * internally;
+        * make sure we do not overwrite it here
+        */
+        ret = VICE_P_AV_FRAME_MAKE_WRITABLE(audio_st.frame);
+        if (ret < 0)
+            return -1;
 
-            /* convert to destination format */
+        /* convert to destination format */
 #ifndef HAVE_FFMPEG_AVRESAMPLE
-            ret = VICE_P_SWR_CONVERT(swr_ctx, audio_st.frame->data, dst_nb_samples, (const uint8_t **)frame->data, frame->nb_samples);
+        ret = VICE_P_SWR_CONVERT(swr_ctx, audio_st.frame->data, dst_nb_samples, (const uint8_t **)frame->data, frame->nb_samples);
 #else
-            ret = VICE_P_AVRESAMPLE_CONVERT(avr_ctx, audio_st.frame->data, 0, dst_nb_samples, (const uint8_t **)frame->data, 0, frame->nb_samples);
+        ret = VICE_P_AVRESAMPLE_CONVERT(avr_ctx, audio_st.frame->data, 0, dst_nb_samples, (const uint8_t **)frame->data, 0, frame->nb_samples);
 #endif
-            if (ret < 0) {
-                log_debug("ffmpegdrv_encode_audio: Error while converting audio frame");
-                return -1;
-            }
-            frame = audio_st.frame;
+        if (ret < 0) {
+            log_debug("ffmpegdrv_encode_audio: Error while converting audio frame");
+            return -1;
+        }
+        frame = audio_st.frame;
 #ifdef _MSC_VER
-            tmp.num = 1;
-            tmp.den = c->sample_rate;
-            frame->pts = VICE_P_AV_RESCALE_Q(audio_st.samples_count, tmp, c->time_base);
+        tmp.num = 1;
+        tmp.den = c->sample_rate;
+        frame->pts = VICE_P_AV_RESCALE_Q(audio_st.samples_count, tmp, c->time_base);
 #else
-            frame->pts = VICE_P_AV_RESCALE_Q(audio_st.samples_count, (AVRational){ 1, c->sample_rate }, c->time_base);
+        frame->pts = VICE_P_AV_RESCALE_Q(audio_st.samples_count, (AVRational){ 1, c->sample_rate }, c->time_base);
 #endif
-            audio_st.samples_count += dst_nb_samples;
+        audio_st.samples_count += dst_nb_samples;
+    }
+
+    ret = VICE_P_AVCODEC_ENCODE_AUDIO2(audio_st.st->codec, &pkt, audio_st.frame, &got_packet);
+    if (got_packet) {
+        if (write_frame(ffmpegdrv_oc, &c->time_base, audio_st.st, &pkt)<0)
+        {
+            log_debug("ffmpegdrv_encode_audio: Error while writing audio frame");
         }
+    }
 
-        ret = VICE_P_AVCODEC_ENCODE_AUDIO2(audio_st.st->codec, &pkt, audio_st.frame, &got_packet);
-        if (got_packet) {
-            if (write_frame(ffmpegdrv_oc, &c->time_base, audio_st.st, &pkt)<0)
-            {
-                log_debug("ffmpegdrv_encode_audio: Error while writing audio frame");
-            }
+    return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static ffmpegdrv_job_t *ffmpegdrv_queue_get(int wait);
+static void ffmpegdrv_queue_put(void);
+#endif
+
+/* triggered by soundffmpegaudio->write */
+static int ffmpegmovie_encode_audio(soundmovie_buffer_t *audio_in)
+{
+    int64_t pts;
+#ifdef HAVE_PTHREAD
+    ffmpegdrv_job_t *job;
+#endif
+
+    if (audio_st.st) {
+        pts = audio_st.next_pts;
+        audio_st.next_pts += audio_in->size;
+
+#ifdef HAVE_PTHREAD
+        if (worker_running) {
+            /* audio is never dropped, wait for the encoder if needed */
+            job = ffmpegdrv_queue_get(1);
+            job->type = FFMPEGDRV_JOB_AUDIO;
+            job->pts = pts;
+            memcpy(job->data, audio_in->buffer, audio_in->size * sizeof(SWORD));
+            ffmpegdrv_queue_put();
+            audio_in->used = 0;
+            return 0;
+        }
+#endif
+
+        if (ffmpegdrv_encode_audio_frame(audio_in->buffer, pts) < 0) {
+            return -1;
         }
     }
 
@@ -593,29 +667,50 @@ static soundmovie_funcs_t ffmpegdrv_soundmovie_funcs = {
 /*-----------------------*/
 /* video stream encoding */
 /*-----------------------*/
-static int ffmpegdrv_fill_rgb_image(screenshot_t *screenshot, AVFrame *pic)
+
+/* locate the part of the draw buffer that goes into the video and take
+   a copy of the palette */
+static BYTE *ffmpegdrv_get_image(screenshot_t *screenshot, BYTE *rgb)
 {
-    int x, y;
     int dx, dy;
-    int colnum;
+    unsigned int i, entries;
     int bufferoffset;
     int x_dim = screenshot->width;
     int y_dim = screenshot->height;
-    int pix = 0;
+
+    entries = screenshot->palette->num_entries;
+    if (entries > 256) {
+        entries = 256;
+    }
+    for (i = 0; i < entries; i++) {
+        rgb[i * 3] = screenshot->palette->entries[i].red;
+        rgb[i * 3 + 1] = screenshot->palette->entries[i].green;
+        rgb[i * 3 + 2] = screenshot->palette->entries[i].blue;
+    }
+
     /* center the screenshot in the video */
     dx = (video_width - x_dim) / 2;
     dy = (video_height - y_dim) / 2;
     bufferoffset = screenshot->x_offset + (dx < 0 ? -dx : 0)
         + (screenshot->y_offset + (dy < 0 ? -dy : 0)) * screenshot->draw_buffer_line_size;
 
+    return screenshot->draw_buffer + bufferoffset;
+}
+
+static int ffmpegdrv_fill_rgb_image(const BYTE *src, int src_pitch, const BYTE *rgb, AVFrame *pic)
+{
+    int x, y;
+    int colnum;
+    int pix = 0;
+
     for (y = 0; y < video_height; y++) {
         for (x = 0; x < video_width; x++) {
-            colnum = screenshot->draw_buffer[bufferoffset + x];
-            pic->data[0][pix + 3*x] = screenshot->palette->entries[colnum].red;
-            pic->data[0][pix + 3*x + 1] = screenshot->palette->entries[colnum].green;
-            pic->data[0][pix + 3*x + 2] = screenshot->palette->entries[colnum].blue;
+            colnum = src[x];
+            pic->data[0][pix + 3*x] = rgb[colnum * 3];
+            pic->data[0][pix + 3*x + 1] = rgb[colnum * 3 + 1];
+            pic->data[0][pix + 3*x + 2] = rgb[colnum * 3 + 2];
         }
-        bufferoffset += screenshot->draw_buffer_line_size;
+        src += src_pitch;
         pix += pic->linesize[0];
     }
 
@@ -748,6 +843,9 @@ static void ffmpegdrv_init_video(screenshot_t *screenshot)
     c->time_base = st->time_base;
 
     c->gop_size = 12; /* emit one intra frame every twelve frames at most */
+
+    /* let codecs with slice or frame threading pick their thread count */
+    c->thread_count = 0;
     c->pix_fmt = AV_PIX_FMT_YUV420P;
 
 #if (LIBAVUTIL_VERSION_MICRO >= 100)
@@ -795,6 +893,160 @@ static void ffmpegdrv_init_video(screenshot_t *screenshot)
     }
 }
 
+/*-----------------------*/
+/* encoder thread        */
+/*-----------------------*/
+
+/* The emulator thread only copies frames and audio buffers into a bounded
+   queue, conversion and encoding are done by a single encoder thread which
+   owns the format context.  Codecs that can use slice or frame threads do
+   so on their own (see thread_count in ffmpegdrv_init_video).  */
+
+#ifdef HAVE_PTHREAD
+static int ffmpegdrv_encode_video_frame(const BYTE *src, int src_pitch, const BYTE *rgb, int64_t pts);
+
+static ffmpegdrv_job_t *ffmpegdrv_queue_get(int wait)
+{
+    ffmpegdrv_job_t *job;
+
+    pthread_mutex_lock(&queue_lock);
+    while (queue_count == FFMPEGDRV_QUEUE_SIZE) {
+        if (!wait) {
+            pthread_mutex_unlock(&queue_lock);
+            return NULL;
+        }
+        pthread_cond_wait(&queue_space_cond, &queue_lock);
+    }
+    job = &queue[(queue_head + queue_count) % FFMPEGDRV_QUEUE_SIZE];
+    pthread_mutex_unlock(&queue_lock);
+
+    return job;
+}
+
+static void ffmpegdrv_queue_put(void)
+{
+    pthread_mutex_lock(&queue_lock);
+    queue_count++;
+    pthread_cond_signal(&queue_job_cond);
+    pthread_mutex_unlock(&queue_lock);
+}
+
+static void *ffmpegdrv_worker(void *unused)
+{
+    ffmpegdrv_job_t *job;
+    int ret;
+
+    pthread_mutex_lock(&queue_lock);
+    while (1) {
+        while (queue_count == 0 && !queue_stop) {
+            pthread_cond_wait(&queue_job_cond, &queue_lock);
+        }
+        if (queue_count == 0) {
+            /* stop requested and everything is written */
+            break;
+        }
+        job = &queue[queue_head];
+        pthread_mutex_unlock(&queue_lock);
+
+        if (!worker_error) {
+            if (job->type == FFMPEGDRV_JOB_VIDEO) {
+                ret = ffmpegdrv_encode_video_frame(job->data, video_width, job->rgb, job->pts);
+            } else {
+                ret = ffmpegdrv_encode_audio_frame((SWORD *)job->data, job->pts);
+            }
+            if (ret < 0) {
+                worker_error = 1;
+            }
+        }
+
+        pthread_mutex_lock(&queue_lock);
+        queue_head = (queue_head + 1) % FFMPEGDRV_QUEUE_SIZE;
+        queue_count--;
+        pthread_cond_signal(&queue_space_cond);
+    }
+    pthread_mutex_unlock(&queue_lock);
+
+    return NULL;
+}
+
+static void ffmpegdrv_free_queue(void)
+{
+    int i;
+
+    for (i = 0; i < FFMPEGDRV_QUEUE_SIZE; i++) {
+        lib_free(queue[i].data);
+        queue[i].data = NULL;
+    }
+    pthread_cond_destroy(&queue_space_cond);
+    pthread_cond_destroy(&queue_job_cond);
+    pthread_mutex_destroy(&queue_lock);
+}
+
+static void ffmpegdrv_start_worker(void)
+{
+    int i, size;
+
+    /* a job holds either a frame of palette indices or a buffer of samples */
+    size = video_width * video_height;
+    if (size < (int)(ffmpegdrv_audio_in.size * sizeof(SWORD))) {
+        size = (int)(ffmpegdrv_audio_in.size * sizeof(SWORD));
+    }
+
+    for (i = 0; i < FFMPEGDRV_QUEUE_SIZE; i++) {
+        queue[i].data = lib_malloc(size);
+    }
+    queue_head = 0;
+    queue_count = 0;
+    queue_stop = 0;
+    worker_error = 0;
+    frames_dropped = 0;
+
+    pthread_mutex_init(&queue_lock, NULL);
+    pthread_cond_init(&queue_job_cond, NULL);
+    pthread_cond_init(&queue_space_cond, NULL);
+
+    if (pthread_create(&worker_thread, NULL, ffmpegdrv_worker, NULL) != 0) {
+        log_debug("ffmpegdrv: Cannot start encoder thread, encoding inline");
+        ffmpegdrv_free_queue();
+        return;
+    }
+
+    /* soundmovie must not write into the frame the encoder thread is
+       working on, give it a buffer of its own */
+    if (audio_st.st) {
+        ffmpegdrv_audio_in.buffer = lib_malloc(ffmpegdrv_audio_in.size * sizeof(SWORD));
+    }
+
+    worker_running = 1;
+}
+
+static void ffmpegdrv_stop_worker(void)
+{
+    if (!worker_running) {
+        return;
+    }
+
+    pthread_mutex_lock(&queue_lock);
+    queue_stop = 1;
+    pthread_cond_signal(&queue_job_cond);
+    pthread_mutex_unlock(&queue_lock);
+
+    pthread_join(worker_thread, NULL);
+    ffmpegdrv_free_queue();
+
+    if (audio_st.st) {
+        lib_free(ffmpegdrv_audio_in.buffer);
+        ffmpegdrv_audio_in.buffer = (SWORD *)audio_st.tmp_frame->data[0];
+    }
+
+    worker_running = 0;
+
+    if (frames_dropped) {
+        log_debug("ffmpegdrv: Encoder too slow, %u frames dropped", frames_dropped);
+    }
+}
+#endif
+
 static int ffmpegdrv_init_file(void)
 {
     if (!video_init_done || !audio_init_done) {
@@ -830,6 +1082,10 @@ static int ffmpegdrv_init_file(void)
 
     file_init_done = 1;
 
+#ifdef HAVE_PTHREAD
+    ffmpegdrv_start_worker();
+#endif
+
     return 0;
 }
 
@@ -888,6 +1144,11 @@ static int ffmpegdrv_close(screenshot_t *screenshot)
 {
     unsigned int i;
 
+#ifdef HAVE_PTHREAD
+    /* let the encoder thread write what is still queued */
+    ffmpegdrv_stop_worker();
+#endif
+
     /* write the trailer, if any */
     if (file_init_done) {
         VICE_P_AV_WRITE_TRAILER(ffmpegdrv_oc);
@@ -921,35 +1182,17 @@ static int ffmpegdrv_close(screenshot_t *screenshot)
     return 0;
 }
 
-/* triggered by screenshot_record */
-static int ffmpegdrv_record(screenshot_t *screenshot)
+/* convert and encode one frame, runs on the encoder thread if there
+   is one */
+static int ffmpegdrv_encode_video_frame(const BYTE *src, int src_pitch, const BYTE *rgb, int64_t pts)
 {
     AVCodecContext *c;
     int ret;
 
-    if (audio_init_done && video_init_done && !file_init_done) {
-        ffmpegdrv_init_file();
-    }
-
-    if (video_st.st == NULL || !file_init_done) {
-        return 0;
-    }
-
-   if (audio_st.st && video_st.next_pts > audio_st.next_pts) {
-        /* drop this frame */
-        return 0;
-    }
-
-    framecounter++;
-    if (video_halve_framerate && (framecounter & 1)) {
-        /* drop every second frame */
-        return 0;
-    }
-
     c = video_st.st->codec;
 
     if (c->pix_fmt != PIX_FMT_RGB24) {
-        ffmpegdrv_fill_rgb_image(screenshot, video_st.tmp_frame);
+        ffmpegdrv_fill_rgb_image(src, src_pitch, rgb, video_st.tmp_frame);
 
         if (sws_ctx != NULL) {
             VICE_P_SWS_SCALE(sws_ctx,
@@ -962,10 +1205,10 @@ static int ffmpegdrv_record(screenshot_t *screenshot)
                 video_st.frame->data, video_st.frame->linesize);
         }
     } else {
-        ffmpegdrv_fill_rgb_image(screenshot, video_st.frame);
+        ffmpegdrv_fill_rgb_image(src, src_pitch, rgb, video_st.frame);
     }
 
-    video_st.frame->pts = video_st.next_pts++;
+    video_st.frame->pts = pts;
 
     if (ffmpegdrv_oc->oformat->flags & AVFMT_RAWPICTURE) {
         AVPacket pkt;
@@ -1007,6 +1250,72 @@ static int ffmpegdrv_record(screenshot_t *screenshot)
     return 0;
 }
 
+/* triggered by screenshot_record */
+static int ffmpegdrv_record(screenshot_t *screenshot)
+{
+    BYTE rgb[256 * 3];
+    BYTE *src;
+    int64_t pts;
+#ifdef HAVE_PTHREAD
+    ffmpegdrv_job_t *job;
+    int y, warp;
+#endif
+
+    if (audio_init_done && video_init_done && !file_init_done) {
+        ffmpegdrv_init_file();
+    }
+
+    if (video_st.st == NULL || !file_init_done) {
+        return 0;
+    }
+
+   if (audio_st.st && video_st.next_pts > audio_st.next_pts) {
+        /* drop this frame */
+        return 0;
+    }
+
+    framecounter++;
+    if (video_halve_framerate && (framecounter & 1)) {
+        /* drop every second frame */
+        return 0;
+    }
+
+#ifdef HAVE_PTHREAD
+    if (worker_running) {
+        if (worker_error) {
+            return -1;
+        }
+
+        job = ffmpegdrv_queue_get(0);
+        if (job == NULL) {
+            /* The encoder can't keep up.  In warp mode wait for it, at
+               normal speed drop the frame rather than stall emulation.  */
+            if (resources_get_int("WarpMode", &warp) < 0 || !warp) {
+                video_st.next_pts++;
+                frames_dropped++;
+                return 0;
+            }
+            job = ffmpegdrv_queue_get(1);
+        }
+
+        job->type = FFMPEGDRV_JOB_VIDEO;
+        job->pts = video_st.next_pts++;
+        src = ffmpegdrv_get_image(screenshot, job->rgb);
+        for (y = 0; y < video_height; y++) {
+            memcpy(job->data + y * video_width, src, video_width);
+            src += screenshot->draw_buffer_line_size;
+        }
+        ffmpegdrv_queue_put();
+        return 0;
+    }
+#endif
+
+    src = ffmpegdrv_get_image(screenshot, rgb);
+    pts = video_st.next_pts++;
+
+    return ffmpegdrv_encode_video_frame(src, screenshot->draw_buffer_line_size, rgb, pts);
+}
+
 static int ffmpegdrv_write(screenshot_t *screenshot)
 {
     return 0;
@@ -58,6 +58,10 @@
 #include "quicktimedrv.h"
 #endif
 
+#ifdef HAVE_SHM_OPEN
+#include "shmdrv.h"
+#endif
+
 struct gfxoutputdrv_list_s {
     struct gfxoutputdrv_s *drv;
     struct gfxoutputdrv_list_s *next;
@@ -123,6 +127,9 @@ int gfxoutput_early_init(int help)
 #endif
 #ifdef HAVE_QUICKTIME
     gfxoutput_init_quicktime(help);
+#endif
+#ifdef HAVE_SHM_OPEN
+    gfxoutput_init_shm(help);
 #endif
     gfxoutput_init_godot(help);
     return 0;
@@ -0,0 +1,450 @@
+/*
+ * shmdrv.c - Stream frames and audio into a shared memory ring.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#include "vice.h"
+
+#ifdef HAVE_SHM_OPEN
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "cmdline.h"
+#include "gfxoutput.h"
+#include "lib.h"
+#include "log.h"
+#include "maincpu.h"
+#include "palette.h"
+#include "resources.h"
+#include "screenshot.h"
+#include "shmdrv.h"
+#include "translate.h"
+#include "types.h"
+#include "vsyncapi.h"
+#include "../sounddrv/soundmovie.h"
+
+/* The consumer runs in another process, so make sure the ring contents
+   are visible before the counters that publish them.  */
+#ifdef __GNUC__
+#define SHMDRV_BARRIER() __sync_synchronize()
+#else
+#define SHMDRV_BARRIER()
+#endif
+
+#define SHMDRV_ALIGN(x) (((x) + 63) & ~63)
+
+#define SHMDRV_VIDEO_FRAMES_MIN     2
+#define SHMDRV_VIDEO_FRAMES_MAX     256
+#define SHMDRV_VIDEO_FRAMES_DEFAULT 8
+
+#define SHMDRV_AUDIO_BUFFER_MIN     20
+#define SHMDRV_AUDIO_BUFFER_MAX     10000
+#define SHMDRV_AUDIO_BUFFER_DEFAULT 500
+
+static log_t shmdrv_log = LOG_ERR;
+
+/* Mapped shared memory object, NULL when not recording.  */
+static shmdrv_header_t *shm_header = NULL;
+static BYTE *shm_base;
+static size_t shm_size;
+static char *shm_name = NULL;
+
+/* Frames seen since recording started.  */
+static DWORD frame_counter;
+
+/* Buffer handed to the soundmovie device.  */
+static soundmovie_buffer_t shmdrv_audio_in;
+
+static int video_frames;
+static int audio_buffer_ms;
+
+/*---------- Resources ------------------------------------------------*/
+
+static int set_video_frames(int val, void *param)
+{
+    if (val < SHMDRV_VIDEO_FRAMES_MIN) {
+        val = SHMDRV_VIDEO_FRAMES_MIN;
+    }
+    if (val > SHMDRV_VIDEO_FRAMES_MAX) {
+        val = SHMDRV_VIDEO_FRAMES_MAX;
+    }
+    video_frames = val;
+    return 0;
+}
+
+static int set_audio_buffer(int val, void *param)
+{
+    if (val < SHMDRV_AUDIO_BUFFER_MIN) {
+        val = SHMDRV_AUDIO_BUFFER_MIN;
+    }
+    if (val > SHMDRV_AUDIO_BUFFER_MAX) {
+        val = SHMDRV_AUDIO_BUFFER_MAX;
+    }
+    audio_buffer_ms = val;
+    return 0;
+}
+
+static const resource_int_t resources_int[] = {
+    { "SHMVideoFrames", SHMDRV_VIDEO_FRAMES_DEFAULT, RES_EVENT_NO, NULL,
+      &video_frames, set_video_frames, NULL },
+    { "SHMAudioBuffer", SHMDRV_AUDIO_BUFFER_DEFAULT, RES_EVENT_NO, NULL,
+      &audio_buffer_ms, set_audio_buffer, NULL },
+    { NULL }
+};
+
+static int shmdrv_resources_init(void)
+{
+    return resources_register_int(resources_int);
+}
+
+/*---------- Commandline options --------------------------------------*/
+
+static const cmdline_option_t cmdline_options[] = {
+    { "-shmvideoframes", SET_RESOURCE, 1,
+      NULL, NULL, "SHMVideoFrames", NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_VALUE, IDCLS_SET_SHM_VIDEO_FRAMES,
+      NULL, NULL },
+    { "-shmaudiobuffer", SET_RESOURCE, 1,
+      NULL, NULL, "SHMAudioBuffer", NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_VALUE, IDCLS_SET_SHM_AUDIO_BUFFER,
+      NULL, NULL },
+    { NULL }
+};
+
+static int shmdrv_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
+
+/*---------------------------------------------------------------------*/
+
+static DWORD shmdrv_pow2(DWORD val)
+{
+    DWORD result = 1;
+
+    while (result < val) {
+        result <<= 1;
+    }
+    return result;
+}
+
+static void shmdrv_host_time(DWORD *sec, DWORD *usec)
+{
+    unsigned long now = vsyncarch_gettime();
+    unsigned long freq = (unsigned long)vsyncarch_frequency();
+
+    *sec = (DWORD)(now / freq);
+    *usec = (DWORD)((double)(now % freq) * 1000000.0 / (double)freq);
+}
+
+/*-----------------------*/
+/* audio stream          */
+/*-----------------------*/
+
+static int shmdrv_init_audio(int speed, int channels, soundmovie_buffer_t **audio_in)
+{
+    if (shm_header == NULL) {
+        return -1;
+    }
+
+    /* Hand over chunks of 10ms to keep the latency low.  */
+    lib_free(shmdrv_audio_in.buffer);
+    shmdrv_audio_in.size = (speed / 100) * channels;
+    shmdrv_audio_in.used = 0;
+    shmdrv_audio_in.buffer = lib_malloc(shmdrv_audio_in.size * sizeof(SWORD));
+    *audio_in = &shmdrv_audio_in;
+
+    shm_header->audio_rate = (DWORD)speed;
+    SHMDRV_BARRIER();
+    shm_header->audio_channels = (DWORD)channels;
+
+    return 0;
+}
+
+static int shmdrv_encode_audio(soundmovie_buffer_t *audio_in)
+{
+    SWORD *ring;
+    DWORD write, mask, pos, count, first;
+
+    if (shm_header == NULL) {
+        return 0;
+    }
+
+    count = (DWORD)audio_in->used;
+    write = shm_header->audio_write;
+
+    if (shm_header->audio_size - (write - shm_header->audio_read) < count) {
+        /* The consumer is lagging behind, never wait for it.  */
+        shm_header->samples_dropped += count;
+        return 0;
+    }
+    SHMDRV_BARRIER();
+
+    ring = (SWORD *)(shm_base + shm_header->audio_offset);
+    mask = shm_header->audio_size - 1;
+    pos = write & mask;
+    first = shm_header->audio_size - pos;
+    if (first > count) {
+        first = count;
+    }
+    memcpy(ring + pos, audio_in->buffer, first * sizeof(SWORD));
+    memcpy(ring, audio_in->buffer + first, (count - first) * sizeof(SWORD));
+
+    SHMDRV_BARRIER();
+    shm_header->audio_write = write + count;
+
+    return 0;
+}
+
+static void shmdrv_close_audio(void)
+{
+    lib_free(shmdrv_audio_in.buffer);
+    shmdrv_audio_in.buffer = NULL;
+    shmdrv_audio_in.size = 0;
+    shmdrv_audio_in.used = 0;
+}
+
+static soundmovie_funcs_t shmdrv_soundmovie_funcs = {
+    shmdrv_init_audio,
+    shmdrv_encode_audio,
+    shmdrv_close_audio
+};
+
+/*-----------------------*/
+/* video stream          */
+/*-----------------------*/
+
+static int shmdrv_close(screenshot_t *screenshot)
+{
+    if (shm_header == NULL) {
+        return 0;
+    }
+
+    soundmovie_stop();
+
+    shm_header->active = 0;
+    SHMDRV_BARRIER();
+
+    log_message(shmdrv_log, "Closed `%s', %u frames, %u dropped, %u samples dropped.",
+                shm_name, (unsigned int)frame_counter,
+                (unsigned int)shm_header->frames_dropped,
+                (unsigned int)shm_header->samples_dropped);
+
+    munmap(shm_base, shm_size);
+    shm_unlink(shm_name);
+
+    shm_header = NULL;
+    shm_base = NULL;
+    lib_free(shm_name);
+    shm_name = NULL;
+
+    return 0;
+}
+
+static int shmdrv_save(screenshot_t *screenshot, const char *filename)
+{
+    shmdrv_header_t *header;
+    DWORD slot_count, slot_size, audio_size, header_size;
+    int fd, rate;
+    void *base;
+
+    if (shmdrv_log == LOG_ERR) {
+        shmdrv_log = log_open("SHM");
+    }
+
+    if (shm_header != NULL) {
+        shmdrv_close(NULL);
+    }
+
+    /* POSIX wants the object name to start with a slash.  */
+    if (filename[0] == '/') {
+        shm_name = lib_stralloc(filename);
+    } else {
+        shm_name = lib_msprintf("/%s", filename);
+    }
+
+    if (resources_get_int("SoundSampleRate", &rate) < 0 || rate <= 0) {
+        rate = 48000;
+    }
+
+    slot_count = shmdrv_pow2((DWORD)video_frames);
+    slot_size = SHMDRV_ALIGN(sizeof(shmdrv_slot_t)
+                             + screenshot->max_width * screenshot->max_height);
+    audio_size = shmdrv_pow2((DWORD)rate * 2 * (DWORD)audio_buffer_ms / 1000);
+    header_size = SHMDRV_ALIGN(sizeof(shmdrv_header_t));
+
+    shm_size = header_size + slot_count * slot_size + audio_size * sizeof(SWORD);
+
+    fd = shm_open(shm_name, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        log_error(shmdrv_log, "Cannot create shared memory object `%s'.", shm_name);
+        lib_free(shm_name);
+        shm_name = NULL;
+        return -1;
+    }
+
+    if (ftruncate(fd, (off_t)shm_size) < 0) {
+        log_error(shmdrv_log, "Cannot resize shared memory object `%s'.", shm_name);
+        close(fd);
+        shm_unlink(shm_name);
+        lib_free(shm_name);
+        shm_name = NULL;
+        return -1;
+    }
+
+    base = mmap(NULL, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        log_error(shmdrv_log, "Cannot map shared memory object `%s'.", shm_name);
+        shm_unlink(shm_name);
+        lib_free(shm_name);
+        shm_name = NULL;
+        return -1;
+    }
+
+    shm_base = (BYTE *)base;
+    memset(shm_base, 0, shm_size);
+
+    header = (shmdrv_header_t *)shm_base;
+    memcpy(header->magic, SHMDRV_MAGIC, sizeof(SHMDRV_MAGIC));
+    header->version = SHMDRV_VERSION;
+    header->header_size = header_size;
+    header->slot_count = slot_count;
+    header->slot_size = slot_size;
+    header->slots_offset = header_size;
+    header->max_width = screenshot->max_width;
+    header->max_height = screenshot->max_height;
+    header->audio_offset = header_size + slot_count * slot_size;
+    header->audio_size = audio_size;
+    SHMDRV_BARRIER();
+    header->active = 1;
+
+    shm_header = header;
+    frame_counter = 0;
+
+    log_message(shmdrv_log, "Streaming to `%s', %u frame slots, %u audio samples.",
+                shm_name, (unsigned int)slot_count, (unsigned int)audio_size);
+
+    soundmovie_start(&shmdrv_soundmovie_funcs);
+
+    return 0;
+}
+
+/* triggered by screenshot_record */
+static int shmdrv_record(screenshot_t *screenshot)
+{
+    shmdrv_slot_t *slot;
+    BYTE *pixels;
+    DWORD write;
+    unsigned int line, i, entries;
+
+    if (shm_header == NULL) {
+        return 0;
+    }
+
+    frame_counter++;
+
+    write = shm_header->frame_write;
+    if ((write - shm_header->frame_read) >= shm_header->slot_count
+        || screenshot->width > shm_header->max_width
+        || screenshot->height > shm_header->max_height) {
+        shm_header->frames_dropped++;
+        return 0;
+    }
+    SHMDRV_BARRIER();
+
+    slot = (shmdrv_slot_t *)(shm_base + shm_header->slots_offset
+                             + (write & (shm_header->slot_count - 1)) * shm_header->slot_size);
+    pixels = (BYTE *)(slot + 1);
+
+    for (line = 0; line < screenshot->height; line++) {
+        (screenshot->convert_line)(screenshot, pixels, line, SCREENSHOT_MODE_PALETTE);
+        pixels += screenshot->width;
+    }
+
+    entries = screenshot->palette->num_entries;
+    if (entries > SHMDRV_PALETTE_SIZE) {
+        entries = SHMDRV_PALETTE_SIZE;
+    }
+    for (i = 0; i < entries; i++) {
+        slot->palette[i][0] = screenshot->palette->entries[i].red;
+        slot->palette[i][1] = screenshot->palette->entries[i].green;
+        slot->palette[i][2] = screenshot->palette->entries[i].blue;
+        slot->palette[i][3] = 0;
+    }
+    slot->palette_entries = entries;
+
+    slot->frame_number = frame_counter - 1;
+    slot->width = screenshot->width;
+    slot->height = screenshot->height;
+    shmdrv_host_time(&slot->host_sec, &slot->host_usec);
+    slot->clock = maincpu_clk;
+    slot->audio_position = shm_header->audio_write;
+
+    SHMDRV_BARRIER();
+    shm_header->frame_write = write + 1;
+
+    return 0;
+}
+
+static int shmdrv_write(screenshot_t *screenshot)
+{
+    return 0;
+}
+
+static void shmdrv_shutdown(void)
+{
+    shmdrv_close(NULL);
+    shmdrv_close_audio();
+}
+
+static gfxoutputdrv_t shm_drv = {
+    "SHM",
+    "Shared memory stream",
+    NULL,
+    NULL,
+    NULL, /* open */
+    shmdrv_close,
+    shmdrv_write,
+    shmdrv_save,
+    NULL,
+    shmdrv_record,
+    shmdrv_shutdown,
+    shmdrv_resources_init,
+    shmdrv_cmdline_options_init
+#ifdef FEATURE_CPUMEMHISTORY
+    , NULL
+#endif
+};
+
+void gfxoutput_init_shm(int help)
+{
+    gfxoutput_register(&shm_drv);
+}
+#endif
@@ -0,0 +1,107 @@
+/*
+ * shmdrv.h - Stream frames and audio into a shared memory ring.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_SHMDRV_H
+#define VICE_SHMDRV_H
+
+#include "types.h"
+
+/* Layout of the shared memory object created by the "SHM" driver.
+
+   The object starts with a `shmdrv_header_t', followed by `slot_count'
+   video slots of `slot_size' bytes each (starting at `slots_offset') and
+   an audio ring of `audio_size' signed 16 bit samples (starting at
+   `audio_offset').  Each video slot starts with a `shmdrv_slot_t',
+   followed by `width' * `height' palette indices.
+
+   The emulator is the only writer.  All counters only ever increase
+   (modulo 2^32); ring indices are `counter & (size - 1)', both sizes are
+   powers of two.  A consumer copies what it needs and then advances
+   `frame_read' / `audio_read'.  When a ring is full the emulator drops
+   the new data and bumps `frames_dropped' / `samples_dropped' instead of
+   waiting for the consumer.  */
+
+#define SHMDRV_MAGIC    "VICESHM"
+#define SHMDRV_VERSION  1
+
+#define SHMDRV_PALETTE_SIZE 256
+
+typedef struct shmdrv_header_s {
+    char magic[8];
+    DWORD version;
+    DWORD header_size;
+
+    /* Video ring geometry.  */
+    DWORD slot_count;
+    DWORD slot_size;
+    DWORD slots_offset;
+    DWORD max_width;
+    DWORD max_height;
+
+    /* Audio ring geometry; rate and channels are valid once
+       `audio_channels' is not zero.  */
+    DWORD audio_offset;
+    DWORD audio_size;
+    volatile DWORD audio_rate;
+    volatile DWORD audio_channels;
+
+    /* Video ring state.  */
+    volatile DWORD frame_write;
+    volatile DWORD frame_read;
+    volatile DWORD frames_dropped;
+
+    /* Audio ring state (in samples, not sample frames).  */
+    volatile DWORD audio_write;
+    volatile DWORD audio_read;
+    volatile DWORD samples_dropped;
+
+    /* Cleared when the emulator stops recording.  */
+    volatile DWORD active;
+} shmdrv_header_t;
+
+typedef struct shmdrv_slot_s {
+    /* Number of frames seen since recording started, including dropped
+       ones.  */
+    DWORD frame_number;
+
+    /* Size of this frame.  */
+    DWORD width;
+    DWORD height;
+
+    /* Host time in seconds/microseconds and emulated clock when the frame
+       was published.  */
+    DWORD host_sec;
+    DWORD host_usec;
+    DWORD clock;
+
+    /* Value of `audio_write' when the frame was published.  */
+    DWORD audio_position;
+
+    /* Number of valid palette entries, and the entries as R, G, B, 0.  */
+    DWORD palette_entries;
+    BYTE palette[SHMDRV_PALETTE_SIZE][4];
+} shmdrv_slot_t;
+
+extern void gfxoutput_init_shm(int help);
+
+#endif
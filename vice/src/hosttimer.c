@@ -0,0 +1,359 @@
+/*
+ * hosttimer.c - Host time spent in the emulator subsystems.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* The timers are only built with --enable-hosttimers.  Entering a timer
+   charges the time since the last switch to the timer being interrupted,
+   so the timers never overlap and add up to the whole run.  Ticks are
+   converted to nanoseconds with the host time measured at the frame
+   ends, so the tick rate does not need to be known.  */
+
+#include "vice.h"
+
+#ifdef FEATURE_HOSTTIMERS
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmdline.h"
+#include "hosttimer.h"
+#include "lib.h"
+#include "log.h"
+#include "machine.h"
+#include "resources.h"
+#include "translate.h"
+#include "uiapi.h"
+#include "util.h"
+#include "vsyncapi.h"
+
+#define HOSTTIMER_MAX   64
+#define HOSTTIMER_DEPTH 16
+
+/* Number of timers named in the periodic report.  */
+#define HOSTTIMER_LOG_TOP    6
+#define HOSTTIMER_STATUS_TOP 3
+
+typedef unsigned long long hosttimer_ticks_t;
+
+static const char *fixed_names[HOSTTIMER_NUM_FIXED] = {
+    "other", "vicii", "drive", "sound", "sid", "render", "vsync"
+};
+
+static char *timer_names[HOSTTIMER_MAX];
+static unsigned int timer_count = HOSTTIMER_NUM_FIXED;
+
+/* Ticks since the reset and at the last report.  */
+static hosttimer_ticks_t ticks[HOSTTIMER_MAX];
+static hosttimer_ticks_t report_ticks[HOSTTIMER_MAX];
+
+/* Nested timers; entries above the stack limit are only counted.  */
+static int stack[HOSTTIMER_DEPTH];
+static int depth = 0;
+static int overflow = 0;
+static hosttimer_ticks_t last;
+
+/* Tick count, host time and frame number at the reset, the last report
+   and the last frame.  */
+static hosttimer_ticks_t start_tick, report_tick, frame_tick;
+static unsigned long start_time, report_time, frame_time;
+static unsigned long frames, report_frames;
+
+int hosttimer_active = 0;
+
+static int hosttimers_enabled = 0;
+static int report_interval = 250;
+
+static log_t hosttimer_log = LOG_ERR;
+
+/* ------------------------------------------------------------------------- */
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+inline static hosttimer_ticks_t hosttimer_now(void)
+{
+    unsigned int lo, hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+
+    return ((hosttimer_ticks_t)hi << 32) | lo;
+}
+#elif defined(CLOCK_MONOTONIC)
+inline static hosttimer_ticks_t hosttimer_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (hosttimer_ticks_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#else
+inline static hosttimer_ticks_t hosttimer_now(void)
+{
+    return (hosttimer_ticks_t)vsyncarch_gettime();
+}
+#endif
+
+inline static void hosttimer_charge(void)
+{
+    hosttimer_ticks_t now = hosttimer_now();
+
+    ticks[stack[depth]] += now - last;
+    last = now;
+}
+
+void hosttimer_enter(int timer)
+{
+    hosttimer_charge();
+
+    if (depth < HOSTTIMER_DEPTH - 1) {
+        stack[++depth] = timer;
+    } else {
+        overflow++;
+    }
+}
+
+void hosttimer_leave(void)
+{
+    hosttimer_charge();
+
+    /* Timers entered before the timers were switched on are never popped
+       below the bottom.  */
+    if (overflow > 0) {
+        overflow--;
+    } else if (depth > 0) {
+        depth--;
+    }
+}
+
+int hosttimer_register(const char *name)
+{
+    char *timer_name;
+    unsigned int i;
+
+    timer_name = util_concat("alarm:", name, NULL);
+
+    for (i = HOSTTIMER_NUM_FIXED; i < timer_count; i++) {
+        if (strcmp(timer_names[i], timer_name) == 0) {
+            lib_free(timer_name);
+            return (int)i;
+        }
+    }
+
+    if (timer_count == HOSTTIMER_MAX) {
+        lib_free(timer_name);
+        return HOSTTIMER_OTHER;
+    }
+
+    timer_names[timer_count] = timer_name;
+
+    return (int)timer_count++;
+}
+
+void hosttimer_reset(void)
+{
+    if (hosttimer_log == LOG_ERR) {
+        hosttimer_log = log_open("HostTimer");
+    }
+
+    memset(ticks, 0, sizeof(ticks));
+    memset(report_ticks, 0, sizeof(report_ticks));
+
+    depth = 0;
+    overflow = 0;
+    stack[0] = HOSTTIMER_OTHER;
+
+    last = start_tick = report_tick = frame_tick = hosttimer_now();
+    start_time = report_time = frame_time = vsyncarch_gettime();
+    frames = report_frames = 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/* Append the `top' timers with the largest share of `total' ticks since the
+   last report to `text'.  */
+static void hosttimer_top(char *text, size_t size, unsigned int top, hosttimer_ticks_t total)
+{
+    unsigned char listed[HOSTTIMER_MAX];
+    hosttimer_ticks_t delta, best_delta;
+    unsigned int i, n, best;
+    size_t len;
+
+    memset(listed, 0, sizeof(listed));
+
+    for (n = 0; n < top; n++) {
+        best = timer_count;
+        best_delta = 0;
+        for (i = 0; i < timer_count; i++) {
+            delta = ticks[i] - report_ticks[i];
+            if (!listed[i] && delta > best_delta) {
+                best = i;
+                best_delta = delta;
+            }
+        }
+        if (best == timer_count) {
+            break;
+        }
+        listed[best] = 1;
+
+        len = strlen(text);
+        snprintf(text + len, size - len, "%s%s %.0f%%", (n > 0) ? ", " : "",
+                 hosttimer_name(best), (double)best_delta * 100.0 / (double)total);
+    }
+}
+
+static void hosttimer_report(void)
+{
+    char text[256];
+    double us_per_frame;
+    hosttimer_ticks_t total = frame_tick - report_tick;
+
+    if (total == 0 || frames == report_frames) {
+        return;
+    }
+
+    us_per_frame = (double)(frame_time - report_time) * 1000000.0
+                   / (double)vsyncarch_frequency() / (double)(frames - report_frames);
+
+    text[0] = 0;
+    hosttimer_top(text, sizeof(text), HOSTTIMER_LOG_TOP, total);
+    log_message(hosttimer_log, "%.0f us/frame: %s.", us_per_frame, text);
+
+    if (!console_mode) {
+        strcpy(text, "Host time: ");
+        hosttimer_top(text, sizeof(text), HOSTTIMER_STATUS_TOP, total);
+        ui_display_statustext(text, 1);
+    }
+
+    memcpy(report_ticks, ticks, sizeof(ticks));
+    report_tick = frame_tick;
+    report_time = frame_time;
+    report_frames = frames;
+}
+
+void hosttimer_frame(void)
+{
+    /* Switching on and off only takes effect here and starts from an empty
+       stack; see `hosttimer_leave()' for timers still open.  */
+    if (hosttimer_active != hosttimers_enabled) {
+        if (hosttimers_enabled) {
+            hosttimer_reset();
+        }
+        hosttimer_active = hosttimers_enabled;
+        return;
+    }
+
+    if (!hosttimer_active) {
+        return;
+    }
+
+    hosttimer_charge();
+    frame_tick = last;
+    frame_time = vsyncarch_gettime();
+    frames++;
+
+    if (report_interval > 0 && frames - report_frames >= (unsigned long)report_interval) {
+        hosttimer_report();
+    }
+}
+
+unsigned int hosttimer_count(void)
+{
+    return timer_count;
+}
+
+const char *hosttimer_name(unsigned int timer)
+{
+    if (timer < HOSTTIMER_NUM_FIXED) {
+        return fixed_names[timer];
+    }
+    return timer_names[timer];
+}
+
+double hosttimer_ns_per_frame(unsigned int timer)
+{
+    if (frames == 0 || frame_tick == start_tick) {
+        return 0.0;
+    }
+
+    return (double)ticks[timer] * (double)(frame_time - start_time) * 1000000000.0
+           / (double)vsyncarch_frequency() / (double)(frame_tick - start_tick) / (double)frames;
+}
+
+unsigned long hosttimer_frames(void)
+{
+    return frames;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int set_hosttimers_enabled(int val, void *param)
+{
+    hosttimers_enabled = val ? 1 : 0;
+
+    return 0;
+}
+
+static int set_report_interval(int val, void *param)
+{
+    report_interval = (val < 0) ? 0 : val;
+
+    return 0;
+}
+
+static const resource_int_t resources_int[] = {
+    { "HostTimers", 0, RES_EVENT_NO, NULL,
+      &hosttimers_enabled, set_hosttimers_enabled, NULL },
+    { "HostTimersInterval", 250, RES_EVENT_NO, NULL,
+      &report_interval, set_report_interval, NULL },
+    { NULL }
+};
+
+int hosttimer_resources_init(void)
+{
+    return resources_register_int(resources_int);
+}
+
+static const cmdline_option_t cmdline_options[] = {
+    { "-hosttimers", SET_RESOURCE, 0,
+      NULL, NULL, "HostTimers", (resource_value_t)1,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_ENABLE_HOST_TIMERS,
+      NULL, NULL },
+    { "+hosttimers", SET_RESOURCE, 0,
+      NULL, NULL, "HostTimers", (resource_value_t)0,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_DISABLE_HOST_TIMERS,
+      NULL, NULL },
+    { "-hosttimersinterval", SET_RESOURCE, 1,
+      NULL, NULL, "HostTimersInterval", NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_NUMBER, IDCLS_SET_HOST_TIMERS_INTERVAL,
+      NULL, NULL },
+    { NULL }
+};
+
+int hosttimer_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
+
+#endif
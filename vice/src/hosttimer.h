@@ -0,0 +1,88 @@
+/*
+ * hosttimer.h - Host time spent in the emulator subsystems.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_HOSTTIMER_H
+#define VICE_HOSTTIMER_H
+
+/* Fixed timers.  Alarm callbacks get a timer per alarm name on top of
+   these.  Time is charged to the innermost timer only, everything outside
+   the others (mostly the main CPU) goes to HOSTTIMER_OTHER.  */
+enum {
+    HOSTTIMER_OTHER = 0,
+    HOSTTIMER_VICII,
+    HOSTTIMER_DRIVE,
+    HOSTTIMER_SOUND,
+    HOSTTIMER_SID,
+    HOSTTIMER_RENDER,
+    HOSTTIMER_VSYNC,
+    HOSTTIMER_NUM_FIXED
+};
+
+#ifdef FEATURE_HOSTTIMERS
+
+extern int hosttimer_active;
+
+extern void hosttimer_enter(int timer);
+extern void hosttimer_leave(void);
+
+#define HOSTTIMER_ENTER(timer)      \
+    do {                            \
+        if (hosttimer_active) {     \
+            hosttimer_enter(timer); \
+        }                           \
+    } while (0)
+
+#define HOSTTIMER_LEAVE()           \
+    do {                            \
+        if (hosttimer_active) {     \
+            hosttimer_leave();      \
+        }                           \
+    } while (0)
+
+/* Return the timer for an alarm name, shared by all alarms of that
+   name.  */
+extern int hosttimer_register(const char *name);
+
+/* Called at the end of every frame.  */
+extern void hosttimer_frame(void);
+
+extern void hosttimer_reset(void);
+
+/* Number of timers, their names and the average host nanoseconds per
+   frame since the last reset.  */
+extern unsigned int hosttimer_count(void);
+extern const char *hosttimer_name(unsigned int timer);
+extern double hosttimer_ns_per_frame(unsigned int timer);
+extern unsigned long hosttimer_frames(void);
+
+extern int hosttimer_resources_init(void);
+extern int hosttimer_cmdline_options_init(void);
+
+#else
+
+#define HOSTTIMER_ENTER(timer)
+#define HOSTTIMER_LEAVE()
+
+#endif
+
+#endif
@@ -27,12 +27,16 @@
 
 #include "vice.h"
 
+#include <string.h>
+
 #include "archdep.h"
 #include "attach.h"
+#include "benchmark.h"
 #include "cmdline.h"
 #include "console.h"
 #include "debug.h"
 #include "drive.h"
+#include "hosttimer.h"
 #include "initcmdline.h"
 #include "keyboard.h"
 #include "log.h"
@@ -55,6 +59,7 @@
 #include "vdrive.h"
 #include "video.h"
 #include "vsync.h"
+#include "vsyncapi.h"
 
 /* #define DBGINIT */
 
@@ -64,6 +69,73 @@
 #define DBG(x)
 #endif
 
+/* Startup timing.  Each mark charges the time since the previous one to
+   the given phase; with "-startuptime" the phases are logged once the
+   machine is set up.  */
+#define INIT_TIME_MAX_PHASES 24
+
+static struct {
+    const char *name;
+    unsigned long ticks;
+} init_time_phases[INIT_TIME_MAX_PHASES];
+
+static int init_time_num_phases = 0;
+static int init_time_report_enabled = 0;
+static unsigned long init_time_last = 0;
+
+void init_time_start(void)
+{
+    init_time_num_phases = 0;
+    init_time_last = vsyncarch_gettime();
+}
+
+void init_time_mark(const char *phase)
+{
+    unsigned long now = vsyncarch_gettime();
+    int i;
+
+    for (i = 0; i < init_time_num_phases; i++) {
+        if (strcmp(init_time_phases[i].name, phase) == 0) {
+            break;
+        }
+    }
+    if (i == init_time_num_phases) {
+        if (i == INIT_TIME_MAX_PHASES) {
+            return;
+        }
+        init_time_phases[i].name = phase;
+        init_time_phases[i].ticks = 0;
+        init_time_num_phases++;
+    }
+    init_time_phases[i].ticks += now - init_time_last;
+    init_time_last = now;
+}
+
+void init_time_enable_report(void)
+{
+    init_time_report_enabled = 1;
+}
+
+void init_time_report(void)
+{
+    double scale = 1000.0 / (double)vsyncarch_frequency();
+    unsigned long total = 0;
+    int i;
+
+    if (!init_time_report_enabled) {
+        return;
+    }
+
+    for (i = 0; i < init_time_num_phases; i++) {
+        log_message(LOG_DEFAULT, "Startup: %-20s %8.1f ms",
+                    init_time_phases[i].name,
+                    (double)init_time_phases[i].ticks * scale);
+        total += init_time_phases[i].ticks;
+    }
+    log_message(LOG_DEFAULT, "Startup: %-20s %8.1f ms", "total",
+                (double)total * scale);
+}
+
 void init_resource_fail(const char *module)
 {
     archdep_startup_log_error("Cannot initialize %s resources.\n",
@@ -101,6 +173,12 @@ int init_resources(void)
         init_resource_fail("vsync");
         return -1;
     }
+#ifdef FEATURE_HOSTTIMERS
+    if (hosttimer_resources_init() < 0) {
+        init_resource_fail("host timer");
+        return -1;
+    }
+#endif
     if (sound_resources_init() < 0) {
         init_resource_fail("sound");
         return -1;
@@ -178,10 +256,20 @@ int init_cmdline_options(void)
         init_cmdline_options_fail("machine common");
         return -1;
     }
+    if (benchmark_cmdline_options_init() < 0) {
+        init_cmdline_options_fail("benchmark");
+        return -1;
+    }
     if (vsync_cmdline_options_init() < 0) {
         init_cmdline_options_fail("vsync");
         return -1;
     }
+#ifdef FEATURE_HOSTTIMERS
+    if (hosttimer_cmdline_options_init() < 0) {
+        init_cmdline_options_fail("host timer");
+        return -1;
+    }
+#endif
     if (sound_cmdline_options_init() < 0) {
         init_cmdline_options_fail("sound");
         return -1;
@@ -229,6 +317,7 @@ int init_main(void)
     if (!video_disabled_mode) {
         palette_init();
     }
+    init_time_mark("palette");
 
     if (machine_class != VICE_MACHINE_VSID) {
         screenshot_init();
@@ -244,6 +333,7 @@ int init_main(void)
         log_error(LOG_DEFAULT, "Machine initialization failed.");
         return -1;
     }
+    init_time_mark("machine");
 
     /* FIXME: what's about uimon_init??? */
     /* the monitor console MUST be available, because of for example cpujam,
@@ -261,6 +351,7 @@ int init_main(void)
     }
 
     ui_init_finalize();
+    init_time_mark("UI");
 
     return 0;
 }
@@ -34,4 +34,11 @@ extern int init_main(void);
 extern void init_resource_fail(const char *module);
 extern void init_cmdline_options_fail(const char *module);
 
+/* Startup timing, see init.c.  `phase' must stay valid until the
+   report, which is only logged with "-startuptime".  */
+extern void init_time_start(void);
+extern void init_time_mark(const char *phase);
+extern void init_time_enable_report(void);
+extern void init_time_report(void);
+
 #endif
@@ -38,6 +38,7 @@
 #include "attach.h"
 #include "autostart.h"
 #include "cmdline.h"
+#include "init.h"
 #include "initcmdline.h"
 #include "ioutil.h"
 #include "lib.h"
@@ -155,6 +156,12 @@ static int cmdline_autoload(const char *param, void *extra_param)
     return 0;
 }
 
+static int cmdline_startuptime(const char *param, void *extra_param)
+{
+    init_time_enable_report();
+    return 0;
+}
+
 #if !defined(__OS2__) && !defined(__BEOS__)
 static int cmdline_console(const char *param, void *extra_param)
 {
@@ -234,6 +241,11 @@ static const cmdline_option_t common_cmdline_options[] = {
       USE_PARAM_ID, USE_DESCRIPTION_ID,
       IDCLS_P_VALUE, IDCLS_LIMIT_CYCLES,
       NULL, NULL },
+    { "-startuptime", CALL_FUNCTION, 0,
+      cmdline_startuptime, NULL, NULL, NULL,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_LOG_STARTUP_TIME,
+      NULL, NULL },
 #if (!defined  __OS2__ && !defined __BEOS__)
     { "-console", CALL_FUNCTION, 0,
       cmdline_console, NULL, NULL, NULL,
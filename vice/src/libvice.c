@@ -0,0 +1,281 @@
+/*
+ * libvice.c - Interface for running the emulator inside another program.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* The emulator normally never returns from `maincpu_mainloop()'.  Here it
+   is run with `maincpu_clk_limit_return' set, so reaching
+   `maincpu_clk_limit' returns to the caller with the registers saved, and
+   the next run continues from there.  Frames are counted through the vsync
+   frame callback, which moves the limit to the current clock.  */
+
+#include "vice.h"
+
+#include <string.h>
+
+#include "attach.h"
+#include "autostart.h"
+#include "clkguard.h"
+#include "joystick.h"
+#include "keyboard.h"
+#include "lib.h"
+#include "libvice.h"
+#include "log.h"
+#include "machine.h"
+#include "main.h"
+#include "maincpu.h"
+#include "palette.h"
+#include "psid.h"
+#include "resources.h"
+#include "sound.h"
+#include "types.h"
+#include "vicii.h"
+#include "video.h"
+#include "videoarch.h"
+#include "vsync.h"
+
+/* Recorded audio, at most about ten seconds of 48kHz stereo.  */
+#define LIBVICE_AUDIO_SIZE  (48000 * 2 * 10)
+
+static SWORD *audio_buffer = NULL;
+static unsigned int audio_len = 0;
+static int audio_rate = 0;
+static int audio_channels = 0;
+
+static unsigned int frames_left = 0;
+
+static log_t libvice_log = LOG_ERR;
+
+/* ------------------------------------------------------------------------- */
+
+/* Recording sound device collecting the samples for `libvice_get_audio()'.
+   It accepts whatever the sound system asks for.  */
+
+static int libvice_sound_init(const char *param, int *speed, int *fragsize, int *fragnr, int *channels)
+{
+    audio_rate = *speed;
+    audio_channels = *channels;
+    audio_len = 0;
+
+    return 0;
+}
+
+static int libvice_sound_write(SWORD *pbuf, size_t nr)
+{
+    if (nr > LIBVICE_AUDIO_SIZE - audio_len) {
+        /* Nobody fetched the samples, drop the oldest ones.  */
+        if (nr >= LIBVICE_AUDIO_SIZE) {
+            pbuf += nr - LIBVICE_AUDIO_SIZE;
+            nr = LIBVICE_AUDIO_SIZE;
+            audio_len = 0;
+        } else {
+            unsigned int drop = (unsigned int)nr - (LIBVICE_AUDIO_SIZE - audio_len);
+
+            memmove(audio_buffer, audio_buffer + drop, (audio_len - drop) * sizeof(SWORD));
+            audio_len -= drop;
+        }
+    }
+    memcpy(audio_buffer + audio_len, pbuf, nr * sizeof(SWORD));
+    audio_len += (unsigned int)nr;
+
+    return 0;
+}
+
+static void libvice_sound_close(void)
+{
+    audio_len = 0;
+}
+
+static sound_device_t libvice_sound_device =
+{
+    "libvice",
+    libvice_sound_init,
+    libvice_sound_write,
+    NULL,
+    NULL,
+    NULL,
+    libvice_sound_close,
+    NULL,
+    NULL,
+    0,
+    2
+};
+
+/* ------------------------------------------------------------------------- */
+
+static void libvice_frame_done(void)
+{
+    if (frames_left > 0 && --frames_left == 0) {
+        /* Return after the current opcode.  */
+        maincpu_clk_limit = maincpu_clk;
+    }
+}
+
+static void clk_overflow_callback(CLOCK sub, void *unused_data)
+{
+    if (maincpu_clk_limit != CLOCK_MAX && maincpu_clk_limit > sub) {
+        maincpu_clk_limit -= sub;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+int libvice_init(int argc, char **argv)
+{
+    if (main_program_init(argc, argv) < 0) {
+        return -1;
+    }
+
+    libvice_log = log_open("libvice");
+
+    audio_buffer = lib_malloc(LIBVICE_AUDIO_SIZE * sizeof(SWORD));
+    sound_register_device(&libvice_sound_device);
+
+    if (resources_set_int("WarpMode", 1) < 0
+        || resources_set_string("SoundDeviceName", "dummy") < 0
+        || resources_set_string("SoundRecordDeviceName", "libvice") < 0) {
+        log_error(libvice_log, "Cannot set up the machine for embedding.");
+        return -1;
+    }
+
+    maincpu_clk_limit_return = 1;
+    vsync_set_frame_callback(libvice_frame_done);
+    clk_guard_add_callback(maincpu_clk_guard, clk_overflow_callback, NULL);
+
+    return 0;
+}
+
+int libvice_attach(const char *filename, int autostart)
+{
+    if (machine_class == VICE_MACHINE_VSID) {
+        if (machine_autodetect_psid(filename) < 0) {
+            return -1;
+        }
+        psid_init_driver();
+        machine_play_psid(0);
+        machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+        return 0;
+    }
+
+    if (autostart) {
+        return autostart_autodetect(filename, NULL, 0, AUTOSTART_MODE_RUN);
+    }
+    return file_system_attach_disk(8, filename);
+}
+
+int libvice_run_cycles(CLOCK cycles)
+{
+    if (cycles == 0) {
+        return 0;
+    }
+
+    frames_left = 0;
+    maincpu_clk_limit = maincpu_clk + cycles - 1;
+    maincpu_mainloop();
+
+    return 0;
+}
+
+int libvice_run_frames(unsigned int frames)
+{
+    if (frames == 0) {
+        return 0;
+    }
+
+    frames_left = frames;
+    maincpu_clk_limit = CLOCK_MAX;
+    maincpu_mainloop();
+
+    return 0;
+}
+
+const BYTE *libvice_get_screen(unsigned int *width, unsigned int *height, unsigned int *pitch)
+{
+    video_canvas_t *canvas = vicii_get_canvas();
+
+    if (canvas == NULL || canvas->draw_buffer == NULL) {
+        return NULL;
+    }
+
+    *width = canvas->draw_buffer->draw_buffer_width;
+    *height = canvas->draw_buffer->draw_buffer_height;
+    *pitch = canvas->draw_buffer->draw_buffer_pitch;
+
+    return canvas->draw_buffer->draw_buffer;
+}
+
+unsigned int libvice_get_palette(BYTE *rgb, unsigned int max_entries)
+{
+    video_canvas_t *canvas = vicii_get_canvas();
+    unsigned int i;
+
+    if (canvas == NULL || canvas->palette == NULL) {
+        return 0;
+    }
+
+    for (i = 0; i < canvas->palette->num_entries && i < max_entries; i++) {
+        rgb[i * 3] = canvas->palette->entries[i].red;
+        rgb[i * 3 + 1] = canvas->palette->entries[i].green;
+        rgb[i * 3 + 2] = canvas->palette->entries[i].blue;
+    }
+
+    return i;
+}
+
+unsigned int libvice_get_audio(SWORD *buffer, unsigned int max_samples)
+{
+    unsigned int n = (audio_len < max_samples) ? audio_len : max_samples;
+
+    if (audio_channels > 1) {
+        n -= n % audio_channels;
+    }
+    memcpy(buffer, audio_buffer, n * sizeof(SWORD));
+    memmove(audio_buffer, audio_buffer + n, (audio_len - n) * sizeof(SWORD));
+    audio_len -= n;
+
+    return n;
+}
+
+void libvice_get_audio_format(int *rate, int *channels)
+{
+    *rate = audio_rate;
+    *channels = audio_channels;
+}
+
+void libvice_set_joystick(unsigned int port, BYTE value)
+{
+    joystick_set_value_absolute(port, value);
+}
+
+void libvice_set_key(int row, int column, int pressed)
+{
+    keyboard_set_keyarr_any(row, column, pressed);
+}
+
+int libvice_snapshot_save(const char *filename)
+{
+    return machine_write_snapshot(filename, 1, 1, 0);
+}
+
+int libvice_snapshot_load(const char *filename)
+{
+    return machine_read_snapshot(filename, 0);
+}
@@ -0,0 +1,72 @@
+/*
+ * libvice.h - Interface for running the emulator inside another program.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_LIBVICE_H
+#define VICE_LIBVICE_H
+
+#include "types.h"
+
+/* The library is built with `make libvice-x64sc.a' or `make libvice-vsid.a'
+   in src/ and has to be linked with the same external libraries as the
+   emulator itself.  The machine state is global, so there is one machine
+   per process; run one process per machine to use several cores.
+
+   `libvice_init()' takes the usual command line; argv[0] has to name the
+   program like for the emulator, as the ROMs are searched relative to it.
+   Pass "-console" to run without windows.  The machine runs in warp mode
+   and only advances inside `libvice_run_cycles()' and
+   `libvice_run_frames()'; everything else must be called between runs.  */
+
+extern int libvice_init(int argc, char **argv);
+
+/* Autostart (autostart != 0) or just attach a disk, tape or cartridge
+   image.  */
+extern int libvice_attach(const char *filename, int autostart);
+
+/* Run the given number of CPU cycles or frames.  */
+extern int libvice_run_cycles(CLOCK cycles);
+extern int libvice_run_frames(unsigned int frames);
+
+/* Current draw buffer of the main screen, one palette index per pixel.
+   The pointer stays valid until the next run.  */
+extern const BYTE *libvice_get_screen(unsigned int *width, unsigned int *height, unsigned int *pitch);
+
+/* Palette for `libvice_get_screen()' as R, G, B triplets; returns the
+   number of entries copied.  */
+extern unsigned int libvice_get_palette(BYTE *rgb, unsigned int max_entries);
+
+/* Move up to `max_samples' recorded samples (interleaved if stereo) into
+   `buffer' and return their number.  Samples are only recorded while the
+   "Sound" resource is enabled.  */
+extern unsigned int libvice_get_audio(SWORD *buffer, unsigned int max_samples);
+extern void libvice_get_audio_format(int *rate, int *channels);
+
+/* Input, using the same paths as the user interface.  */
+extern void libvice_set_joystick(unsigned int port, BYTE value);
+extern void libvice_set_key(int row, int column, int pressed);
+
+/* Save or restore the whole machine state.  */
+extern int libvice_snapshot_save(const char *filename);
+extern int libvice_snapshot_load(const char *filename);
+
+#endif
@@ -32,6 +32,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#if defined(HAVE_PTHREAD) && !defined(__X1541__)
+#define LOG_THREAD
+#include <pthread.h>
+#endif
 
 #include "archdep.h"
 #include "cmdline.h"
@@ -56,6 +62,64 @@ static int log_enabled = 1; /* cv: this flag allows to temporarly disable all lo
 static int verbose = 0;
 static int locked = 0;
 
+/* Rate limiting: at most `log_rate_limit' messages per second for each log,
+   errors are never suppressed.  */
+typedef struct log_rate_s {
+    time_t second;
+    unsigned int count;
+    unsigned int suppressed;
+} log_rate_t;
+
+static int log_rate_limit = 0;
+static log_rate_t *log_rates = NULL;
+static log_rate_t log_default_rates[2];
+
+/* ------------------------------------------------------------------------- */
+
+#ifdef LOG_THREAD
+/* Log writer thread.
+
+   With "LogThread" enabled, log_helper() formats each message into a slot
+   of a bounded ring and returns; a separate thread writes the slots out.
+   Any thread may log, so slots are claimed with a compare-and-swap on
+   `ring_write' and each slot has a sequence number telling whether it is
+   free, being filled, or ready to be written.  When the ring is full the
+   message is dropped and counted.  Errors wait for the thread to free a
+   slot instead, so they stay in order and only the thread writes.  */
+
+/* Number of slots, must be a power of two.  */
+#define LOG_RING_SIZE   1024
+
+/* Longest message kept, longer ones are cut.  */
+#define LOG_RECORD_SIZE 256
+
+#define LOG_RING_BARRIER() __sync_synchronize()
+
+typedef struct log_record_s {
+    volatile unsigned int sequence;
+    char prefix[64];
+    char text[LOG_RECORD_SIZE];
+} log_record_t;
+
+static struct {
+    pthread_t thread;
+    int running;
+    volatile int quit;
+
+    log_record_t ring[LOG_RING_SIZE];
+    volatile unsigned int ring_write;
+    unsigned int ring_read;
+
+    volatile unsigned int dropped;
+    unsigned int dropped_logged;
+} log_thread;
+
+static int log_thread_enabled = 0;
+
+static void log_thread_start(void);
+static void log_thread_stop(void);
+#endif
+
 /* ------------------------------------------------------------------------- */
 
 static char *log_file_name = NULL;
@@ -89,13 +153,43 @@ static int set_log_file_name(const char *val, void *param)
     }
 
     if (log_file) {
+#ifdef LOG_THREAD
+        int restart = log_thread.running;
+
+        log_thread_stop();
+#endif
         fclose(log_file);
         log_file_open();
+#ifdef LOG_THREAD
+        if (restart) {
+            log_thread_start();
+        }
+#endif
     }
 
     return 0;
 }
 
+static int set_log_rate_limit(int val, void *param)
+{
+    log_rate_limit = (val < 0) ? 0 : val;
+    return 0;
+}
+
+#ifdef LOG_THREAD
+static int set_log_thread_enabled(int val, void *param)
+{
+    log_thread_enabled = val ? 1 : 0;
+
+    if (log_thread_enabled) {
+        log_thread_start();
+    } else {
+        log_thread_stop();
+    }
+    return 0;
+}
+#endif
+
 static int log_verbose_opt(const char *param, void *extra_param)
 {
     verbose = vice_ptr_to_int(extra_param);
@@ -132,6 +226,16 @@ static const resource_string_t resources_string[] = {
     { NULL }
 };
 
+static const resource_int_t resources_int[] = {
+    { "LogRateLimit", 0, RES_EVENT_NO, NULL,
+      &log_rate_limit, set_log_rate_limit, NULL },
+#ifdef LOG_THREAD
+    { "LogThread", 0, RES_EVENT_NO, NULL,
+      &log_thread_enabled, set_log_thread_enabled, NULL },
+#endif
+    { NULL }
+};
+
 static int log_logfile_opt(const char *param, void *extra_param)
 {
     locked = 0;
@@ -142,11 +246,18 @@ static int log_logfile_opt(const char *param, void *extra_param)
 
 int log_resources_init(void)
 {
-    return resources_register_string(resources_string);
+    if (resources_register_string(resources_string) < 0) {
+        return -1;
+    }
+
+    return resources_register_int(resources_int);
 }
 
 void log_resources_shutdown(void)
 {
+#ifdef LOG_THREAD
+    log_thread_stop();
+#endif
     lib_free(log_file_name);
 }
 
@@ -161,6 +272,23 @@ static const cmdline_option_t cmdline_options[] = {
       USE_PARAM_STRING, USE_DESCRIPTION_ID,
       IDCLS_UNUSED, IDCLS_ENABLE_VERBOSE_LOG_OUTPUT,
       NULL, NULL },
+    { "-lograte", SET_RESOURCE, 1,
+      NULL, NULL, "LogRateLimit", NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_NUMBER, IDCLS_SET_LOG_RATE_LIMIT,
+      NULL, NULL },
+#ifdef LOG_THREAD
+    { "-logthread", SET_RESOURCE, 0,
+      NULL, NULL, "LogThread", (resource_value_t)1,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_ENABLE_LOG_THREAD,
+      NULL, NULL },
+    { "+logthread", SET_RESOURCE, 0,
+      NULL, NULL, "LogThread", (resource_value_t)0,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_DISABLE_LOG_THREAD,
+      NULL, NULL },
+#endif
     { NULL }
 };
 
@@ -199,6 +327,12 @@ int log_init(void)
 
     log_file_open();
 
+#ifdef LOG_THREAD
+    if (log_thread_enabled) {
+        log_thread_start();
+    }
+#endif
+
     return (log_file == NULL) ? -1 : 0;
 }
 
@@ -216,9 +350,11 @@ log_t log_open(const char *id)
     if (i == num_logs) {
         new_log = num_logs++;
         logs = lib_realloc(logs, sizeof(*logs) * num_logs);
+        log_rates = lib_realloc(log_rates, sizeof(*log_rates) * num_logs);
     }
 
     logs[new_log] = lib_stralloc(id);
+    memset(&log_rates[new_log], 0, sizeof(*log_rates));
 
     /* printf("log_open(%s) = %d\n", id, (int)new_log); */
     return new_log;
@@ -245,8 +381,14 @@ void log_close_all(void)
         log_close(i);
     }
 
+#ifdef LOG_THREAD
+    log_thread_stop();
+#endif
+
     lib_free(logs);
     logs = NULL;
+    lib_free(log_rates);
+    log_rates = NULL;
 }
 
 static int log_archdep(const char *logtxt, const char *fmt, va_list ap)
@@ -285,6 +427,174 @@ static int log_archdep(const char *logtxt, const char *fmt, va_list ap)
     return rc;
 }
 
+/* Write one formatted message.  */
+static int log_write_text(const char *logtxt, char *txt)
+{
+    int rc = 0;
+
+    if (log_file == NULL) {
+        char *beg = txt;
+
+        while (1) {
+            char *eol = strchr(beg, '\n');
+
+            if (eol) {
+                *eol = '\0';
+            }
+            if (archdep_default_logger(*beg ? logtxt : "", beg) < 0) {
+                rc = -1;
+            }
+            if (!eol) {
+                break;
+            }
+            *eol = '\n';
+            beg = eol + 1;
+        }
+    } else {
+#ifdef ARCHDEP_EXTRA_LOG_CALL
+        archdep_default_logger(logtxt, txt);
+#endif
+        if (fputs(logtxt, log_file) == EOF
+            || fputs(txt, log_file) == EOF
+            || fputc('\n', log_file) == EOF) {
+            rc = -1;
+        }
+    }
+
+    return rc;
+}
+
+#ifdef LOG_THREAD
+static void *log_thread_main(void *unused)
+{
+    struct timespec idle;
+    log_record_t *rec;
+    unsigned int dropped;
+    char txt[40];
+    int quit;
+
+    idle.tv_sec = 0;
+    idle.tv_nsec = 5000000;
+
+    do {
+        quit = log_thread.quit;
+
+        for (;;) {
+            rec = &log_thread.ring[log_thread.ring_read & (LOG_RING_SIZE - 1)];
+            if (rec->sequence != log_thread.ring_read + 1) {
+                break;
+            }
+            LOG_RING_BARRIER();
+            log_write_text(rec->prefix, rec->text);
+            LOG_RING_BARRIER();
+            rec->sequence = log_thread.ring_read + LOG_RING_SIZE;
+            log_thread.ring_read++;
+        }
+
+        dropped = log_thread.dropped;
+        if (dropped != log_thread.dropped_logged) {
+            sprintf(txt, "%u messages dropped.", dropped - log_thread.dropped_logged);
+            log_write_text("Log: ", txt);
+            log_thread.dropped_logged = dropped;
+        }
+
+        if (!quit) {
+            nanosleep(&idle, NULL);
+        }
+    } while (!quit);
+
+    return NULL;
+}
+
+static void log_thread_start(void)
+{
+    unsigned int i;
+
+    if (log_thread.running || log_file == NULL) {
+        return;
+    }
+
+    for (i = 0; i < LOG_RING_SIZE; i++) {
+        log_thread.ring[i].sequence = i;
+    }
+    log_thread.ring_write = 0;
+    log_thread.ring_read = 0;
+    log_thread.dropped = 0;
+    log_thread.dropped_logged = 0;
+    log_thread.quit = 0;
+    LOG_RING_BARRIER();
+
+    if (pthread_create(&log_thread.thread, NULL, log_thread_main, NULL) != 0) {
+        return;
+    }
+    log_thread.running = 1;
+}
+
+/* Stop the thread after it has written everything queued so far.  */
+static void log_thread_stop(void)
+{
+    if (!log_thread.running) {
+        return;
+    }
+
+    log_thread.quit = 1;
+    pthread_join(log_thread.thread, NULL);
+    log_thread.running = 0;
+}
+
+/* Queue a message for the thread.  When the ring is full, errors wait for
+   a free slot and other messages are dropped.  */
+static int log_thread_push(const char *logtxt, unsigned int level,
+                           const char *format, va_list ap)
+{
+    struct timespec wait;
+    log_record_t *rec;
+    unsigned int pos;
+
+    wait.tv_sec = 0;
+    wait.tv_nsec = 1000000;
+
+    pos = log_thread.ring_write;
+    for (;;) {
+        rec = &log_thread.ring[pos & (LOG_RING_SIZE - 1)];
+        if (rec->sequence == pos) {
+            if (__sync_bool_compare_and_swap(&log_thread.ring_write, pos, pos + 1)) {
+                break;
+            }
+        } else if ((int)(rec->sequence - pos) < 0) {
+            /* Full.  Once the thread is stopping it may not come back for
+               the slot.  */
+            if (level < 2 || log_thread.quit) {
+                __sync_fetch_and_add(&log_thread.dropped, 1);
+                return 0;
+            }
+            nanosleep(&wait, NULL);
+        }
+        pos = log_thread.ring_write;
+    }
+
+    strncpy(rec->prefix, logtxt, sizeof(rec->prefix) - 1);
+    rec->prefix[sizeof(rec->prefix) - 1] = '\0';
+    vsnprintf(rec->text, sizeof(rec->text), format, ap);
+    LOG_RING_BARRIER();
+    rec->sequence = pos + 1;
+
+    return 0;
+}
+
+static int log_thread_push_text(const char *logtxt, const char *format, ...)
+{
+    va_list ap;
+    int rc;
+
+    va_start(ap, format);
+    rc = log_thread_push(logtxt, 0, format, ap);
+    va_end(ap);
+
+    return rc;
+}
+#endif
+
 static int log_helper(log_t log, unsigned int level, const char *format,
                       va_list ap)
 {
@@ -297,6 +607,7 @@ static int log_helper(log_t log, unsigned int level, const char *format,
     const signed int logi = (signed int)log;
     int rc = 0;
     char *logtxt = NULL;
+    unsigned int suppressed = 0;
 
     if (!log_enabled) {
         return 0;
@@ -311,12 +622,50 @@ static int log_helper(log_t log, unsigned int level, const char *format,
         }
     }
 
+    if (log_rate_limit > 0) {
+        log_rate_t *rate;
+        time_t now = time(NULL);
+
+        if (logi >= 0) {
+            rate = &log_rates[logi];
+        } else {
+            rate = &log_default_rates[(logi == LOG_ERR) ? 0 : 1];
+        }
+        if (rate->second != now) {
+            suppressed = rate->suppressed;
+            rate->second = now;
+            rate->count = 0;
+            rate->suppressed = 0;
+        }
+        if (++rate->count > (unsigned int)log_rate_limit && level < 2) {
+            rate->suppressed++;
+            return 0;
+        }
+    }
+
     if ((logi != LOG_DEFAULT) && (logi != LOG_ERR) && (*logs[logi] != '\0')) {
         logtxt = lib_msprintf("%s: %s", logs[logi], level_strings[level]);
     } else {
         logtxt = lib_msprintf("%s", level_strings[level]);
     }
 
+    if (suppressed > 0) {
+        char txt[40];
+
+        sprintf(txt, "(%u messages suppressed)", suppressed);
+#ifdef LOG_THREAD
+        if (log_thread.running) {
+            log_thread_push_text(logtxt, "%s", txt);
+        } else
+#endif
+        log_write_text(logtxt, txt);
+    }
+
+#ifdef LOG_THREAD
+    if (log_thread.running) {
+        rc = log_thread_push(logtxt, level, format, ap);
+    } else
+#endif
     if (log_file == NULL) {
         rc = log_archdep(logtxt, format, ap);
     } else {
@@ -34,6 +34,7 @@
 #include "archdep.h"
 #include "attach.h"
 #include "autostart.h"
+#include "benchmark.h"
 #include "clkguard.h"
 #include "cmdline.h"
 #include "console.h"
@@ -59,6 +60,7 @@
 #include "resources.h"
 #include "romset.h"
 #include "screenshot.h"
+#include "sid-writelog.h"
 #include "sound.h"
 #include "sysfile.h"
 #include "tape.h"
@@ -258,6 +260,8 @@ void machine_shutdown(void)
         return;
     }
 
+    benchmark_shutdown();
+
     screenshot_at_exit();
 
     file_system_detach_disk_shutdown();
@@ -272,6 +276,8 @@ void machine_shutdown(void)
 
     sound_close();
 
+    sid_writelog_close();
+
     printer_shutdown();
     gfxoutput_shutdown();
 
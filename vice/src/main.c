@@ -89,8 +89,9 @@ static int init_done = 0;
 
 /* ------------------------------------------------------------------------- */
 
-/* This is the main program entry point.  Call this from `main()'.  */
-int main_program(int argc, char **argv)
+/* Initialize everything up to the point where the main CPU starts.  Used
+   by `main_program()' and by embedders (see libvice.c).  */
+int main_program_init(int argc, char **argv)
 {
     int i, n;
     char *program_name;
@@ -142,6 +143,8 @@ int main_program(int argc, char **argv)
         return -1;
     }
 
+    init_time_start();
+
     maincpu_early_init();
     machine_setup_context();
     drive_setup_context();
@@ -151,15 +154,22 @@ int main_program(int argc, char **argv)
     sysfile_init(machine_name);
 
     gfxoutput_early_init(ishelp);
-    if ((init_resources() < 0) || (init_cmdline_options() < 0)) {
+    init_time_mark("early init");
+    if (init_resources() < 0) {
+        return -1;
+    }
+    init_time_mark("resources");
+    if (init_cmdline_options() < 0) {
         return -1;
     }
+    init_time_mark("cmdline options");
 
     /* Set factory defaults.  */
     if (resources_set_defaults() < 0) {
         archdep_startup_log_error("Cannot set defaults.\n");
         return -1;
     }
+    init_time_mark("defaults");
 
     /* Initialize the user interface.  `ui_init()' might need to handle the
        command line somehow, so we call it before parsing the options.
@@ -169,6 +179,7 @@ int main_program(int argc, char **argv)
         archdep_startup_log_error("Cannot initialize the UI.\n");
         return -1;
     }
+    init_time_mark("UI");
 
 #ifdef HAS_TRANSLATION
     /* set the default arch language */
@@ -187,6 +198,8 @@ int main_program(int argc, char **argv)
         }
     }
 
+    init_time_mark("settings");
+
     if (log_init() < 0) {
         archdep_startup_log_error("Cannot startup logging system.\n");
     }
@@ -195,6 +208,7 @@ int main_program(int argc, char **argv)
     if (initcmdline_check_args(argc, argv) < 0) {
         return -1;
     }
+    init_time_mark("cmdline parsing");
 
     program_name = archdep_program_name();
 
@@ -256,6 +270,7 @@ int main_program(int argc, char **argv)
     if (!console_mode && video_init() < 0) {
         return -1;
     }
+    init_time_mark("UI");
 
     if (initcmdline_check_psid() < 0) {
         return -1;
@@ -266,9 +281,22 @@ int main_program(int argc, char **argv)
     }
 
     initcmdline_check_attach();
+    init_time_mark("attach");
+
+    init_time_report();
 
     init_done = 1;
 
+    return 0;
+}
+
+/* This is the main program entry point.  Call this from `main()'.  */
+int main_program(int argc, char **argv)
+{
+    if (main_program_init(argc, argv) < 0) {
+        return -1;
+    }
+
     /* Let's go...  */
     log_message(LOG_DEFAULT, "Main CPU: starting at ($FFFC).");
     maincpu_mainloop();
@@ -27,6 +27,7 @@
 #ifndef VICE_MAIN_H
 #define VICE_MAIN_H
 
+extern int main_program_init(int argc, char **argv);
 extern int main_program(int argc, char **argv);
 extern void main_exit(void);
 
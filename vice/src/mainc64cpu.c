@@ -522,6 +522,9 @@ inline static int interrupt_check_irq_delay(interrupt_cpu_status_t *cs,
 unsigned int reg_pc;
 #endif
 
+/* Set when `maincpu_mainloop()' returned at `maincpu_clk_limit'.  */
+static int maincpu_mainloop_returned = 0;
+
 static BYTE **o_bank_base;
 static int *o_bank_start;
 static int *o_bank_limit;
@@ -555,7 +558,20 @@ void maincpu_mainloop(void)
     o_bank_start = &bank_start;
     o_bank_limit = &bank_limit;
 
-    machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+    if (maincpu_mainloop_returned) {
+        /* Continue after a return at `maincpu_clk_limit'.  */
+        maincpu_mainloop_returned = 0;
+        reg_a = MOS6510_REGS_GET_A(&maincpu_regs);
+        reg_x = MOS6510_REGS_GET_X(&maincpu_regs);
+        reg_y = MOS6510_REGS_GET_Y(&maincpu_regs);
+        reg_sp = MOS6510_REGS_GET_SP(&maincpu_regs);
+        reg_p = maincpu_regs.p;
+        flag_n = maincpu_regs.n;
+        flag_z = maincpu_regs.z;
+        reg_pc = MOS6510_REGS_GET_PC(&maincpu_regs);
+    } else {
+        machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+    }
 
     while (1) {
 #define CLK maincpu_clk
@@ -610,6 +626,13 @@ void maincpu_mainloop(void)
         maincpu_int_status->num_dma_per_opcode = 0;
 
         if (maincpu_clk_limit && (maincpu_clk > maincpu_clk_limit)) {
+            if (maincpu_clk_limit_return) {
+                EXPORT_REGISTERS();
+                maincpu_clk_limit = 0;
+                maincpu_mainloop_returned = 1;
+                o_bank_base = NULL; /* the bank cache is gone with us */
+                return;
+            }
             log_error(LOG_DEFAULT, "cycle limit reached.");
             exit(EXIT_FAILURE);
         }
@@ -186,6 +186,8 @@ monitor_interface_t *maincpu_monitor_interface = NULL;
 CLOCK maincpu_clk = 0L;
 /* if != 0, exit when this many cycles have been executed */
 CLOCK maincpu_clk_limit = 0L;
+/* if != 0, return from the main loop instead of exiting at the limit */
+int maincpu_clk_limit_return = 0;
 
 /* This is flag is set to 1 each time a Read-Modify-Write instructions that
    accesses memory is executed.  We can emulate the RMW behaviour of the 6510
@@ -386,6 +388,11 @@ inline static int interrupt_check_irq_delay(interrupt_cpu_status_t *cs,
 unsigned int reg_pc;
 #endif
 
+#ifndef C64DTV
+/* Set when `maincpu_mainloop()' returned at `maincpu_clk_limit'.  */
+static int maincpu_mainloop_returned = 0;
+#endif
+
 static BYTE **o_bank_base;
 static int *o_bank_start;
 static int *o_bank_limit;
@@ -452,7 +459,24 @@ void maincpu_mainloop(void)
     o_bank_start = &bank_start;
     o_bank_limit = &bank_limit;
 
+#ifndef C64DTV
+    if (maincpu_mainloop_returned) {
+        /* Continue after a return at `maincpu_clk_limit'.  */
+        maincpu_mainloop_returned = 0;
+        reg_a = MOS6510_REGS_GET_A(&maincpu_regs);
+        reg_x = MOS6510_REGS_GET_X(&maincpu_regs);
+        reg_y = MOS6510_REGS_GET_Y(&maincpu_regs);
+        reg_sp = MOS6510_REGS_GET_SP(&maincpu_regs);
+        reg_p = maincpu_regs.p;
+        flag_n = maincpu_regs.n;
+        flag_z = maincpu_regs.z;
+        reg_pc = MOS6510_REGS_GET_PC(&maincpu_regs);
+    } else {
+        machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+    }
+#else
     machine_trigger_reset(MACHINE_RESET_MODE_SOFT);
+#endif
 
     while (1) {
 #define CLK maincpu_clk
@@ -507,6 +531,15 @@ void maincpu_mainloop(void)
         maincpu_int_status->num_dma_per_opcode = 0;
 
         if (maincpu_clk_limit && (maincpu_clk > maincpu_clk_limit)) {
+#ifndef C64DTV
+            if (maincpu_clk_limit_return) {
+                EXPORT_REGISTERS();
+                maincpu_clk_limit = 0;
+                maincpu_mainloop_returned = 1;
+                o_bank_base = NULL; /* the bank cache is gone with us */
+                return;
+            }
+#endif
             log_error(LOG_DEFAULT, "cycle limit reached.");
             exit(EXIT_FAILURE);
         }
@@ -56,6 +56,11 @@ extern int maincpu_rmw_flag;
 extern CLOCK maincpu_clk;
 extern CLOCK maincpu_clk_limit;
 
+/* If set, reaching `maincpu_clk_limit' makes `maincpu_mainloop()' return
+   with the registers in `maincpu_regs' instead of exiting; calling it again
+   continues from there.  Only x64, x64sc and vsid support this.  */
+extern int maincpu_clk_limit_return;
+
 /* 8502 cycle stretch indicator */
 extern int maincpu_stretch;
 
@@ -177,6 +177,14 @@ extern int mon_out(const char *format, ...);
 /* Prototypes */
 extern int monitor_check_breakpoints(MEMSPACE mem, WORD addr);
 
+/* Flags returned by `monitor_watch_page_flags()': the 256 byte page
+   contains an address with a load/store watchpoint.  Memory modules only
+   need to route these pages through their checking handlers.  */
+#define MONITOR_WATCH_LOAD  0x01
+#define MONITOR_WATCH_STORE 0x02
+
+extern int monitor_watch_page_flags(MEMSPACE mem, unsigned int page);
+
 /** Disassemble interace */
 /* Prototypes */
 extern const char *mon_disassemble_to_string(MEMSPACE, unsigned int addr, unsigned int x,
@@ -38,6 +38,7 @@
 #include "mon_breakpoint.h"
 #include "mon_disassemble.h"
 #include "mon_util.h"
+#include "monitor_network.h"
 #include "montypes.h"
 #include "uimon.h"
 
@@ -71,6 +72,10 @@ static checkpoint_list_t *breakpoints[NUM_MEMSPACES];
 static checkpoint_list_t *watchpoints_load[NUM_MEMSPACES];
 static checkpoint_list_t *watchpoints_store[NUM_MEMSPACES];
 
+/* Which 256 byte pages of each memspace contain a watched address
+   (MONITOR_WATCH_LOAD/MONITOR_WATCH_STORE bits).  */
+static BYTE watch_pages[NUM_MEMSPACES][0x100];
+
 
 void mon_breakpoint_init(void)
 {
@@ -140,8 +145,44 @@ static checkpoint_t *find_checkpoint(int brknum)
     return NULL;
 }
 
+static void watch_pages_mark(MEMSPACE mem, checkpoint_list_t *list, BYTE flag)
+{
+    unsigned int start, end, page;
+
+    while (list) {
+        start = addr_location(list->checkpt->start_addr) >> 8;
+        end = addr_location(list->checkpt->end_addr) >> 8;
+
+        if (end < start || end - start >= 0xff) {
+            /* wrapping or covering all pages */
+            for (page = 0; page < 0x100; page++) {
+                watch_pages[mem][page] |= flag;
+            }
+        } else {
+            for (page = start; page <= end; page++) {
+                watch_pages[mem][page & 0xff] |= flag;
+            }
+        }
+        list = list->next;
+    }
+}
+
+static void update_watch_pages(MEMSPACE mem)
+{
+    memset(watch_pages[mem], 0, sizeof(watch_pages[mem]));
+    watch_pages_mark(mem, watchpoints_load[mem], MONITOR_WATCH_LOAD);
+    watch_pages_mark(mem, watchpoints_store[mem], MONITOR_WATCH_STORE);
+}
+
+int mon_breakpoint_watch_page_flags(MEMSPACE mem, unsigned int page)
+{
+    return watch_pages[mem][page & 0xff];
+}
+
 static void update_checkpoint_state(MEMSPACE mem)
 {
+    update_watch_pages(mem);
+
     if (watchpoints_load[mem] != NULL || watchpoints_store[mem] != NULL) {
         monitor_mask[mem] |= MI_WATCH;
         mon_interfaces[mem]->toggle_watchpoints_func(
@@ -290,7 +331,7 @@ void mon_breakpoint_print_checkpoints(void)
     }
 }
 
-void mon_breakpoint_delete_checkpoint(int cp_num)
+int mon_breakpoint_delete_checkpoint(int cp_num)
 {
     int i;
     checkpoint_t *cp = NULL;
@@ -305,10 +346,12 @@ void mon_breakpoint_delete_checkpoint(int cp_num)
         }
     } else if (!(cp = find_checkpoint(cp_num))) {
         mon_out("#%d not a valid checkpoint\n", cp_num);
-        return;
+        return -1;
     } else {
         remove_checkpoint(cp);
     }
+
+    return 0;
 }
 
 void mon_breakpoint_set_checkpoint_condition(int cp_num,
@@ -447,6 +490,8 @@ bool mon_breakpoint_check_checkpoint(MEMSPACE mem, unsigned int addr, unsigned i
 
             cp->hit_count++;
 
+            monitor_network_event_checkpoint(cp->checknum, mem, addr, op);
+
             if (cp->stop) {
                 must_stop = TRUE;
                 action_str = "Stop on";
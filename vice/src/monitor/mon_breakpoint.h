@@ -40,13 +40,14 @@ extern void mon_breakpoint_init(void);
 extern void mon_breakpoint_switch_checkpoint(int op, int breakpt_num);
 extern void mon_breakpoint_set_ignore_count(int breakpt_num, int count);
 extern void mon_breakpoint_print_checkpoints(void);
-extern void mon_breakpoint_delete_checkpoint(int brknum);
+extern int mon_breakpoint_delete_checkpoint(int brknum);
 extern void mon_breakpoint_set_checkpoint_condition(int brk_num, struct cond_node_s *cnode);
 extern void mon_breakpoint_set_checkpoint_command(int brk_num, char *cmd);
 extern bool mon_breakpoint_check_checkpoint(MEMSPACE mem, unsigned int addr,
                                             unsigned int lastpc, MEMORY_OP op);
 extern int mon_breakpoint_add_checkpoint(MON_ADDR start_addr, MON_ADDR end_addr,
                                          bool stop, MEMORY_OP op, bool is_temp);
+extern int mon_breakpoint_watch_page_flags(MEMSPACE mem, unsigned int page);
 
 extern mon_breakpoint_type_t mon_breakpoint_is(MON_ADDR address);
 extern void mon_breakpoint_set(MON_ADDR address);
@@ -125,6 +125,13 @@ static const mon_cmds_t mon_cmd_array[] = {
       IDGS_MON_GOTO_DESCRIPTION,
       NULL, NULL },
 
+    { "hosttimers", "ht",
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      "[reset]", 0,
+      { IDGS_UNUSED, IDGS_UNUSED, IDGS_UNUSED, IDGS_UNUSED },
+      IDGS_MON_HOSTTIMERS_DESCRIPTION,
+      NULL, NULL },
+
     { "io", "",
       USE_PARAM_ID, USE_DESCRIPTION_ID,
       "<%s>", 1,
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2013 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.2"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 1 "mon_parse.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 1 "mon_parse.y"
 
 /* -*- C -*-
  *
@@ -192,26 +197,31 @@ extern int cur_len, last_len;
 #define YYDEBUG 1
 
 
-#line 196 "mon_parse.c" /* yacc.c:339  */
+#line 201 "mon_parse.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "y.tab.h".  */
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
 #ifndef YY_YY_MON_PARSE_H_INCLUDED
 # define YY_YY_MON_PARSE_H_INCLUDED
 /* Debug traces.  */
@@ -222,174 +232,184 @@ extern int cur_len, last_len;
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    H_NUMBER = 258,
-    D_NUMBER = 259,
-    O_NUMBER = 260,
-    B_NUMBER = 261,
-    CONVERT_OP = 262,
-    B_DATA = 263,
-    H_RANGE_GUESS = 264,
-    D_NUMBER_GUESS = 265,
-    O_NUMBER_GUESS = 266,
-    B_NUMBER_GUESS = 267,
-    BAD_CMD = 268,
-    MEM_OP = 269,
-    IF = 270,
-    MEM_COMP = 271,
-    MEM_DISK8 = 272,
-    MEM_DISK9 = 273,
-    MEM_DISK10 = 274,
-    MEM_DISK11 = 275,
-    EQUALS = 276,
-    TRAIL = 277,
-    CMD_SEP = 278,
-    LABEL_ASGN_COMMENT = 279,
-    CMD_SIDEFX = 280,
-    CMD_RETURN = 281,
-    CMD_BLOCK_READ = 282,
-    CMD_BLOCK_WRITE = 283,
-    CMD_UP = 284,
-    CMD_DOWN = 285,
-    CMD_LOAD = 286,
-    CMD_SAVE = 287,
-    CMD_VERIFY = 288,
-    CMD_IGNORE = 289,
-    CMD_HUNT = 290,
-    CMD_FILL = 291,
-    CMD_MOVE = 292,
-    CMD_GOTO = 293,
-    CMD_REGISTERS = 294,
-    CMD_READSPACE = 295,
-    CMD_WRITESPACE = 296,
-    CMD_RADIX = 297,
-    CMD_MEM_DISPLAY = 298,
-    CMD_BREAK = 299,
-    CMD_TRACE = 300,
-    CMD_IO = 301,
-    CMD_BRMON = 302,
-    CMD_COMPARE = 303,
-    CMD_DUMP = 304,
-    CMD_UNDUMP = 305,
-    CMD_EXIT = 306,
-    CMD_DELETE = 307,
-    CMD_CONDITION = 308,
-    CMD_COMMAND = 309,
-    CMD_ASSEMBLE = 310,
-    CMD_DISASSEMBLE = 311,
-    CMD_NEXT = 312,
-    CMD_STEP = 313,
-    CMD_PRINT = 314,
-    CMD_DEVICE = 315,
-    CMD_HELP = 316,
-    CMD_WATCH = 317,
-    CMD_DISK = 318,
-    CMD_QUIT = 319,
-    CMD_CHDIR = 320,
-    CMD_BANK = 321,
-    CMD_LOAD_LABELS = 322,
-    CMD_SAVE_LABELS = 323,
-    CMD_ADD_LABEL = 324,
-    CMD_DEL_LABEL = 325,
-    CMD_SHOW_LABELS = 326,
-    CMD_CLEAR_LABELS = 327,
-    CMD_RECORD = 328,
-    CMD_MON_STOP = 329,
-    CMD_PLAYBACK = 330,
-    CMD_CHAR_DISPLAY = 331,
-    CMD_SPRITE_DISPLAY = 332,
-    CMD_TEXT_DISPLAY = 333,
-    CMD_SCREENCODE_DISPLAY = 334,
-    CMD_ENTER_DATA = 335,
-    CMD_ENTER_BIN_DATA = 336,
-    CMD_KEYBUF = 337,
-    CMD_BLOAD = 338,
-    CMD_BSAVE = 339,
-    CMD_SCREEN = 340,
-    CMD_UNTIL = 341,
-    CMD_CPU = 342,
-    CMD_YYDEBUG = 343,
-    CMD_BACKTRACE = 344,
-    CMD_SCREENSHOT = 345,
-    CMD_PWD = 346,
-    CMD_DIR = 347,
-    CMD_RESOURCE_GET = 348,
-    CMD_RESOURCE_SET = 349,
-    CMD_LOAD_RESOURCES = 350,
-    CMD_SAVE_RESOURCES = 351,
-    CMD_ATTACH = 352,
-    CMD_DETACH = 353,
-    CMD_MON_RESET = 354,
-    CMD_TAPECTRL = 355,
-    CMD_CARTFREEZE = 356,
-    CMD_CPUHISTORY = 357,
-    CMD_MEMMAPZAP = 358,
-    CMD_MEMMAPSHOW = 359,
-    CMD_MEMMAPSAVE = 360,
-    CMD_COMMENT = 361,
-    CMD_LIST = 362,
-    CMD_STOPWATCH = 363,
-    RESET = 364,
-    CMD_EXPORT = 365,
-    CMD_AUTOSTART = 366,
-    CMD_AUTOLOAD = 367,
-    CMD_LABEL_ASGN = 368,
-    L_PAREN = 369,
-    R_PAREN = 370,
-    ARG_IMMEDIATE = 371,
-    REG_A = 372,
-    REG_X = 373,
-    REG_Y = 374,
-    COMMA = 375,
-    INST_SEP = 376,
-    L_BRACKET = 377,
-    R_BRACKET = 378,
-    LESS_THAN = 379,
-    REG_U = 380,
-    REG_S = 381,
-    REG_PC = 382,
-    REG_PCR = 383,
-    REG_B = 384,
-    REG_C = 385,
-    REG_D = 386,
-    REG_E = 387,
-    REG_H = 388,
-    REG_L = 389,
-    REG_AF = 390,
-    REG_BC = 391,
-    REG_DE = 392,
-    REG_HL = 393,
-    REG_IX = 394,
-    REG_IY = 395,
-    REG_SP = 396,
-    REG_IXH = 397,
-    REG_IXL = 398,
-    REG_IYH = 399,
-    REG_IYL = 400,
-    PLUS = 401,
-    MINUS = 402,
-    STRING = 403,
-    FILENAME = 404,
-    R_O_L = 405,
-    OPCODE = 406,
-    LABEL = 407,
-    BANKNAME = 408,
-    CPUTYPE = 409,
-    MON_REGISTER = 410,
-    COMPARE_OP = 411,
-    RADIX_TYPE = 412,
-    INPUT_SPEC = 413,
-    CMD_CHECKPT_ON = 414,
-    CMD_CHECKPT_OFF = 415,
-    TOGGLE = 416,
-    MASK = 417
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    H_NUMBER = 258,                /* H_NUMBER  */
+    D_NUMBER = 259,                /* D_NUMBER  */
+    O_NUMBER = 260,                /* O_NUMBER  */
+    B_NUMBER = 261,                /* B_NUMBER  */
+    CONVERT_OP = 262,              /* CONVERT_OP  */
+    B_DATA = 263,                  /* B_DATA  */
+    H_RANGE_GUESS = 264,           /* H_RANGE_GUESS  */
+    D_NUMBER_GUESS = 265,          /* D_NUMBER_GUESS  */
+    O_NUMBER_GUESS = 266,          /* O_NUMBER_GUESS  */
+    B_NUMBER_GUESS = 267,          /* B_NUMBER_GUESS  */
+    BAD_CMD = 268,                 /* BAD_CMD  */
+    MEM_OP = 269,                  /* MEM_OP  */
+    IF = 270,                      /* IF  */
+    MEM_COMP = 271,                /* MEM_COMP  */
+    MEM_DISK8 = 272,               /* MEM_DISK8  */
+    MEM_DISK9 = 273,               /* MEM_DISK9  */
+    MEM_DISK10 = 274,              /* MEM_DISK10  */
+    MEM_DISK11 = 275,              /* MEM_DISK11  */
+    EQUALS = 276,                  /* EQUALS  */
+    TRAIL = 277,                   /* TRAIL  */
+    CMD_SEP = 278,                 /* CMD_SEP  */
+    LABEL_ASGN_COMMENT = 279,      /* LABEL_ASGN_COMMENT  */
+    CMD_SIDEFX = 280,              /* CMD_SIDEFX  */
+    CMD_RETURN = 281,              /* CMD_RETURN  */
+    CMD_BLOCK_READ = 282,          /* CMD_BLOCK_READ  */
+    CMD_BLOCK_WRITE = 283,         /* CMD_BLOCK_WRITE  */
+    CMD_UP = 284,                  /* CMD_UP  */
+    CMD_DOWN = 285,                /* CMD_DOWN  */
+    CMD_LOAD = 286,                /* CMD_LOAD  */
+    CMD_SAVE = 287,                /* CMD_SAVE  */
+    CMD_VERIFY = 288,              /* CMD_VERIFY  */
+    CMD_IGNORE = 289,              /* CMD_IGNORE  */
+    CMD_HUNT = 290,                /* CMD_HUNT  */
+    CMD_FILL = 291,                /* CMD_FILL  */
+    CMD_MOVE = 292,                /* CMD_MOVE  */
+    CMD_GOTO = 293,                /* CMD_GOTO  */
+    CMD_REGISTERS = 294,           /* CMD_REGISTERS  */
+    CMD_READSPACE = 295,           /* CMD_READSPACE  */
+    CMD_WRITESPACE = 296,          /* CMD_WRITESPACE  */
+    CMD_RADIX = 297,               /* CMD_RADIX  */
+    CMD_MEM_DISPLAY = 298,         /* CMD_MEM_DISPLAY  */
+    CMD_BREAK = 299,               /* CMD_BREAK  */
+    CMD_TRACE = 300,               /* CMD_TRACE  */
+    CMD_IO = 301,                  /* CMD_IO  */
+    CMD_BRMON = 302,               /* CMD_BRMON  */
+    CMD_COMPARE = 303,             /* CMD_COMPARE  */
+    CMD_DUMP = 304,                /* CMD_DUMP  */
+    CMD_UNDUMP = 305,              /* CMD_UNDUMP  */
+    CMD_EXIT = 306,                /* CMD_EXIT  */
+    CMD_DELETE = 307,              /* CMD_DELETE  */
+    CMD_CONDITION = 308,           /* CMD_CONDITION  */
+    CMD_COMMAND = 309,             /* CMD_COMMAND  */
+    CMD_ASSEMBLE = 310,            /* CMD_ASSEMBLE  */
+    CMD_DISASSEMBLE = 311,         /* CMD_DISASSEMBLE  */
+    CMD_NEXT = 312,                /* CMD_NEXT  */
+    CMD_STEP = 313,                /* CMD_STEP  */
+    CMD_PRINT = 314,               /* CMD_PRINT  */
+    CMD_DEVICE = 315,              /* CMD_DEVICE  */
+    CMD_HELP = 316,                /* CMD_HELP  */
+    CMD_WATCH = 317,               /* CMD_WATCH  */
+    CMD_DISK = 318,                /* CMD_DISK  */
+    CMD_QUIT = 319,                /* CMD_QUIT  */
+    CMD_CHDIR = 320,               /* CMD_CHDIR  */
+    CMD_BANK = 321,                /* CMD_BANK  */
+    CMD_LOAD_LABELS = 322,         /* CMD_LOAD_LABELS  */
+    CMD_SAVE_LABELS = 323,         /* CMD_SAVE_LABELS  */
+    CMD_ADD_LABEL = 324,           /* CMD_ADD_LABEL  */
+    CMD_DEL_LABEL = 325,           /* CMD_DEL_LABEL  */
+    CMD_SHOW_LABELS = 326,         /* CMD_SHOW_LABELS  */
+    CMD_CLEAR_LABELS = 327,        /* CMD_CLEAR_LABELS  */
+    CMD_RECORD = 328,              /* CMD_RECORD  */
+    CMD_MON_STOP = 329,            /* CMD_MON_STOP  */
+    CMD_PLAYBACK = 330,            /* CMD_PLAYBACK  */
+    CMD_CHAR_DISPLAY = 331,        /* CMD_CHAR_DISPLAY  */
+    CMD_SPRITE_DISPLAY = 332,      /* CMD_SPRITE_DISPLAY  */
+    CMD_TEXT_DISPLAY = 333,        /* CMD_TEXT_DISPLAY  */
+    CMD_SCREENCODE_DISPLAY = 334,  /* CMD_SCREENCODE_DISPLAY  */
+    CMD_ENTER_DATA = 335,          /* CMD_ENTER_DATA  */
+    CMD_ENTER_BIN_DATA = 336,      /* CMD_ENTER_BIN_DATA  */
+    CMD_KEYBUF = 337,              /* CMD_KEYBUF  */
+    CMD_BLOAD = 338,               /* CMD_BLOAD  */
+    CMD_BSAVE = 339,               /* CMD_BSAVE  */
+    CMD_SCREEN = 340,              /* CMD_SCREEN  */
+    CMD_UNTIL = 341,               /* CMD_UNTIL  */
+    CMD_CPU = 342,                 /* CMD_CPU  */
+    CMD_YYDEBUG = 343,             /* CMD_YYDEBUG  */
+    CMD_BACKTRACE = 344,           /* CMD_BACKTRACE  */
+    CMD_SCREENSHOT = 345,          /* CMD_SCREENSHOT  */
+    CMD_PWD = 346,                 /* CMD_PWD  */
+    CMD_DIR = 347,                 /* CMD_DIR  */
+    CMD_RESOURCE_GET = 348,        /* CMD_RESOURCE_GET  */
+    CMD_RESOURCE_SET = 349,        /* CMD_RESOURCE_SET  */
+    CMD_LOAD_RESOURCES = 350,      /* CMD_LOAD_RESOURCES  */
+    CMD_SAVE_RESOURCES = 351,      /* CMD_SAVE_RESOURCES  */
+    CMD_ATTACH = 352,              /* CMD_ATTACH  */
+    CMD_DETACH = 353,              /* CMD_DETACH  */
+    CMD_MON_RESET = 354,           /* CMD_MON_RESET  */
+    CMD_TAPECTRL = 355,            /* CMD_TAPECTRL  */
+    CMD_CARTFREEZE = 356,          /* CMD_CARTFREEZE  */
+    CMD_CPUHISTORY = 357,          /* CMD_CPUHISTORY  */
+    CMD_MEMMAPZAP = 358,           /* CMD_MEMMAPZAP  */
+    CMD_MEMMAPSHOW = 359,          /* CMD_MEMMAPSHOW  */
+    CMD_MEMMAPSAVE = 360,          /* CMD_MEMMAPSAVE  */
+    CMD_COMMENT = 361,             /* CMD_COMMENT  */
+    CMD_LIST = 362,                /* CMD_LIST  */
+    CMD_STOPWATCH = 363,           /* CMD_STOPWATCH  */
+    RESET = 364,                   /* RESET  */
+    CMD_HOSTTIMERS = 365,          /* CMD_HOSTTIMERS  */
+    CMD_EXPORT = 366,              /* CMD_EXPORT  */
+    CMD_AUTOSTART = 367,           /* CMD_AUTOSTART  */
+    CMD_AUTOLOAD = 368,            /* CMD_AUTOLOAD  */
+    CMD_LABEL_ASGN = 369,          /* CMD_LABEL_ASGN  */
+    L_PAREN = 370,                 /* L_PAREN  */
+    R_PAREN = 371,                 /* R_PAREN  */
+    ARG_IMMEDIATE = 372,           /* ARG_IMMEDIATE  */
+    REG_A = 373,                   /* REG_A  */
+    REG_X = 374,                   /* REG_X  */
+    REG_Y = 375,                   /* REG_Y  */
+    COMMA = 376,                   /* COMMA  */
+    INST_SEP = 377,                /* INST_SEP  */
+    L_BRACKET = 378,               /* L_BRACKET  */
+    R_BRACKET = 379,               /* R_BRACKET  */
+    LESS_THAN = 380,               /* LESS_THAN  */
+    REG_U = 381,                   /* REG_U  */
+    REG_S = 382,                   /* REG_S  */
+    REG_PC = 383,                  /* REG_PC  */
+    REG_PCR = 384,                 /* REG_PCR  */
+    REG_B = 385,                   /* REG_B  */
+    REG_C = 386,                   /* REG_C  */
+    REG_D = 387,                   /* REG_D  */
+    REG_E = 388,                   /* REG_E  */
+    REG_H = 389,                   /* REG_H  */
+    REG_L = 390,                   /* REG_L  */
+    REG_AF = 391,                  /* REG_AF  */
+    REG_BC = 392,                  /* REG_BC  */
+    REG_DE = 393,                  /* REG_DE  */
+    REG_HL = 394,                  /* REG_HL  */
+    REG_IX = 395,                  /* REG_IX  */
+    REG_IY = 396,                  /* REG_IY  */
+    REG_SP = 397,                  /* REG_SP  */
+    REG_IXH = 398,                 /* REG_IXH  */
+    REG_IXL = 399,                 /* REG_IXL  */
+    REG_IYH = 400,                 /* REG_IYH  */
+    REG_IYL = 401,                 /* REG_IYL  */
+    PLUS = 402,                    /* PLUS  */
+    MINUS = 403,                   /* MINUS  */
+    STRING = 404,                  /* STRING  */
+    FILENAME = 405,                /* FILENAME  */
+    R_O_L = 406,                   /* R_O_L  */
+    OPCODE = 407,                  /* OPCODE  */
+    LABEL = 408,                   /* LABEL  */
+    BANKNAME = 409,                /* BANKNAME  */
+    CPUTYPE = 410,                 /* CPUTYPE  */
+    MON_REGISTER = 411,            /* MON_REGISTER  */
+    COMPARE_OP = 412,              /* COMPARE_OP  */
+    RADIX_TYPE = 413,              /* RADIX_TYPE  */
+    INPUT_SPEC = 414,              /* INPUT_SPEC  */
+    CMD_CHECKPT_ON = 415,          /* CMD_CHECKPT_ON  */
+    CMD_CHECKPT_OFF = 416,         /* CMD_CHECKPT_OFF  */
+    TOGGLE = 417,                  /* TOGGLE  */
+    MASK = 418                     /* MASK  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define H_NUMBER 258
 #define D_NUMBER 259
 #define O_NUMBER 260
@@ -497,66 +517,66 @@ extern int yydebug;
 #define CMD_LIST 362
 #define CMD_STOPWATCH 363
 #define RESET 364
-#define CMD_EXPORT 365
-#define CMD_AUTOSTART 366
-#define CMD_AUTOLOAD 367
-#define CMD_LABEL_ASGN 368
-#define L_PAREN 369
-#define R_PAREN 370
-#define ARG_IMMEDIATE 371
-#define REG_A 372
-#define REG_X 373
-#define REG_Y 374
-#define COMMA 375
-#define INST_SEP 376
-#define L_BRACKET 377
-#define R_BRACKET 378
-#define LESS_THAN 379
-#define REG_U 380
-#define REG_S 381
-#define REG_PC 382
-#define REG_PCR 383
-#define REG_B 384
-#define REG_C 385
-#define REG_D 386
-#define REG_E 387
-#define REG_H 388
-#define REG_L 389
-#define REG_AF 390
-#define REG_BC 391
-#define REG_DE 392
-#define REG_HL 393
-#define REG_IX 394
-#define REG_IY 395
-#define REG_SP 396
-#define REG_IXH 397
-#define REG_IXL 398
-#define REG_IYH 399
-#define REG_IYL 400
-#define PLUS 401
-#define MINUS 402
-#define STRING 403
-#define FILENAME 404
-#define R_O_L 405
-#define OPCODE 406
-#define LABEL 407
-#define BANKNAME 408
-#define CPUTYPE 409
-#define MON_REGISTER 410
-#define COMPARE_OP 411
-#define RADIX_TYPE 412
-#define INPUT_SPEC 413
-#define CMD_CHECKPT_ON 414
-#define CMD_CHECKPT_OFF 415
-#define TOGGLE 416
-#define MASK 417
+#define CMD_HOSTTIMERS 365
+#define CMD_EXPORT 366
+#define CMD_AUTOSTART 367
+#define CMD_AUTOLOAD 368
+#define CMD_LABEL_ASGN 369
+#define L_PAREN 370
+#define R_PAREN 371
+#define ARG_IMMEDIATE 372
+#define REG_A 373
+#define REG_X 374
+#define REG_Y 375
+#define COMMA 376
+#define INST_SEP 377
+#define L_BRACKET 378
+#define R_BRACKET 379
+#define LESS_THAN 380
+#define REG_U 381
+#define REG_S 382
+#define REG_PC 383
+#define REG_PCR 384
+#define REG_B 385
+#define REG_C 386
+#define REG_D 387
+#define REG_E 388
+#define REG_H 389
+#define REG_L 390
+#define REG_AF 391
+#define REG_BC 392
+#define REG_DE 393
+#define REG_HL 394
+#define REG_IX 395
+#define REG_IY 396
+#define REG_SP 397
+#define REG_IXH 398
+#define REG_IXL 399
+#define REG_IYH 400
+#define REG_IYL 401
+#define PLUS 402
+#define MINUS 403
+#define STRING 404
+#define FILENAME 405
+#define R_O_L 406
+#define OPCODE 407
+#define LABEL 408
+#define BANKNAME 409
+#define CPUTYPE 410
+#define MON_REGISTER 411
+#define COMPARE_OP 412
+#define RADIX_TYPE 413
+#define INPUT_SPEC 414
+#define CMD_CHECKPT_ON 415
+#define CMD_CHECKPT_OFF 416
+#define TOGGLE 417
+#define MASK 418
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE YYSTYPE;
 union YYSTYPE
 {
-#line 131 "mon_parse.y" /* yacc.c:355  */
+#line 131 "mon_parse.y"
 
     MON_ADDR a;
     MON_ADDR range[2];
@@ -569,8 +589,10 @@ union YYSTYPE
     char *str;
     asm_mode_addr_info_t mode;
 
-#line 573 "mon_parse.c" /* yacc.c:355  */
+#line 593 "mon_parse.c"
+
 };
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
 #endif
@@ -578,40 +600,331 @@ union YYSTYPE
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_MON_PARSE_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_H_NUMBER = 3,                   /* H_NUMBER  */
+  YYSYMBOL_D_NUMBER = 4,                   /* D_NUMBER  */
+  YYSYMBOL_O_NUMBER = 5,                   /* O_NUMBER  */
+  YYSYMBOL_B_NUMBER = 6,                   /* B_NUMBER  */
+  YYSYMBOL_CONVERT_OP = 7,                 /* CONVERT_OP  */
+  YYSYMBOL_B_DATA = 8,                     /* B_DATA  */
+  YYSYMBOL_H_RANGE_GUESS = 9,              /* H_RANGE_GUESS  */
+  YYSYMBOL_D_NUMBER_GUESS = 10,            /* D_NUMBER_GUESS  */
+  YYSYMBOL_O_NUMBER_GUESS = 11,            /* O_NUMBER_GUESS  */
+  YYSYMBOL_B_NUMBER_GUESS = 12,            /* B_NUMBER_GUESS  */
+  YYSYMBOL_BAD_CMD = 13,                   /* BAD_CMD  */
+  YYSYMBOL_MEM_OP = 14,                    /* MEM_OP  */
+  YYSYMBOL_IF = 15,                        /* IF  */
+  YYSYMBOL_MEM_COMP = 16,                  /* MEM_COMP  */
+  YYSYMBOL_MEM_DISK8 = 17,                 /* MEM_DISK8  */
+  YYSYMBOL_MEM_DISK9 = 18,                 /* MEM_DISK9  */
+  YYSYMBOL_MEM_DISK10 = 19,                /* MEM_DISK10  */
+  YYSYMBOL_MEM_DISK11 = 20,                /* MEM_DISK11  */
+  YYSYMBOL_EQUALS = 21,                    /* EQUALS  */
+  YYSYMBOL_TRAIL = 22,                     /* TRAIL  */
+  YYSYMBOL_CMD_SEP = 23,                   /* CMD_SEP  */
+  YYSYMBOL_LABEL_ASGN_COMMENT = 24,        /* LABEL_ASGN_COMMENT  */
+  YYSYMBOL_CMD_SIDEFX = 25,                /* CMD_SIDEFX  */
+  YYSYMBOL_CMD_RETURN = 26,                /* CMD_RETURN  */
+  YYSYMBOL_CMD_BLOCK_READ = 27,            /* CMD_BLOCK_READ  */
+  YYSYMBOL_CMD_BLOCK_WRITE = 28,           /* CMD_BLOCK_WRITE  */
+  YYSYMBOL_CMD_UP = 29,                    /* CMD_UP  */
+  YYSYMBOL_CMD_DOWN = 30,                  /* CMD_DOWN  */
+  YYSYMBOL_CMD_LOAD = 31,                  /* CMD_LOAD  */
+  YYSYMBOL_CMD_SAVE = 32,                  /* CMD_SAVE  */
+  YYSYMBOL_CMD_VERIFY = 33,                /* CMD_VERIFY  */
+  YYSYMBOL_CMD_IGNORE = 34,                /* CMD_IGNORE  */
+  YYSYMBOL_CMD_HUNT = 35,                  /* CMD_HUNT  */
+  YYSYMBOL_CMD_FILL = 36,                  /* CMD_FILL  */
+  YYSYMBOL_CMD_MOVE = 37,                  /* CMD_MOVE  */
+  YYSYMBOL_CMD_GOTO = 38,                  /* CMD_GOTO  */
+  YYSYMBOL_CMD_REGISTERS = 39,             /* CMD_REGISTERS  */
+  YYSYMBOL_CMD_READSPACE = 40,             /* CMD_READSPACE  */
+  YYSYMBOL_CMD_WRITESPACE = 41,            /* CMD_WRITESPACE  */
+  YYSYMBOL_CMD_RADIX = 42,                 /* CMD_RADIX  */
+  YYSYMBOL_CMD_MEM_DISPLAY = 43,           /* CMD_MEM_DISPLAY  */
+  YYSYMBOL_CMD_BREAK = 44,                 /* CMD_BREAK  */
+  YYSYMBOL_CMD_TRACE = 45,                 /* CMD_TRACE  */
+  YYSYMBOL_CMD_IO = 46,                    /* CMD_IO  */
+  YYSYMBOL_CMD_BRMON = 47,                 /* CMD_BRMON  */
+  YYSYMBOL_CMD_COMPARE = 48,               /* CMD_COMPARE  */
+  YYSYMBOL_CMD_DUMP = 49,                  /* CMD_DUMP  */
+  YYSYMBOL_CMD_UNDUMP = 50,                /* CMD_UNDUMP  */
+  YYSYMBOL_CMD_EXIT = 51,                  /* CMD_EXIT  */
+  YYSYMBOL_CMD_DELETE = 52,                /* CMD_DELETE  */
+  YYSYMBOL_CMD_CONDITION = 53,             /* CMD_CONDITION  */
+  YYSYMBOL_CMD_COMMAND = 54,               /* CMD_COMMAND  */
+  YYSYMBOL_CMD_ASSEMBLE = 55,              /* CMD_ASSEMBLE  */
+  YYSYMBOL_CMD_DISASSEMBLE = 56,           /* CMD_DISASSEMBLE  */
+  YYSYMBOL_CMD_NEXT = 57,                  /* CMD_NEXT  */
+  YYSYMBOL_CMD_STEP = 58,                  /* CMD_STEP  */
+  YYSYMBOL_CMD_PRINT = 59,                 /* CMD_PRINT  */
+  YYSYMBOL_CMD_DEVICE = 60,                /* CMD_DEVICE  */
+  YYSYMBOL_CMD_HELP = 61,                  /* CMD_HELP  */
+  YYSYMBOL_CMD_WATCH = 62,                 /* CMD_WATCH  */
+  YYSYMBOL_CMD_DISK = 63,                  /* CMD_DISK  */
+  YYSYMBOL_CMD_QUIT = 64,                  /* CMD_QUIT  */
+  YYSYMBOL_CMD_CHDIR = 65,                 /* CMD_CHDIR  */
+  YYSYMBOL_CMD_BANK = 66,                  /* CMD_BANK  */
+  YYSYMBOL_CMD_LOAD_LABELS = 67,           /* CMD_LOAD_LABELS  */
+  YYSYMBOL_CMD_SAVE_LABELS = 68,           /* CMD_SAVE_LABELS  */
+  YYSYMBOL_CMD_ADD_LABEL = 69,             /* CMD_ADD_LABEL  */
+  YYSYMBOL_CMD_DEL_LABEL = 70,             /* CMD_DEL_LABEL  */
+  YYSYMBOL_CMD_SHOW_LABELS = 71,           /* CMD_SHOW_LABELS  */
+  YYSYMBOL_CMD_CLEAR_LABELS = 72,          /* CMD_CLEAR_LABELS  */
+  YYSYMBOL_CMD_RECORD = 73,                /* CMD_RECORD  */
+  YYSYMBOL_CMD_MON_STOP = 74,              /* CMD_MON_STOP  */
+  YYSYMBOL_CMD_PLAYBACK = 75,              /* CMD_PLAYBACK  */
+  YYSYMBOL_CMD_CHAR_DISPLAY = 76,          /* CMD_CHAR_DISPLAY  */
+  YYSYMBOL_CMD_SPRITE_DISPLAY = 77,        /* CMD_SPRITE_DISPLAY  */
+  YYSYMBOL_CMD_TEXT_DISPLAY = 78,          /* CMD_TEXT_DISPLAY  */
+  YYSYMBOL_CMD_SCREENCODE_DISPLAY = 79,    /* CMD_SCREENCODE_DISPLAY  */
+  YYSYMBOL_CMD_ENTER_DATA = 80,            /* CMD_ENTER_DATA  */
+  YYSYMBOL_CMD_ENTER_BIN_DATA = 81,        /* CMD_ENTER_BIN_DATA  */
+  YYSYMBOL_CMD_KEYBUF = 82,                /* CMD_KEYBUF  */
+  YYSYMBOL_CMD_BLOAD = 83,                 /* CMD_BLOAD  */
+  YYSYMBOL_CMD_BSAVE = 84,                 /* CMD_BSAVE  */
+  YYSYMBOL_CMD_SCREEN = 85,                /* CMD_SCREEN  */
+  YYSYMBOL_CMD_UNTIL = 86,                 /* CMD_UNTIL  */
+  YYSYMBOL_CMD_CPU = 87,                   /* CMD_CPU  */
+  YYSYMBOL_CMD_YYDEBUG = 88,               /* CMD_YYDEBUG  */
+  YYSYMBOL_CMD_BACKTRACE = 89,             /* CMD_BACKTRACE  */
+  YYSYMBOL_CMD_SCREENSHOT = 90,            /* CMD_SCREENSHOT  */
+  YYSYMBOL_CMD_PWD = 91,                   /* CMD_PWD  */
+  YYSYMBOL_CMD_DIR = 92,                   /* CMD_DIR  */
+  YYSYMBOL_CMD_RESOURCE_GET = 93,          /* CMD_RESOURCE_GET  */
+  YYSYMBOL_CMD_RESOURCE_SET = 94,          /* CMD_RESOURCE_SET  */
+  YYSYMBOL_CMD_LOAD_RESOURCES = 95,        /* CMD_LOAD_RESOURCES  */
+  YYSYMBOL_CMD_SAVE_RESOURCES = 96,        /* CMD_SAVE_RESOURCES  */
+  YYSYMBOL_CMD_ATTACH = 97,                /* CMD_ATTACH  */
+  YYSYMBOL_CMD_DETACH = 98,                /* CMD_DETACH  */
+  YYSYMBOL_CMD_MON_RESET = 99,             /* CMD_MON_RESET  */
+  YYSYMBOL_CMD_TAPECTRL = 100,             /* CMD_TAPECTRL  */
+  YYSYMBOL_CMD_CARTFREEZE = 101,           /* CMD_CARTFREEZE  */
+  YYSYMBOL_CMD_CPUHISTORY = 102,           /* CMD_CPUHISTORY  */
+  YYSYMBOL_CMD_MEMMAPZAP = 103,            /* CMD_MEMMAPZAP  */
+  YYSYMBOL_CMD_MEMMAPSHOW = 104,           /* CMD_MEMMAPSHOW  */
+  YYSYMBOL_CMD_MEMMAPSAVE = 105,           /* CMD_MEMMAPSAVE  */
+  YYSYMBOL_CMD_COMMENT = 106,              /* CMD_COMMENT  */
+  YYSYMBOL_CMD_LIST = 107,                 /* CMD_LIST  */
+  YYSYMBOL_CMD_STOPWATCH = 108,            /* CMD_STOPWATCH  */
+  YYSYMBOL_RESET = 109,                    /* RESET  */
+  YYSYMBOL_CMD_HOSTTIMERS = 110,           /* CMD_HOSTTIMERS  */
+  YYSYMBOL_CMD_EXPORT = 111,               /* CMD_EXPORT  */
+  YYSYMBOL_CMD_AUTOSTART = 112,            /* CMD_AUTOSTART  */
+  YYSYMBOL_CMD_AUTOLOAD = 113,             /* CMD_AUTOLOAD  */
+  YYSYMBOL_CMD_LABEL_ASGN = 114,           /* CMD_LABEL_ASGN  */
+  YYSYMBOL_L_PAREN = 115,                  /* L_PAREN  */
+  YYSYMBOL_R_PAREN = 116,                  /* R_PAREN  */
+  YYSYMBOL_ARG_IMMEDIATE = 117,            /* ARG_IMMEDIATE  */
+  YYSYMBOL_REG_A = 118,                    /* REG_A  */
+  YYSYMBOL_REG_X = 119,                    /* REG_X  */
+  YYSYMBOL_REG_Y = 120,                    /* REG_Y  */
+  YYSYMBOL_COMMA = 121,                    /* COMMA  */
+  YYSYMBOL_INST_SEP = 122,                 /* INST_SEP  */
+  YYSYMBOL_L_BRACKET = 123,                /* L_BRACKET  */
+  YYSYMBOL_R_BRACKET = 124,                /* R_BRACKET  */
+  YYSYMBOL_LESS_THAN = 125,                /* LESS_THAN  */
+  YYSYMBOL_REG_U = 126,                    /* REG_U  */
+  YYSYMBOL_REG_S = 127,                    /* REG_S  */
+  YYSYMBOL_REG_PC = 128,                   /* REG_PC  */
+  YYSYMBOL_REG_PCR = 129,                  /* REG_PCR  */
+  YYSYMBOL_REG_B = 130,                    /* REG_B  */
+  YYSYMBOL_REG_C = 131,                    /* REG_C  */
+  YYSYMBOL_REG_D = 132,                    /* REG_D  */
+  YYSYMBOL_REG_E = 133,                    /* REG_E  */
+  YYSYMBOL_REG_H = 134,                    /* REG_H  */
+  YYSYMBOL_REG_L = 135,                    /* REG_L  */
+  YYSYMBOL_REG_AF = 136,                   /* REG_AF  */
+  YYSYMBOL_REG_BC = 137,                   /* REG_BC  */
+  YYSYMBOL_REG_DE = 138,                   /* REG_DE  */
+  YYSYMBOL_REG_HL = 139,                   /* REG_HL  */
+  YYSYMBOL_REG_IX = 140,                   /* REG_IX  */
+  YYSYMBOL_REG_IY = 141,                   /* REG_IY  */
+  YYSYMBOL_REG_SP = 142,                   /* REG_SP  */
+  YYSYMBOL_REG_IXH = 143,                  /* REG_IXH  */
+  YYSYMBOL_REG_IXL = 144,                  /* REG_IXL  */
+  YYSYMBOL_REG_IYH = 145,                  /* REG_IYH  */
+  YYSYMBOL_REG_IYL = 146,                  /* REG_IYL  */
+  YYSYMBOL_PLUS = 147,                     /* PLUS  */
+  YYSYMBOL_MINUS = 148,                    /* MINUS  */
+  YYSYMBOL_STRING = 149,                   /* STRING  */
+  YYSYMBOL_FILENAME = 150,                 /* FILENAME  */
+  YYSYMBOL_R_O_L = 151,                    /* R_O_L  */
+  YYSYMBOL_OPCODE = 152,                   /* OPCODE  */
+  YYSYMBOL_LABEL = 153,                    /* LABEL  */
+  YYSYMBOL_BANKNAME = 154,                 /* BANKNAME  */
+  YYSYMBOL_CPUTYPE = 155,                  /* CPUTYPE  */
+  YYSYMBOL_MON_REGISTER = 156,             /* MON_REGISTER  */
+  YYSYMBOL_COMPARE_OP = 157,               /* COMPARE_OP  */
+  YYSYMBOL_RADIX_TYPE = 158,               /* RADIX_TYPE  */
+  YYSYMBOL_INPUT_SPEC = 159,               /* INPUT_SPEC  */
+  YYSYMBOL_CMD_CHECKPT_ON = 160,           /* CMD_CHECKPT_ON  */
+  YYSYMBOL_CMD_CHECKPT_OFF = 161,          /* CMD_CHECKPT_OFF  */
+  YYSYMBOL_TOGGLE = 162,                   /* TOGGLE  */
+  YYSYMBOL_MASK = 163,                     /* MASK  */
+  YYSYMBOL_164_ = 164,                     /* '+'  */
+  YYSYMBOL_165_ = 165,                     /* '-'  */
+  YYSYMBOL_166_ = 166,                     /* '*'  */
+  YYSYMBOL_167_ = 167,                     /* '/'  */
+  YYSYMBOL_168_ = 168,                     /* '('  */
+  YYSYMBOL_169_ = 169,                     /* ')'  */
+  YYSYMBOL_YYACCEPT = 170,                 /* $accept  */
+  YYSYMBOL_top_level = 171,                /* top_level  */
+  YYSYMBOL_command_list = 172,             /* command_list  */
+  YYSYMBOL_end_cmd = 173,                  /* end_cmd  */
+  YYSYMBOL_command = 174,                  /* command  */
+  YYSYMBOL_machine_state_rules = 175,      /* machine_state_rules  */
+  YYSYMBOL_register_mod = 176,             /* register_mod  */
+  YYSYMBOL_symbol_table_rules = 177,       /* symbol_table_rules  */
+  YYSYMBOL_asm_rules = 178,                /* asm_rules  */
+  YYSYMBOL_179_1 = 179,                    /* $@1  */
+  YYSYMBOL_memory_rules = 180,             /* memory_rules  */
+  YYSYMBOL_checkpoint_rules = 181,         /* checkpoint_rules  */
+  YYSYMBOL_checkpoint_control_rules = 182, /* checkpoint_control_rules  */
+  YYSYMBOL_monitor_state_rules = 183,      /* monitor_state_rules  */
+  YYSYMBOL_monitor_misc_rules = 184,       /* monitor_misc_rules  */
+  YYSYMBOL_disk_rules = 185,               /* disk_rules  */
+  YYSYMBOL_cmd_file_rules = 186,           /* cmd_file_rules  */
+  YYSYMBOL_data_entry_rules = 187,         /* data_entry_rules  */
+  YYSYMBOL_monitor_debug_rules = 188,      /* monitor_debug_rules  */
+  YYSYMBOL_rest_of_line = 189,             /* rest_of_line  */
+  YYSYMBOL_opt_rest_of_line = 190,         /* opt_rest_of_line  */
+  YYSYMBOL_filename = 191,                 /* filename  */
+  YYSYMBOL_device_num = 192,               /* device_num  */
+  YYSYMBOL_mem_op = 193,                   /* mem_op  */
+  YYSYMBOL_opt_mem_op = 194,               /* opt_mem_op  */
+  YYSYMBOL_register = 195,                 /* register  */
+  YYSYMBOL_reg_list = 196,                 /* reg_list  */
+  YYSYMBOL_reg_asgn = 197,                 /* reg_asgn  */
+  YYSYMBOL_checkpt_num = 198,              /* checkpt_num  */
+  YYSYMBOL_address_opt_range = 199,        /* address_opt_range  */
+  YYSYMBOL_address_range = 200,            /* address_range  */
+  YYSYMBOL_opt_address = 201,              /* opt_address  */
+  YYSYMBOL_address = 202,                  /* address  */
+  YYSYMBOL_opt_sep = 203,                  /* opt_sep  */
+  YYSYMBOL_memspace = 204,                 /* memspace  */
+  YYSYMBOL_memloc = 205,                   /* memloc  */
+  YYSYMBOL_memaddr = 206,                  /* memaddr  */
+  YYSYMBOL_expression = 207,               /* expression  */
+  YYSYMBOL_opt_if_cond_expr = 208,         /* opt_if_cond_expr  */
+  YYSYMBOL_cond_expr = 209,                /* cond_expr  */
+  YYSYMBOL_compare_operand = 210,          /* compare_operand  */
+  YYSYMBOL_data_list = 211,                /* data_list  */
+  YYSYMBOL_data_element = 212,             /* data_element  */
+  YYSYMBOL_hunt_list = 213,                /* hunt_list  */
+  YYSYMBOL_hunt_element = 214,             /* hunt_element  */
+  YYSYMBOL_value = 215,                    /* value  */
+  YYSYMBOL_d_number = 216,                 /* d_number  */
+  YYSYMBOL_guess_default = 217,            /* guess_default  */
+  YYSYMBOL_number = 218,                   /* number  */
+  YYSYMBOL_assembly_instr_list = 219,      /* assembly_instr_list  */
+  YYSYMBOL_assembly_instruction = 220,     /* assembly_instruction  */
+  YYSYMBOL_post_assemble = 221,            /* post_assemble  */
+  YYSYMBOL_asm_operand_mode = 222,         /* asm_operand_mode  */
+  YYSYMBOL_index_reg = 223,                /* index_reg  */
+  YYSYMBOL_index_ureg = 224                /* index_ureg  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
-/* Copy the second part of user declarations.  */
 
-#line 588 "mon_parse.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -619,15 +932,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -641,47 +967,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -694,8 +1016,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -760,8 +1096,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -770,17 +1105,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -793,11 +1128,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -809,12 +1144,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -824,36 +1159,39 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  310
+#define YYFINAL  313
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1725
+#define YYLAST   1752
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  169
+#define YYNTOKENS  170
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  55
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  312
+#define YYNRULES  314
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  621
+#define YYNSTATES  625
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   418
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   417
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     167,   168,   165,   163,     2,   164,     2,   166,     2,     2,
+     168,   169,   166,   164,     2,   165,     2,   167,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -890,12 +1228,12 @@ static const yytype_uint8 yytranslate[] =
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162
+     155,   156,   157,   158,   159,   160,   161,   162,   163
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
        0,   195,   195,   196,   197,   200,   201,   204,   205,   206,
      209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
@@ -910,69 +1248,77 @@ static const yytype_uint16 yyrline[] =
      424,   426,   428,   430,   432,   434,   436,   438,   442,   444,
      449,   451,   469,   471,   473,   475,   479,   481,   483,   485,
      487,   489,   491,   493,   495,   497,   499,   501,   503,   505,
-     507,   509,   511,   513,   515,   517,   519,   521,   523,   527,
-     529,   531,   533,   535,   537,   539,   541,   543,   545,   547,
-     549,   551,   553,   555,   557,   559,   561,   563,   567,   569,
-     571,   575,   577,   581,   585,   588,   589,   592,   593,   596,
-     597,   600,   601,   604,   605,   608,   614,   622,   623,   626,
-     630,   631,   634,   635,   638,   639,   641,   645,   646,   649,
-     654,   659,   669,   670,   673,   674,   675,   676,   677,   680,
-     682,   684,   685,   686,   687,   688,   689,   690,   693,   694,
-     696,   701,   703,   705,   707,   711,   717,   725,   726,   729,
-     730,   733,   734,   737,   738,   739,   742,   743,   746,   747,
-     748,   749,   752,   753,   754,   757,   758,   759,   760,   761,
-     764,   765,   766,   769,   779,   780,   783,   790,   801,   812,
-     820,   839,   845,   853,   861,   863,   865,   866,   867,   868,
-     869,   870,   871,   873,   875,   877,   879,   880,   881,   882,
-     883,   884,   885,   886,   887,   888,   889,   890,   891,   892,
-     893,   894,   895,   896,   897,   899,   900,   915,   919,   923,
-     927,   931,   935,   939,   943,   947,   959,   974,   978,   982,
-     986,   990,   994,   998,  1002,  1006,  1018,  1023,  1031,  1032,
-    1033,  1034,  1038
+     507,   509,   511,   513,   515,   517,   519,   521,   523,   525,
+     527,   531,   533,   535,   537,   539,   541,   543,   545,   547,
+     549,   551,   553,   555,   557,   559,   561,   563,   565,   567,
+     571,   573,   575,   579,   581,   585,   589,   592,   593,   596,
+     597,   600,   601,   604,   605,   608,   609,   612,   618,   626,
+     627,   630,   634,   635,   638,   639,   642,   643,   645,   649,
+     650,   653,   658,   663,   673,   674,   677,   678,   679,   680,
+     681,   684,   686,   688,   689,   690,   691,   692,   693,   694,
+     697,   698,   700,   705,   707,   709,   711,   715,   721,   729,
+     730,   733,   734,   737,   738,   741,   742,   743,   746,   747,
+     750,   751,   752,   753,   756,   757,   758,   761,   762,   763,
+     764,   765,   768,   769,   770,   773,   783,   784,   787,   794,
+     805,   816,   824,   843,   849,   857,   865,   867,   869,   870,
+     871,   872,   873,   874,   875,   877,   879,   881,   883,   884,
+     885,   886,   887,   888,   889,   890,   891,   892,   893,   894,
+     895,   896,   897,   898,   899,   900,   901,   903,   904,   919,
+     923,   927,   931,   935,   939,   943,   947,   951,   963,   978,
+     982,   986,   990,   994,   998,  1002,  1006,  1010,  1022,  1027,
+    1035,  1036,  1037,  1038,  1042
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "H_NUMBER", "D_NUMBER", "O_NUMBER",
-  "B_NUMBER", "CONVERT_OP", "B_DATA", "H_RANGE_GUESS", "D_NUMBER_GUESS",
-  "O_NUMBER_GUESS", "B_NUMBER_GUESS", "BAD_CMD", "MEM_OP", "IF",
-  "MEM_COMP", "MEM_DISK8", "MEM_DISK9", "MEM_DISK10", "MEM_DISK11",
-  "EQUALS", "TRAIL", "CMD_SEP", "LABEL_ASGN_COMMENT", "CMD_SIDEFX",
-  "CMD_RETURN", "CMD_BLOCK_READ", "CMD_BLOCK_WRITE", "CMD_UP", "CMD_DOWN",
-  "CMD_LOAD", "CMD_SAVE", "CMD_VERIFY", "CMD_IGNORE", "CMD_HUNT",
-  "CMD_FILL", "CMD_MOVE", "CMD_GOTO", "CMD_REGISTERS", "CMD_READSPACE",
-  "CMD_WRITESPACE", "CMD_RADIX", "CMD_MEM_DISPLAY", "CMD_BREAK",
-  "CMD_TRACE", "CMD_IO", "CMD_BRMON", "CMD_COMPARE", "CMD_DUMP",
-  "CMD_UNDUMP", "CMD_EXIT", "CMD_DELETE", "CMD_CONDITION", "CMD_COMMAND",
-  "CMD_ASSEMBLE", "CMD_DISASSEMBLE", "CMD_NEXT", "CMD_STEP", "CMD_PRINT",
-  "CMD_DEVICE", "CMD_HELP", "CMD_WATCH", "CMD_DISK", "CMD_QUIT",
-  "CMD_CHDIR", "CMD_BANK", "CMD_LOAD_LABELS", "CMD_SAVE_LABELS",
-  "CMD_ADD_LABEL", "CMD_DEL_LABEL", "CMD_SHOW_LABELS", "CMD_CLEAR_LABELS",
-  "CMD_RECORD", "CMD_MON_STOP", "CMD_PLAYBACK", "CMD_CHAR_DISPLAY",
-  "CMD_SPRITE_DISPLAY", "CMD_TEXT_DISPLAY", "CMD_SCREENCODE_DISPLAY",
-  "CMD_ENTER_DATA", "CMD_ENTER_BIN_DATA", "CMD_KEYBUF", "CMD_BLOAD",
-  "CMD_BSAVE", "CMD_SCREEN", "CMD_UNTIL", "CMD_CPU", "CMD_YYDEBUG",
-  "CMD_BACKTRACE", "CMD_SCREENSHOT", "CMD_PWD", "CMD_DIR",
-  "CMD_RESOURCE_GET", "CMD_RESOURCE_SET", "CMD_LOAD_RESOURCES",
+  "\"end of file\"", "error", "\"invalid token\"", "H_NUMBER", "D_NUMBER",
+  "O_NUMBER", "B_NUMBER", "CONVERT_OP", "B_DATA", "H_RANGE_GUESS",
+  "D_NUMBER_GUESS", "O_NUMBER_GUESS", "B_NUMBER_GUESS", "BAD_CMD",
+  "MEM_OP", "IF", "MEM_COMP", "MEM_DISK8", "MEM_DISK9", "MEM_DISK10",
+  "MEM_DISK11", "EQUALS", "TRAIL", "CMD_SEP", "LABEL_ASGN_COMMENT",
+  "CMD_SIDEFX", "CMD_RETURN", "CMD_BLOCK_READ", "CMD_BLOCK_WRITE",
+  "CMD_UP", "CMD_DOWN", "CMD_LOAD", "CMD_SAVE", "CMD_VERIFY", "CMD_IGNORE",
+  "CMD_HUNT", "CMD_FILL", "CMD_MOVE", "CMD_GOTO", "CMD_REGISTERS",
+  "CMD_READSPACE", "CMD_WRITESPACE", "CMD_RADIX", "CMD_MEM_DISPLAY",
+  "CMD_BREAK", "CMD_TRACE", "CMD_IO", "CMD_BRMON", "CMD_COMPARE",
+  "CMD_DUMP", "CMD_UNDUMP", "CMD_EXIT", "CMD_DELETE", "CMD_CONDITION",
+  "CMD_COMMAND", "CMD_ASSEMBLE", "CMD_DISASSEMBLE", "CMD_NEXT", "CMD_STEP",
+  "CMD_PRINT", "CMD_DEVICE", "CMD_HELP", "CMD_WATCH", "CMD_DISK",
+  "CMD_QUIT", "CMD_CHDIR", "CMD_BANK", "CMD_LOAD_LABELS",
+  "CMD_SAVE_LABELS", "CMD_ADD_LABEL", "CMD_DEL_LABEL", "CMD_SHOW_LABELS",
+  "CMD_CLEAR_LABELS", "CMD_RECORD", "CMD_MON_STOP", "CMD_PLAYBACK",
+  "CMD_CHAR_DISPLAY", "CMD_SPRITE_DISPLAY", "CMD_TEXT_DISPLAY",
+  "CMD_SCREENCODE_DISPLAY", "CMD_ENTER_DATA", "CMD_ENTER_BIN_DATA",
+  "CMD_KEYBUF", "CMD_BLOAD", "CMD_BSAVE", "CMD_SCREEN", "CMD_UNTIL",
+  "CMD_CPU", "CMD_YYDEBUG", "CMD_BACKTRACE", "CMD_SCREENSHOT", "CMD_PWD",
+  "CMD_DIR", "CMD_RESOURCE_GET", "CMD_RESOURCE_SET", "CMD_LOAD_RESOURCES",
   "CMD_SAVE_RESOURCES", "CMD_ATTACH", "CMD_DETACH", "CMD_MON_RESET",
   "CMD_TAPECTRL", "CMD_CARTFREEZE", "CMD_CPUHISTORY", "CMD_MEMMAPZAP",
   "CMD_MEMMAPSHOW", "CMD_MEMMAPSAVE", "CMD_COMMENT", "CMD_LIST",
-  "CMD_STOPWATCH", "RESET", "CMD_EXPORT", "CMD_AUTOSTART", "CMD_AUTOLOAD",
-  "CMD_LABEL_ASGN", "L_PAREN", "R_PAREN", "ARG_IMMEDIATE", "REG_A",
-  "REG_X", "REG_Y", "COMMA", "INST_SEP", "L_BRACKET", "R_BRACKET",
-  "LESS_THAN", "REG_U", "REG_S", "REG_PC", "REG_PCR", "REG_B", "REG_C",
-  "REG_D", "REG_E", "REG_H", "REG_L", "REG_AF", "REG_BC", "REG_DE",
-  "REG_HL", "REG_IX", "REG_IY", "REG_SP", "REG_IXH", "REG_IXL", "REG_IYH",
-  "REG_IYL", "PLUS", "MINUS", "STRING", "FILENAME", "R_O_L", "OPCODE",
-  "LABEL", "BANKNAME", "CPUTYPE", "MON_REGISTER", "COMPARE_OP",
-  "RADIX_TYPE", "INPUT_SPEC", "CMD_CHECKPT_ON", "CMD_CHECKPT_OFF",
-  "TOGGLE", "MASK", "'+'", "'-'", "'*'", "'/'", "'('", "')'", "$accept",
-  "top_level", "command_list", "end_cmd", "command", "machine_state_rules",
-  "register_mod", "symbol_table_rules", "asm_rules", "$@1", "memory_rules",
+  "CMD_STOPWATCH", "RESET", "CMD_HOSTTIMERS", "CMD_EXPORT",
+  "CMD_AUTOSTART", "CMD_AUTOLOAD", "CMD_LABEL_ASGN", "L_PAREN", "R_PAREN",
+  "ARG_IMMEDIATE", "REG_A", "REG_X", "REG_Y", "COMMA", "INST_SEP",
+  "L_BRACKET", "R_BRACKET", "LESS_THAN", "REG_U", "REG_S", "REG_PC",
+  "REG_PCR", "REG_B", "REG_C", "REG_D", "REG_E", "REG_H", "REG_L",
+  "REG_AF", "REG_BC", "REG_DE", "REG_HL", "REG_IX", "REG_IY", "REG_SP",
+  "REG_IXH", "REG_IXL", "REG_IYH", "REG_IYL", "PLUS", "MINUS", "STRING",
+  "FILENAME", "R_O_L", "OPCODE", "LABEL", "BANKNAME", "CPUTYPE",
+  "MON_REGISTER", "COMPARE_OP", "RADIX_TYPE", "INPUT_SPEC",
+  "CMD_CHECKPT_ON", "CMD_CHECKPT_OFF", "TOGGLE", "MASK", "'+'", "'-'",
+  "'*'", "'/'", "'('", "')'", "$accept", "top_level", "command_list",
+  "end_cmd", "command", "machine_state_rules", "register_mod",
+  "symbol_table_rules", "asm_rules", "$@1", "memory_rules",
   "checkpoint_rules", "checkpoint_control_rules", "monitor_state_rules",
   "monitor_misc_rules", "disk_rules", "cmd_file_rules", "data_entry_rules",
   "monitor_debug_rules", "rest_of_line", "opt_rest_of_line", "filename",
@@ -984,116 +1330,97 @@ static const char *const yytname[] =
   "guess_default", "number", "assembly_instr_list", "assembly_instruction",
   "post_assemble", "asm_operand_mode", "index_reg", "index_ureg", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,    43,    45,    42,    47,    40,    41
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -400
+#define YYPACT_NINF (-467)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-400)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -194
+#define YYTABLE_NINF (-196)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    1125,   415,  -400,  -400,    19,   277,   415,   415,    80,    80,
-       9,     9,     9,   684,  1502,  1502,  1502,  1393,   568,    14,
-     988,  1082,  1082,  1393,  1502,     9,     9,   277,  1610,   684,
-     684,  1104,  1241,    80,    80,   415,   557,   132,  1082,   -97,
-     277,   -97,   950,   612,   612,  1104,   308,  1044,  1044,     9,
-     277,     9,  1241,  1241,  1241,  1241,  1104,   277,   -97,     9,
-       9,   277,  1241,    44,   277,   277,     9,   277,   -70,  -135,
-     -61,     9,     9,     9,   415,    80,   -31,   277,    80,   277,
-      80,     9,   -70,   543,   332,   277,     9,     9,    73,  1546,
-    1610,  1610,   105,  1261,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,    89,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,   415,  -400,   -37,    39,  -400,  -400,  -400,  -400,
-    -400,  -400,   277,  -400,  -400,   854,   854,  -400,  -400,   415,
-    -400,   415,  -400,  -400,   591,   794,   591,  -400,  -400,  -400,
-    -400,  -400,    80,  -400,  -400,  -400,   -31,   -31,   -31,  -400,
-    -400,  -400,   -31,   -31,  -400,   277,   -31,  -400,   108,   226,
-    -400,   119,   277,  -400,   -31,  -400,   277,  -400,   253,  -400,
-    -400,   110,  1502,  -400,  1502,  -400,   277,   -31,   277,   277,
-    -400,   349,  -400,   277,   124,    42,   126,  -400,   277,  -400,
-     415,  -400,   415,    39,   277,  -400,  -400,   277,  -400,  1502,
-     277,  -400,   277,   277,  -400,   109,   277,   -31,   277,   -31,
-     -31,   277,   -31,  -400,   277,  -400,   277,   277,  -400,   277,
-    -400,   277,  -400,   277,  -400,   277,  -400,   277,  1131,  -400,
-     277,   591,   591,  -400,  -400,   277,   277,  -400,  -400,  -400,
-      80,  -400,  -400,   277,   277,     5,   277,   277,   415,    39,
-    -400,   415,   415,  -400,  -400,   415,  -400,  -400,   415,   -31,
-     277,   414,  -400,   277,   199,   277,  -400,  -400,  1029,  1029,
-    1104,  1556,  1566,    27,  -100,  1584,  1566,    41,  -400,    46,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,    50,  -400,  -400,   277,  -400,   277,
-    -400,  -400,  -400,    28,  -400,   415,   415,   415,   415,  -400,
-    -400,    10,   214,    39,    39,  -400,   268,  1421,  1441,  1484,
-    -400,   415,   781,  1104,  1069,  1131,  1104,  -400,  1566,  1566,
-     500,  -400,  -400,  -400,  1502,  -400,  -400,   149,   149,  -400,
-    1104,  -400,  -400,  -400,  1372,   277,    29,  -400,    32,  -400,
-      39,    39,  -400,  -400,  -400,   149,  -400,  -400,  -400,  -400,
-      33,  -400,     9,  -400,     9,    36,  -400,    45,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  1525,  -400,  -400,
-    -400,   268,  1461,  -400,  -400,  -400,   415,  -400,  -400,   277,
-    -400,  -400,    39,  -400,    39,    39,    39,   819,   415,  -400,
-    -400,  -400,  -400,  1566,  -400,  1566,   374,    91,    95,   113,
-     121,   123,   127,   -56,  -400,   328,  -400,  -400,  -400,  -400,
-     223,    49,  -400,   130,   417,   133,   135,    -4,  -400,   328,
-     328,  1598,  -400,  -400,  -400,  -400,   -29,   -29,  -400,  -400,
-     277,  1104,   277,  -400,  -400,   277,  -400,   277,  -400,   277,
-      39,  -400,  -400,   103,  -400,  -400,  -400,  -400,  -400,  1525,
-     277,  -400,  -400,   277,  1372,   277,   277,   277,  1372,  -400,
-     100,  -400,  -400,  -400,   277,    94,   118,   277,  -400,  -400,
-     277,   277,   277,   277,   277,   277,  -400,  1131,   277,  -400,
-     277,    39,  -400,  -400,  -400,  -400,  -400,  -400,   277,    39,
-     277,   277,   277,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-     138,   -72,  -400,   328,  -400,   106,   328,   523,  -107,   328,
-     328,   589,   139,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,    90,  -400,  -400,  -400,    13,   874,  -400,
-    -400,    32,    32,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,   487,
-     151,   155,  -400,  -400,   148,   328,   156,  -400,   -75,   160,
-     163,   166,   169,   175,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,   176,  -400,   172,  -400,
-    -400,   183,  -400,  -400,  -400,  -400,  -400,   179,  -400,  -400,
-    -400
+    1182,   862,  -467,  -467,    19,   247,   862,   862,   429,   429,
+       9,     9,     9,   615,   783,   783,   783,  1174,   281,    89,
+     997,  1148,  1148,  1174,   783,     9,     9,   247,   746,   615,
+     615,  1531,  1299,   429,   429,   862,   503,    14,  1148,  -138,
+     247,  -138,   373,   276,   276,  1531,   311,  1009,  1009,     9,
+     247,     9,  1299,  1299,  1299,  1299,  1531,   247,  -138,     9,
+       9,   247,  1299,   126,   247,   247,     9,   247,  -132,  -110,
+     -72,     9,     9,     9,   862,   429,   -42,   247,   429,   247,
+     429,     9,  -132,   217,    87,   313,   247,     9,     9,    73,
+    1572,   746,   746,   140,  1319,  -467,  -467,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,    98,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,
+    -467,  -467,  -467,   862,  -467,   -30,    39,  -467,  -467,  -467,
+    -467,  -467,  -467,   247,  -467,  -467,   828,   828,  -467,  -467,
+     862,  -467,   862,  -467,  -467,   548,   570,   548,  -467,  -467,
+    -467,  -467,  -467,   429,  -467,  -467,  -467,   -42,   -42,   -42,
+    -467,  -467,  -467,   -42,   -42,  -467,   247,   -42,  -467,   129,
+     288,  -467,   115,   247,  -467,   -42,  -467,   247,  -467,   251,
+    -467,  -467,   142,   783,  -467,   783,  -467,   247,   -42,   247,
+     247,  -467,   381,  -467,   247,   148,    13,   120,  -467,   247,
+    -467,   862,  -467,   862,    39,   247,  -467,  -467,   247,  -467,
+     783,   247,  -467,   247,   247,  -467,   132,   247,   -42,   247,
+     -42,   -42,   247,   -42,  -467,   247,  -467,   247,   247,  -467,
+     247,  -467,   247,  -467,   247,  -467,   247,  -467,   247,   975,
+    -467,   247,   548,   548,  -467,  -467,   247,   247,  -467,  -467,
+    -467,   429,  -467,  -467,   247,   247,    29,   247,   247,   862,
+      39,  -467,   862,   862,  -467,  -467,   862,  -467,  -467,   862,
+     -42,   247,   435,  -467,   247,   330,   247,  -467,   247,  -467,
+    -467,  1108,  1108,  1531,  1585,  1031,    66,   228,  1610,  1031,
+      70,  -467,    77,  -467,  -467,  -467,  -467,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,    78,  -467,  -467,
+     247,  -467,   247,  -467,  -467,  -467,    28,  -467,   862,   862,
+     862,   862,  -467,  -467,    10,   880,    39,    39,  -467,   322,
+    1452,  1472,  1512,  -467,   862,    94,  1531,   709,   975,  1531,
+    -467,  1031,  1031,   351,  -467,  -467,  -467,   783,  -467,  -467,
+     192,   192,  -467,  1531,  -467,  -467,  -467,  1431,   247,    62,
+    -467,    64,  -467,    39,    39,  -467,  -467,  -467,   192,  -467,
+    -467,  -467,  -467,    65,  -467,     9,  -467,     9,    71,  -467,
+      72,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,
+    1551,  -467,  -467,  -467,   322,  1492,  -467,  -467,  -467,   862,
+    -467,  -467,   247,  -467,  -467,    39,  -467,    39,    39,    39,
+     807,   862,  -467,  -467,  -467,  -467,  -467,  1031,  -467,  1031,
+      24,   134,   135,   144,   147,   151,   162,    68,  -467,   436,
+    -467,  -467,  -467,  -467,   260,    84,  -467,   158,   280,   159,
+     164,   -29,  -467,   436,   436,  1624,  -467,  -467,  -467,  -467,
+     -48,   -48,  -467,  -467,   247,  1531,   247,  -467,  -467,   247,
+    -467,   247,  -467,   247,    39,  -467,  -467,   590,  -467,  -467,
+    -467,  -467,  -467,  1551,   247,  -467,  -467,   247,  1431,   247,
+     247,   247,  1431,  -467,   102,  -467,  -467,  -467,   247,   169,
+     185,   247,  -467,  -467,   247,   247,   247,   247,   247,   247,
+    -467,   975,   247,  -467,   247,    39,  -467,  -467,  -467,  -467,
+    -467,  -467,   247,    39,   247,   247,   247,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,   187,   -68,  -467,   436,  -467,   166,
+     436,   421,   -60,   436,   436,   479,   194,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,   165,  -467,  -467,
+    -467,    44,  1067,  -467,  -467,    64,    64,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,
+    -467,  -467,  -467,   490,   200,   205,  -467,  -467,   201,   436,
+     218,  -467,   -40,   225,   229,   241,   242,   255,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,
+     257,  -467,   259,  -467,  -467,   270,  -467,  -467,  -467,  -467,
+    -467,   261,  -467,  -467,  -467
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
        0,     0,    22,     4,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1101,446 +1428,452 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   166,     0,
-       0,     0,     0,     0,     0,     0,   193,     0,     0,     0,
-       0,     0,   166,     0,     0,     0,     0,     0,     0,   266,
-       0,     0,     0,     2,     5,    10,    47,    11,    13,    12,
-      14,    15,    16,    17,    18,    19,    20,    21,     0,   235,
-     236,   237,   238,   234,   233,   232,   194,   195,   196,   197,
-     198,   175,     0,   227,     0,     0,   207,   239,   226,     9,
-       8,     7,     0,   109,    35,     0,     0,   192,    42,     0,
-      44,     0,   168,   167,     0,     0,     0,   181,   228,   231,
-     230,   229,     0,   180,   185,   191,   193,   193,   193,   189,
-     199,   200,   193,   193,    28,     0,   193,    48,     0,     0,
-     178,     0,     0,   111,   193,    75,     0,   182,   193,   172,
-      90,   173,     0,    96,     0,    29,     0,   193,     0,     0,
-     115,     9,   104,     0,     0,     0,     0,    68,     0,    40,
-       0,    38,     0,     0,     0,   164,   118,     0,    94,     0,
-       0,   114,     0,     0,    23,     0,     0,   193,     0,   193,
-     193,     0,   193,    59,     0,    61,     0,     0,   159,     0,
-      77,     0,    79,     0,    81,     0,    83,     0,     0,   162,
-       0,     0,     0,    46,    92,     0,     0,    31,   163,   123,
-       0,   125,   165,     0,     0,     0,     0,     0,     0,     0,
-     132,     0,     0,   135,    33,     0,    84,    85,     0,   193,
-       0,     9,   150,     0,   169,     0,   138,   113,     0,     0,
-       0,     0,     0,   267,     0,     0,     0,   268,   269,   270,
-     271,   272,   275,   278,   279,   280,   281,   282,   283,   284,
-     273,   276,   274,   277,   247,   243,    98,     0,   100,     0,
-       1,     6,     3,     0,   176,     0,     0,     0,     0,   120,
-     108,   193,     0,     0,     0,   170,   193,   142,     0,     0,
-     101,     0,     0,     0,     0,     0,     0,    27,     0,     0,
-       0,    50,    49,   110,     0,    74,   171,   209,   209,    30,
-       0,    36,    37,   103,     0,     0,     0,    66,     0,    67,
-       0,     0,   117,   112,   119,   209,   116,   121,    25,    24,
-       0,    52,     0,    54,     0,     0,    56,     0,    58,    60,
-     158,   160,    76,    78,    80,    82,   220,     0,   218,   219,
-     122,   193,     0,    91,    32,   126,     0,   124,   128,     0,
-     130,   131,     0,   153,     0,     0,     0,     0,     0,   136,
-     151,   137,   154,     0,   156,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   246,     0,   308,   309,   312,   311,
-       0,   291,   310,     0,     0,     0,     0,     0,   285,     0,
-       0,     0,    97,    99,   206,   205,   201,   202,   203,   204,
-       0,     0,     0,    43,    45,     0,   143,     0,   147,     0,
-       0,   225,   224,     0,   222,   223,   184,   186,   190,     0,
-       0,   179,   177,     0,     0,     0,     0,     0,     0,   215,
-       0,   214,   216,   107,     0,   245,   244,     0,    41,    39,
-       0,     0,     0,     0,     0,     0,   161,     0,     0,   145,
-       0,     0,   129,   152,   133,   134,    34,    86,     0,     0,
-       0,     0,     0,    62,   256,   257,   258,   259,   260,   261,
-     252,     0,   293,     0,   289,   287,     0,     0,     0,     0,
-       0,     0,   306,   292,   294,   248,   249,   250,   295,   251,
-     286,   148,   187,   149,   139,   141,   146,   102,    72,   221,
-      71,    69,    73,   208,    89,    95,    70,     0,     0,   105,
-     106,     0,   242,    65,    93,    26,    51,    53,    55,    57,
-     217,   140,   144,   127,    87,    88,   155,   157,    63,     0,
-       0,     0,   290,   288,     0,     0,     0,   301,     0,     0,
-       0,     0,     0,     0,   213,   212,   211,   210,   240,   241,
-     262,   255,   263,   264,   265,   253,     0,   303,     0,   299,
-     297,     0,   302,   304,   305,   296,   307,     0,   300,   298,
-     254
+       0,     0,     0,     0,     0,     0,     0,     0,   168,     0,
+       0,     0,     0,     0,     0,     0,   195,     0,     0,     0,
+       0,     0,   168,     0,     0,     0,     0,     0,     0,     0,
+     268,     0,     0,     0,     2,     5,    10,    47,    11,    13,
+      12,    14,    15,    16,    17,    18,    19,    20,    21,     0,
+     237,   238,   239,   240,   236,   235,   234,   196,   197,   198,
+     199,   200,   177,     0,   229,     0,     0,   209,   241,   228,
+       9,     8,     7,     0,   109,    35,     0,     0,   194,    42,
+       0,    44,     0,   170,   169,     0,     0,     0,   183,   230,
+     233,   232,   231,     0,   182,   187,   193,   195,   195,   195,
+     191,   201,   202,   195,   195,    28,     0,   195,    48,     0,
+       0,   180,     0,     0,   111,   195,    75,     0,   184,   195,
+     174,    90,   175,     0,    96,     0,    29,     0,   195,     0,
+       0,   115,     9,   104,     0,     0,     0,     0,    68,     0,
+      40,     0,    38,     0,     0,     0,   166,   118,     0,    94,
+       0,     0,   114,     0,     0,    23,     0,     0,   195,     0,
+     195,   195,     0,   195,    59,     0,    61,     0,     0,   161,
+       0,    77,     0,    79,     0,    81,     0,    83,     0,     0,
+     164,     0,     0,     0,    46,    92,     0,     0,    31,   165,
+     123,     0,   125,   167,     0,     0,     0,     0,     0,     0,
+       0,   132,     0,     0,   135,    33,     0,    84,    85,     0,
+     195,     0,     9,   152,     0,   171,     0,   138,     0,   140,
+     113,     0,     0,     0,     0,     0,   269,     0,     0,     0,
+     270,   271,   272,   273,   274,   277,   280,   281,   282,   283,
+     284,   285,   286,   275,   278,   276,   279,   249,   245,    98,
+       0,   100,     0,     1,     6,     3,     0,   178,     0,     0,
+       0,     0,   120,   108,   195,     0,     0,     0,   172,   195,
+     144,     0,     0,   101,     0,     0,     0,     0,     0,     0,
+      27,     0,     0,     0,    50,    49,   110,     0,    74,   173,
+     211,   211,    30,     0,    36,    37,   103,     0,     0,     0,
+      66,     0,    67,     0,     0,   117,   112,   119,   211,   116,
+     121,    25,    24,     0,    52,     0,    54,     0,     0,    56,
+       0,    58,    60,   160,   162,    76,    78,    80,    82,   222,
+       0,   220,   221,   122,   195,     0,    91,    32,   126,     0,
+     124,   128,     0,   130,   131,     0,   155,     0,     0,     0,
+       0,     0,   136,   153,   137,   139,   156,     0,   158,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   248,     0,
+     310,   311,   314,   313,     0,   293,   312,     0,     0,     0,
+       0,     0,   287,     0,     0,     0,    97,    99,   208,   207,
+     203,   204,   205,   206,     0,     0,     0,    43,    45,     0,
+     145,     0,   149,     0,     0,   227,   226,     0,   224,   225,
+     186,   188,   192,     0,     0,   181,   179,     0,     0,     0,
+       0,     0,     0,   217,     0,   216,   218,   107,     0,   247,
+     246,     0,    41,    39,     0,     0,     0,     0,     0,     0,
+     163,     0,     0,   147,     0,     0,   129,   154,   133,   134,
+      34,    86,     0,     0,     0,     0,     0,    62,   258,   259,
+     260,   261,   262,   263,   254,     0,   295,     0,   291,   289,
+       0,     0,     0,     0,     0,     0,   308,   294,   296,   250,
+     251,   252,   297,   253,   288,   150,   189,   151,   141,   143,
+     148,   102,    72,   223,    71,    69,    73,   210,    89,    95,
+      70,     0,     0,   105,   106,     0,   244,    65,    93,    26,
+      51,    53,    55,    57,   219,   142,   146,   127,    87,    88,
+     157,   159,    63,     0,     0,     0,   292,   290,     0,     0,
+       0,   303,     0,     0,     0,     0,     0,     0,   215,   214,
+     213,   212,   242,   243,   264,   257,   265,   266,   267,   255,
+       0,   305,     0,   301,   299,     0,   304,   306,   307,   298,
+     309,     0,   302,   300,   256
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -400,  -400,  -400,   447,   216,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,    54,
-     225,   357,    77,  -400,    38,   -17,  -400,   -30,   477,     3,
-      -7,  -314,     7,    -6,   721,  -171,  -400,    43,  -297,  -399,
-    -400,   -23,  -184,  -400,  -143,  -400,  -400,  -400,    -1,  -400,
-    -354,  -400,  -400,  -137,  -119
+    -467,  -467,  -467,   451,   303,  -467,  -467,  -467,  -467,  -467,
+    -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,  -467,   191,
+     319,    42,   109,  -467,    38,   -17,  -467,    69,   329,     3,
+      -7,  -311,     7,    -6,   728,  -209,  -467,    43,  -325,  -466,
+    -467,    67,   -90,  -467,   -53,  -467,  -467,  -467,    -1,  -467,
+    -357,  -467,  -467,  -363,   -22
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    92,    93,   133,    94,    95,    96,    97,    98,   358,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   207,
-     253,   144,   273,   181,   182,   123,   169,   170,   152,   176,
-     177,   450,   178,   451,   124,   159,   160,   274,   475,   480,
-     481,   387,   388,   463,   464,   126,   153,   127,   161,   485,
-     108,   487,   305,   431,   432
+       0,    93,    94,   134,    95,    96,    97,    98,    99,   361,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   208,
+     254,   145,   274,   182,   183,   124,   170,   171,   153,   177,
+     178,   454,   179,   455,   125,   160,   161,   275,   479,   484,
+     485,   390,   391,   467,   468,   127,   154,   128,   162,   489,
+     109,   491,   308,   435,   436
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     128,   168,   139,   141,   486,   128,   128,   156,   162,   163,
-     142,  -188,   455,   254,   594,   129,   587,   187,   426,   427,
-     129,   157,   157,   157,   165,   428,   429,   200,   202,   444,
-     186,   157,  -188,  -188,   128,   198,   130,   131,   196,   588,
-     129,   130,   131,   355,   125,   129,   580,   430,   610,   135,
-     136,   476,   220,   205,   581,   231,   233,   235,   237,   520,
-     184,   130,   131,   238,   521,   245,   130,   131,   490,   261,
-     262,   611,   265,   128,   268,   553,   209,   498,   203,   557,
-     252,   129,   128,  -193,  -193,  -193,  -193,   255,   304,   137,
-    -193,  -193,  -193,   210,   280,   212,  -193,  -193,  -193,  -193,
-    -193,   129,   130,   131,   129,   310,   109,   110,   111,   112,
-     129,   312,   240,   113,   114,   115,   531,   259,   314,   532,
-     129,   128,   130,   131,   346,   130,   131,   129,   595,   339,
-     137,   130,   131,   129,   128,   128,   317,   318,   128,   354,
-     128,   130,   131,   128,   128,   128,   331,   425,   130,   131,
-     332,   333,   334,   399,   130,   131,   335,   336,   143,   597,
-     338,   439,   137,   468,   474,   313,   440,   468,   344,   558,
-     441,   172,   333,   315,   316,   317,   318,   484,   321,   322,
-     132,   350,   323,    89,   324,   347,   491,   348,   494,   356,
-    -193,   315,   316,   317,   318,   525,   445,   495,   246,   128,
-     137,   128,   315,   316,   317,   318,   514,   598,   599,   370,
-     515,   372,   365,   374,   375,   561,   377,   109,   110,   111,
-     112,   326,   328,   329,   113,   114,   115,   129,   516,   137,
-     116,   117,   118,   119,   120,  -193,   517,   389,   518,   562,
-     128,   128,   519,   360,   396,   361,   558,  -193,   130,   131,
-     526,   461,   583,   529,  -183,   530,   558,   128,   579,   593,
-     128,   128,  -193,   408,   128,   462,   605,   128,  -183,  -188,
-     606,   607,   413,   415,   314,  -183,  -183,   -64,   129,   609,
-     423,   424,   205,   612,   437,   438,   613,   416,   522,   614,
-    -188,  -188,   615,   524,   616,   618,   617,   528,   620,   130,
-     131,   402,   533,   534,   404,   405,   619,   270,   406,   311,
-     472,   407,   469,   570,   128,   128,   128,   128,   391,   392,
-     549,   457,   540,   168,   116,   117,   118,   119,   120,   452,
-     128,   465,     0,   129,   389,   157,   459,   479,   471,     0,
-     466,   426,   427,   470,     0,     0,   340,   473,   428,   429,
-    -181,     0,     0,   482,   130,   131,     0,   477,   446,   447,
-     448,   449,   315,   316,   317,   318,   155,     0,   145,   146,
-     523,  -181,  -181,   137,   460,   129,     0,   315,   316,   317,
-     318,   497,   188,   189,     0,   500,   582,     0,   137,   584,
-     586,     0,   589,   590,   592,   128,   130,   131,   512,   157,
-     216,   218,     0,     0,     0,     0,   227,   128,   229,     0,
-     508,     0,   510,     0,   511,  -170,   241,   242,   109,   110,
-     111,   112,     0,   250,     0,   113,   114,   115,   256,   257,
-     258,   116,   117,   118,   119,   120,  -170,  -170,   269,   501,
-     539,   275,     0,   278,   279,     0,   426,   427,   608,     0,
-       0,   509,   134,   428,   429,   138,   140,   479,   542,     0,
-     221,   479,   465,   497,   164,   167,   173,   175,   180,   183,
-     185,     0,     0,   482,   190,   192,     0,   482,     0,   197,
-     199,   201,     0,     0,   206,   208,     0,   211,     0,   214,
-       0,     0,     0,     0,   223,   225,   389,   228,     0,   230,
-     232,   234,   236,     0,   239,   193,   194,   195,   243,   244,
-     247,   248,   249,     0,   251,     0,   116,   117,   118,   119,
-     120,     0,   260,     0,   263,   264,   266,   267,     0,     0,
-     272,   276,   277,     0,     0,   426,   427,   306,   308,     0,
-       0,   479,   428,   429,   271,     0,   109,   110,   111,   112,
-       0,     0,     0,   113,   114,   115,     0,   482,     0,   116,
-     117,   118,   119,   120,   527,   130,   131,   307,   309,   129,
-     121,     0,   319,   116,   117,   118,   119,   120,     0,   320,
-       0,     0,   122,     0,   116,   117,   118,   119,   120,     0,
-     130,   131,   325,     0,   109,   110,   111,   112,     0,   330,
-       0,   113,   114,   115,   600,     0,   601,   116,   117,   118,
-     119,   120,   337,   142,     0,     0,   341,     0,   342,   343,
-       0,     0,     0,   345,     0,   602,   603,   604,   116,   117,
-     118,   119,   120,   349,     0,   351,   352,     0,     0,     0,
-     353,   426,   427,   357,     0,   359,     0,     0,   428,   429,
-     362,   363,     0,     0,   364,   121,     0,   366,     0,   367,
-     368,     0,   369,   371,     0,   373,     0,     0,   376,     0,
-     585,   378,     0,   379,   380,     0,   381,     0,   382,     0,
-     383,     0,   384,     0,   385,   147,     0,   390,   148,     0,
-       0,     0,   393,   394,   149,   150,   151,   395,   121,     0,
-     397,   398,     0,   400,   401,     0,   403,   426,   427,     0,
-     122,     0,     0,     0,   428,   429,   591,   409,     0,     0,
-     410,     0,   411,   121,     0,   412,   414,     0,     0,   492,
-       0,   493,     0,     0,     0,   158,   158,   158,   166,   171,
-       0,   158,     0,     0,   166,   158,   121,     0,     0,     0,
-       0,     0,   166,   158,   442,     0,   443,   204,   122,     0,
-       0,   143,     0,   215,   217,   219,   166,   222,   224,   226,
-     453,   454,     0,   158,   158,   158,   158,   166,     0,     0,
-       0,     0,     0,   158,   109,   110,   111,   112,     0,     0,
-       0,   113,   114,   115,     0,   327,     0,   109,   110,   111,
-     112,     0,   483,     0,   113,   114,   115,   488,   489,     0,
-     116,   117,   118,   119,   120,     0,     0,     0,     0,     0,
-     129,     0,   109,   110,   111,   112,     0,     0,   154,   113,
-     114,   115,     0,     0,   496,   116,   117,   118,   119,   120,
-       0,   130,   131,     0,     0,     0,   502,     0,     0,   503,
-       0,   504,   505,   506,   507,     0,     0,   109,   110,   111,
-     112,     0,     0,   513,   113,   114,   115,     0,     0,     0,
-     116,   117,   118,   119,   120,   596,     0,   109,   110,   111,
-     112,     0,     0,     0,   113,   114,   115,     0,     0,     0,
-     116,   117,   118,   119,   120,     0,     0,   541,     0,   543,
-       0,     0,   544,   158,   545,   158,   546,   547,     0,     0,
-     548,     0,     0,     0,     0,     0,   550,   551,     0,     0,
-     552,     0,   554,   555,   556,     0,     0,   559,     0,   461,
-     158,   560,     0,     0,   563,     0,     0,   564,   565,   566,
-     567,   568,   569,   462,     0,   571,     0,   572,   573,   121,
-       0,   129,     0,     0,     0,   574,   575,   576,   577,   578,
-       0,   122,     0,     0,     0,     0,   116,   117,   118,   119,
-     120,   155,   130,   131,     0,     0,     0,     0,     0,     0,
-       0,     0,   315,   316,   317,   318,     0,     0,   478,   129,
-       0,   109,   110,   111,   112,     0,     0,   154,   113,   114,
-     115,   166,     0,     0,   116,   117,   118,   119,   120,   121,
-     130,   131,     0,     0,     0,     0,     0,   315,   316,   317,
-     318,   122,     0,     0,     0,     0,     0,     0,     0,   121,
-     129,     0,  -193,  -193,  -193,  -193,     0,     0,     0,  -193,
-    -193,  -193,     0,   166,     0,   129,     0,     0,     0,   158,
-     166,   130,   131,     0,   166,     0,     0,   166,     0,     0,
-     116,   117,   118,   119,   120,   158,   130,   131,     0,     0,
-       0,   166,   109,   110,   111,   112,     0,     0,   467,   113,
-     114,   115,     0,   129,     0,  -174,  -174,  -174,  -174,     0,
-       0,  -174,  -174,  -174,  -174,     0,   179,     0,  -174,  -174,
-    -174,  -174,  -174,   213,   130,   131,     0,   109,   110,   111,
-     112,     0,     0,   158,   113,   114,   115,     0,     0,     0,
-     116,   117,   118,   119,   120,     0,     0,     0,   158,     0,
-       0,     0,     1,     0,   109,   110,   111,   112,     2,     0,
-     155,   113,   114,   115,     0,   174,     0,     3,     0,   137,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,     0,     0,    19,    20,    21,
-      22,    23,   166,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,  -174,    85,    86,    87,    88,     0,
-       0,     0,   129,     0,   109,   110,   111,   112,     0,     0,
-     154,   113,   114,   115,     0,     0,   155,   116,   117,   118,
-     119,   120,     0,   130,   131,     0,     0,     0,     1,     0,
-       0,     0,     0,     0,     2,     0,    89,     0,     0,   386,
-       0,     0,     0,     0,    90,    91,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-      18,     0,     0,    19,    20,    21,    22,    23,     0,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-       0,    85,    86,    87,    88,   109,   110,   111,   112,     0,
-       0,     0,   113,   114,   115,     0,     0,     0,   116,   117,
-     118,   119,   120,   155,   129,     0,   109,   110,   111,   112,
-       0,     0,     0,   113,   114,   115,     0,     0,     0,   116,
-     117,   118,   119,   120,     0,   130,   131,     0,     0,     0,
-      90,    91,  -170,     0,  -170,  -170,  -170,  -170,     0,     0,
-    -170,  -170,  -170,  -170,     0,     0,     0,  -170,  -170,  -170,
-    -170,  -170,   456,     0,   109,   110,   111,   112,     0,     0,
-     154,   113,   114,   115,     0,     0,     0,   116,   117,   118,
-     119,   120,   499,     0,   109,   110,   111,   112,     0,     0,
-     154,   113,   114,   115,     0,     0,     0,   116,   117,   118,
-     119,   120,     0,     0,     0,   458,   478,   109,   110,   111,
-     112,     0,     0,     0,   113,   114,   115,     0,     0,     0,
-     116,   117,   118,   119,   120,   109,   110,   111,   112,     0,
-       0,   154,   113,   114,   115,     0,     0,     0,   116,   117,
-     118,   119,   120,     0,     0,     0,   129,   121,  -193,  -193,
-    -193,  -193,     0,     0,     0,  -193,  -193,  -193,     0,     0,
-       0,     0,     0,     0,     0,   155,     0,   130,   131,   109,
-     110,   111,   112,     0,     0,     0,   113,   114,   115,   109,
-     110,   111,   112,     0,     0,     0,   113,   114,   115,   109,
-     110,   111,   112,  -170,     0,     0,   113,   114,   115,     0,
-       0,     0,     0,     0,     0,     0,     0,   109,   110,   111,
-     112,     0,     0,   155,   113,   114,   115,     0,     0,     0,
-       0,   109,   110,   111,   112,     0,     0,     0,   113,   114,
-     115,   191,     0,   155,   148,     0,     0,     0,     0,     0,
-     149,   150,   151,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   130,   131,     0,     0,   155,     0,     0,     0,
-       0,     0,     0,     0,     0,   137,     0,     0,     0,     0,
-       0,     0,     0,     0,   155,     0,     0,     0,     0,     0,
-     281,     0,   282,   283,     0,     0,   284,     0,   285,     0,
-     286,     0,     0,  -193,     0,   287,   288,   289,   290,   291,
-     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
-     302,   303,   417,   418,   419,   420,   421,   422,     0,     0,
-       0,   433,     0,     0,   434,     0,     0,     0,     0,     0,
-       0,     0,     0,   435,     0,   436,   535,   536,     0,     0,
-       0,     0,     0,   428,   537,   538
+     129,   169,   140,   142,   490,   129,   129,   157,   163,   164,
+     143,  -190,   557,   206,   358,   130,   561,   188,   459,   253,
+     130,   158,   158,   158,   166,   130,   480,   201,   203,   448,
+     187,   158,  -190,  -190,   129,   199,   131,   132,   197,   255,
+     130,   131,   132,   494,   126,   598,   131,   132,   516,   136,
+     137,   584,   221,   146,   147,   232,   234,   236,   238,   585,
+     185,   131,   132,   239,   591,   246,   526,   189,   190,   262,
+     263,   528,   266,   129,   269,   532,   210,   256,   204,   138,
+     537,   538,   129,   502,   614,   217,   219,   592,   130,   307,
+     130,   228,   535,   230,   283,   536,   601,   110,   111,   112,
+     113,   242,   243,   130,   114,   115,   116,   615,   251,   131,
+     132,   131,   132,   257,   258,   259,   130,   260,   320,   321,
+     315,   130,   129,   270,   131,   132,   317,   130,   472,   281,
+     282,   138,   472,   130,   138,   129,   129,   131,   132,   129,
+     313,   129,   131,   132,   129,   129,   129,   334,   131,   132,
+     342,   335,   336,   337,   131,   132,   349,   338,   339,   144,
+     599,   341,  -195,   357,   586,   206,   316,   588,   590,   347,
+     593,   594,   596,   336,   318,   319,   320,   321,   402,   324,
+     325,   133,   353,   326,   524,   327,   350,   429,   351,   525,
+     359,   443,   318,   319,   320,   321,   276,   449,   444,   445,
+     129,   562,   129,   318,   319,   320,   321,   478,   602,   603,
+     373,   488,   375,   368,   377,   378,    90,   380,   272,   495,
+     110,   111,   112,   113,   498,   499,   612,   114,   115,   116,
+     211,   529,   213,   117,   118,   119,   120,   121,   392,   131,
+     132,   129,   129,   465,   363,   399,   364,   173,   130,   241,
+     518,   519,  -185,   138,   329,   331,   332,   466,   129,   562,
+     520,   129,   129,   521,   411,   129,  -185,   522,   129,   131,
+     132,   317,   -64,  -185,  -185,   417,   419,   143,   523,   530,
+     533,   247,   130,   427,   428,   534,  -195,   441,   442,   130,
+     420,   565,   117,   118,   119,   120,   121,   117,   118,   119,
+     120,   121,   405,   131,   132,   407,   408,   566,   583,   409,
+     131,   132,   410,   587,   130,   597,   609,   129,   129,   129,
+     129,   610,   562,  -190,   461,   611,   169,   117,   118,   119,
+     120,   121,   456,   129,   469,   131,   132,   392,   158,   463,
+     483,   475,   613,   470,  -190,  -190,   474,   430,   431,   616,
+     477,   394,   395,   617,   432,   433,   486,   194,   195,   196,
+     481,   450,   451,   452,   453,   618,   619,   117,   118,   119,
+     120,   121,   138,   122,   130,   620,   434,   464,   621,   430,
+     431,   624,  -183,   622,   501,   123,   432,   433,   504,   117,
+     118,   119,   120,   121,   623,   131,   132,   314,   129,   430,
+     431,   271,   158,  -183,  -183,   473,   432,   433,   527,   343,
+     129,   574,   476,   512,   553,     0,   514,   496,   515,   497,
+     310,   312,   278,   544,     0,     0,   144,     0,   531,     0,
+     130,     0,  -195,  -195,  -195,  -195,  -172,   122,     0,  -195,
+    -195,  -195,   505,   138,   543,  -195,  -195,  -195,  -195,  -195,
+       0,   131,   132,     0,   513,     0,   135,  -172,  -172,   139,
+     141,   483,   546,     0,   222,   483,   469,   501,   165,   168,
+     174,   176,   181,   184,   186,     0,     0,   486,   191,   193,
+       0,   486,     0,   198,   200,   202,     0,     0,   207,   209,
+       0,   212,     0,   215,   318,   319,   320,   321,   224,   226,
+     392,   229,     0,   231,   233,   235,   237,   122,   240,     0,
+       0,     0,   244,   245,   248,   249,   250,     0,   252,   117,
+     118,   119,   120,   121,     0,     0,   261,   214,   264,   265,
+     267,   268,     0,     0,   273,   277,   279,   280,     0,     0,
+     430,   431,   309,   311,     0,   483,     0,   432,   433,   328,
+     138,   110,   111,   112,   113,   430,   431,     0,   114,   115,
+     116,   486,   432,   433,   117,   118,   119,   120,   121,   589,
+       0,   330,     0,   110,   111,   112,   113,   322,     0,     0,
+     114,   115,   116,     0,   323,  -195,   117,   118,   119,   120,
+     121,   130,     0,   110,   111,   112,   113,  -195,   430,   431,
+     114,   115,   116,     0,   333,   432,   433,   595,   604,     0,
+     605,     0,   131,   132,     0,     0,   148,   340,     0,   149,
+       0,   344,     0,   345,   346,   150,   151,   152,   348,   606,
+     607,   608,     0,     0,     0,     0,     0,     0,   352,     0,
+     354,   355,     0,     0,     0,   356,     0,     0,   360,     0,
+     362,     0,     0,     0,     0,   365,   366,     0,     0,   367,
+       0,     0,   369,     0,   370,   371,     0,   372,   374,     0,
+     376,     0,     0,   379,     0,     0,   381,     0,   382,   383,
+       0,   384,     0,   385,     0,   386,     0,   387,     0,   388,
+       0,     0,   393,     0,     0,     0,     0,   396,   397,     0,
+       0,     0,   398,     0,   122,   400,   401,     0,   403,   404,
+       0,   406,   110,   111,   112,   113,   123,     0,   471,   114,
+     115,   116,   412,     0,     0,   413,   122,   414,     0,   415,
+       0,     0,   416,   418,     0,     0,     0,     0,   123,   465,
+       0,     0,   159,   159,   159,   167,   172,   192,   159,     0,
+     149,   167,   159,   466,     0,     0,   150,   151,   152,   167,
+     159,   446,     0,   447,   205,     0,     0,     0,   131,   132,
+     216,   218,   220,   167,   223,   225,   227,   457,   458,     0,
+     159,   159,   159,   159,   167,     0,   110,   111,   112,   113,
+     159,     0,   155,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     0,     0,     0,   130,   487,
+     110,   111,   112,   113,   492,   493,   155,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,   131,
+     132,   110,   111,   112,   113,     0,     0,     0,   114,   115,
+     116,   500,     0,     0,   117,   118,   119,   120,   121,     0,
+       0,     0,     0,   506,     0,     0,   507,     0,   508,   509,
+     510,   511,     0,     0,     0,   110,   111,   112,   113,     0,
+       0,   517,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,   110,   111,   112,   113,     0,     0,     0,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     0,     0,     0,   545,     0,   547,     0,     0,
+     548,   159,   549,   159,   550,   551,     0,     0,   552,     0,
+       0,     0,     0,     0,   554,   555,     0,     0,   556,     0,
+     558,   559,   560,     0,     0,   563,   156,     0,   159,   564,
+       0,     0,   567,     0,     0,   568,   569,   570,   571,   572,
+     573,     0,     0,   575,     0,   576,   577,     0,     0,     0,
+     156,     0,     0,   578,   579,   580,   581,   582,     0,     0,
+       0,   318,   319,   320,   321,     0,     0,     0,   110,   111,
+     112,   113,     0,     0,   122,   114,   115,   116,     0,     0,
+       0,     0,   318,   319,   320,   321,   123,     0,   130,     0,
+     110,   111,   112,   113,     0,     0,   155,   114,   115,   116,
+     130,   167,     0,   117,   118,   119,   120,   121,   122,   131,
+     132,     0,     0,     0,     0,   117,   118,   119,   120,   121,
+     123,   131,   132,   156,   110,   111,   112,   113,     0,     0,
+       0,   114,   115,   116,   318,   319,   320,   321,     0,     0,
+       0,     0,     0,   167,     0,     0,     0,     0,     0,   159,
+     167,     0,     0,     0,   167,     0,     0,   167,   600,     0,
+     110,   111,   112,   113,     0,   159,     0,   114,   115,   116,
+       0,   167,     0,   117,   118,   119,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   130,
+       0,  -195,  -195,  -195,  -195,     0,     0,     0,  -195,  -195,
+    -195,     0,     0,   159,   389,     0,     0,     0,     0,     0,
+     131,   132,     0,     0,     0,     0,     0,     0,   159,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   130,
+     156,  -176,  -176,  -176,  -176,   175,     0,  -176,  -176,  -176,
+    -176,     0,   180,     0,  -176,  -176,  -176,  -176,  -176,     0,
+     131,   132,     0,     0,     0,   130,     0,   110,   111,   112,
+     113,     0,   482,   167,   114,   115,   116,     0,     0,     1,
+     117,   118,   119,   120,   121,     2,   131,   132,     0,     0,
+       0,     0,     0,     0,     3,     0,     0,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,     0,   122,    19,    20,    21,    22,    23,   138,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,     0,    85,    86,    87,    88,    89,     0,     0,     0,
+     130,  -176,   110,   111,   112,   113,     0,     0,   155,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,   131,   132,     0,     0,     0,     1,   156,     0,     0,
+       0,     0,     2,     0,    90,     0,     0,     0,     0,     0,
+       0,     0,    91,    92,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,     0,
+       0,    19,    20,    21,    22,    23,     0,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,     0,    85,
+      86,    87,    88,    89,   110,   111,   112,   113,     0,     0,
+       0,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,   156,  -172,     0,  -172,  -172,  -172,  -172,     0,
+       0,  -172,  -172,  -172,  -172,     0,     0,     0,  -172,  -172,
+    -172,  -172,  -172,   460,     0,   110,   111,   112,   113,    91,
+      92,   155,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,   503,     0,   110,   111,   112,   113,     0,
+       0,   155,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,   462,     0,   110,   111,   112,   113,     0,
+       0,     0,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,   110,   111,   112,   113,     0,     0,
+       0,   114,   115,   116,     0,     0,   482,   117,   118,   119,
+     120,   121,   130,     0,  -195,  -195,  -195,  -195,     0,     0,
+       0,  -195,  -195,  -195,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   131,   132,   110,   111,   112,   113,     0,
+       0,     0,   114,   115,   116,     0,     0,   122,   110,   111,
+     112,   113,     0,     0,     0,   114,   115,   116,     0,     0,
+       0,     0,     0,     0,     0,  -172,     0,     0,     0,     0,
+       0,     0,     0,   110,   111,   112,   113,     0,     0,     0,
+     114,   115,   116,     0,     0,   156,     0,   110,   111,   112,
+     113,     0,     0,     0,   114,   115,   116,     0,     0,     0,
+       0,     0,     0,     0,     0,   156,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   156,     0,     0,     0,     0,
+       0,     0,   138,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   156,     0,     0,   284,     0,   285,
+     286,     0,     0,   287,     0,   288,     0,   289,     0,     0,
+    -195,     0,   290,   291,   292,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,     0,
+       0,     0,   421,   422,   423,   424,   425,   426,   437,     0,
+       0,   438,     0,     0,     0,     0,     0,     0,     0,     0,
+     439,     0,   440,   539,   540,     0,     0,     0,     0,     0,
+     432,   541,   542
 };
 
 static const yytype_int16 yycheck[] =
 {
-       1,    18,     8,     9,   358,     6,     7,    14,    15,    16,
-       1,     1,   326,   148,     1,     1,   123,    24,   118,   119,
-       1,    14,    15,    16,    17,   125,   126,    33,    34,     1,
-      23,    24,    22,    23,    35,    32,    22,    23,    31,   146,
-       1,    22,    23,     1,     1,     1,   118,   147,   123,     6,
-       7,   348,    45,   150,   126,    52,    53,    54,    55,   115,
-      22,    22,    23,    56,   120,    62,    22,    23,   365,    75,
-      76,   146,    78,    74,    80,   474,    38,   391,    35,   478,
-     150,     1,    83,     3,     4,     5,     6,   148,    89,   120,
-      10,    11,    12,    39,    21,    41,    16,    17,    18,    19,
-      20,     1,    22,    23,     1,     0,     3,     4,     5,     6,
-       1,    22,    58,    10,    11,    12,   120,    74,   155,   123,
-       1,   122,    22,    23,    14,    22,    23,     1,   115,    21,
-     120,    22,    23,     1,   135,   136,   165,   166,   139,    15,
-     141,    22,    23,   144,   145,   146,   152,   120,    22,    23,
-     156,   157,   158,   148,    22,    23,   162,   163,   149,   558,
-     166,   120,   120,   334,    15,   122,   120,   338,   174,   156,
-     120,   157,   178,   163,   164,   165,   166,   148,   135,   136,
-     161,   187,   139,   151,   141,   182,   153,   184,   152,   195,
-     148,   163,   164,   165,   166,   146,   168,   152,   154,   200,
-     120,   202,   163,   164,   165,   166,   115,   561,   562,   215,
-     115,   217,   209,   219,   220,   121,   222,     3,     4,     5,
-       6,   144,   145,   146,    10,    11,    12,     1,   115,   120,
-      16,    17,    18,    19,    20,   155,   115,   238,   115,   121,
-     241,   242,   115,   200,   250,   202,   156,   167,    22,    23,
-     120,   148,   146,   120,     1,   120,   156,   258,   120,   120,
-     261,   262,   153,   269,   265,   162,   115,   268,    15,     1,
-     115,   123,   278,   279,   155,    22,    23,   151,     1,   123,
-     281,   282,   150,   123,   285,   286,   123,   280,   425,   123,
-      22,    23,   123,   430,   119,   123,   120,   434,   119,    22,
-      23,   258,   439,   440,   261,   262,   123,    82,   265,    93,
-     340,   268,   335,   497,   315,   316,   317,   318,   241,   242,
-     463,   328,   441,   340,    16,    17,    18,    19,    20,   322,
-     331,   332,    -1,     1,   335,   328,   329,   354,   339,    -1,
-     333,   118,   119,   336,    -1,    -1,   120,   344,   125,   126,
-       1,    -1,    -1,   354,    22,    23,    -1,   350,   315,   316,
-     317,   318,   163,   164,   165,   166,   152,    -1,    11,    12,
-     147,    22,    23,   120,   331,     1,    -1,   163,   164,   165,
-     166,   387,    25,    26,    -1,   392,   523,    -1,   120,   526,
-     527,    -1,   529,   530,   531,   396,    22,    23,    24,   392,
-      43,    44,    -1,    -1,    -1,    -1,    49,   408,    51,    -1,
-     407,    -1,   413,    -1,   415,     1,    59,    60,     3,     4,
-       5,     6,    -1,    66,    -1,    10,    11,    12,    71,    72,
-      73,    16,    17,    18,    19,    20,    22,    23,    81,   396,
-     441,   109,    -1,    86,    87,    -1,   118,   119,   585,    -1,
-      -1,   408,     5,   125,   126,     8,     9,   474,   451,    -1,
-     152,   478,   463,   469,    17,    18,    19,    20,    21,    22,
-      23,    -1,    -1,   474,    27,    28,    -1,   478,    -1,    32,
-      33,    34,    -1,    -1,    37,    38,    -1,    40,    -1,    42,
-      -1,    -1,    -1,    -1,    47,    48,   497,    50,    -1,    52,
-      53,    54,    55,    -1,    57,    28,    29,    30,    61,    62,
-      63,    64,    65,    -1,    67,    -1,    16,    17,    18,    19,
-      20,    -1,    75,    -1,    77,    78,    79,    80,    -1,    -1,
-      83,    84,    85,    -1,    -1,   118,   119,    90,    91,    -1,
-      -1,   558,   125,   126,     1,    -1,     3,     4,     5,     6,
-      -1,    -1,    -1,    10,    11,    12,    -1,   558,    -1,    16,
-      17,    18,    19,    20,   147,    22,    23,    90,    91,     1,
-     155,    -1,   125,    16,    17,    18,    19,    20,    -1,   132,
-      -1,    -1,   167,    -1,    16,    17,    18,    19,    20,    -1,
-      22,    23,     1,    -1,     3,     4,     5,     6,    -1,   152,
-      -1,    10,    11,    12,   117,    -1,   119,    16,    17,    18,
-      19,    20,   165,     1,    -1,    -1,   169,    -1,   171,   172,
-      -1,    -1,    -1,   176,    -1,   138,   139,   140,    16,    17,
-      18,    19,    20,   186,    -1,   188,   189,    -1,    -1,    -1,
-     193,   118,   119,   196,    -1,   198,    -1,    -1,   125,   126,
-     203,   204,    -1,    -1,   207,   155,    -1,   210,    -1,   212,
-     213,    -1,   215,   216,    -1,   218,    -1,    -1,   221,    -1,
-     147,   224,    -1,   226,   227,    -1,   229,    -1,   231,    -1,
-     233,    -1,   235,    -1,   237,     1,    -1,   240,     4,    -1,
-      -1,    -1,   245,   246,    10,    11,    12,   250,   155,    -1,
-     253,   254,    -1,   256,   257,    -1,   259,   118,   119,    -1,
-     167,    -1,    -1,    -1,   125,   126,   127,   270,    -1,    -1,
-     273,    -1,   275,   155,    -1,   278,   279,    -1,    -1,   372,
-      -1,   374,    -1,    -1,    -1,    14,    15,    16,    17,    18,
-      -1,    20,    -1,    -1,    23,    24,   155,    -1,    -1,    -1,
-      -1,    -1,    31,    32,   307,    -1,   309,    36,   167,    -1,
-      -1,   149,    -1,    42,    43,    44,    45,    46,    47,    48,
-     323,   324,    -1,    52,    53,    54,    55,    56,    -1,    -1,
-      -1,    -1,    -1,    62,     3,     4,     5,     6,    -1,    -1,
-      -1,    10,    11,    12,    -1,     1,    -1,     3,     4,     5,
-       6,    -1,   355,    -1,    10,    11,    12,   360,   361,    -1,
-      16,    17,    18,    19,    20,    -1,    -1,    -1,    -1,    -1,
-       1,    -1,     3,     4,     5,     6,    -1,    -1,     9,    10,
-      11,    12,    -1,    -1,   387,    16,    17,    18,    19,    20,
-      -1,    22,    23,    -1,    -1,    -1,   399,    -1,    -1,   402,
-      -1,   404,   405,   406,   407,    -1,    -1,     3,     4,     5,
-       6,    -1,    -1,   416,    10,    11,    12,    -1,    -1,    -1,
-      16,    17,    18,    19,    20,     1,    -1,     3,     4,     5,
-       6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,
-      16,    17,    18,    19,    20,    -1,    -1,   450,    -1,   452,
-      -1,    -1,   455,   182,   457,   184,   459,   460,    -1,    -1,
-     463,    -1,    -1,    -1,    -1,    -1,   469,   470,    -1,    -1,
-     473,    -1,   475,   476,   477,    -1,    -1,   480,    -1,   148,
-     209,   484,    -1,    -1,   487,    -1,    -1,   490,   491,   492,
-     493,   494,   495,   162,    -1,   498,    -1,   500,   501,   155,
-      -1,     1,    -1,    -1,    -1,   508,   509,   510,   511,   512,
-      -1,   167,    -1,    -1,    -1,    -1,    16,    17,    18,    19,
-      20,   152,    22,    23,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   163,   164,   165,   166,    -1,    -1,   114,     1,
-      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    11,
-      12,   280,    -1,    -1,    16,    17,    18,    19,    20,   155,
-      22,    23,    -1,    -1,    -1,    -1,    -1,   163,   164,   165,
-     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,
-       1,    -1,     3,     4,     5,     6,    -1,    -1,    -1,    10,
-      11,    12,    -1,   322,    -1,     1,    -1,    -1,    -1,   328,
-     329,    22,    23,    -1,   333,    -1,    -1,   336,    -1,    -1,
-      16,    17,    18,    19,    20,   344,    22,    23,    -1,    -1,
-      -1,   350,     3,     4,     5,     6,    -1,    -1,     9,    10,
-      11,    12,    -1,     1,    -1,     3,     4,     5,     6,    -1,
-      -1,     9,    10,    11,    12,    -1,    14,    -1,    16,    17,
-      18,    19,    20,   153,    22,    23,    -1,     3,     4,     5,
-       6,    -1,    -1,   392,    10,    11,    12,    -1,    -1,    -1,
-      16,    17,    18,    19,    20,    -1,    -1,    -1,   407,    -1,
-      -1,    -1,     7,    -1,     3,     4,     5,     6,    13,    -1,
-     152,    10,    11,    12,    -1,   157,    -1,    22,    -1,   120,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    44,
-      45,    46,   451,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   152,   110,   111,   112,   113,    -1,
-      -1,    -1,     1,    -1,     3,     4,     5,     6,    -1,    -1,
-       9,    10,    11,    12,    -1,    -1,   152,    16,    17,    18,
-      19,    20,    -1,    22,    23,    -1,    -1,    -1,     7,    -1,
-      -1,    -1,    -1,    -1,    13,    -1,   151,    -1,    -1,   148,
-      -1,    -1,    -1,    -1,   159,   160,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    -1,    -1,    42,    43,    44,    45,    46,    -1,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
-      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-      -1,   110,   111,   112,   113,     3,     4,     5,     6,    -1,
+       1,    18,     8,     9,   361,     6,     7,    14,    15,    16,
+       1,     1,   478,   151,     1,     1,   482,    24,   329,   151,
+       1,    14,    15,    16,    17,     1,   351,    33,    34,     1,
+      23,    24,    22,    23,    35,    32,    22,    23,    31,   149,
+       1,    22,    23,   368,     1,     1,    22,    23,    24,     6,
+       7,   119,    45,    11,    12,    52,    53,    54,    55,   127,
+      22,    22,    23,    56,   124,    62,   429,    25,    26,    75,
+      76,   434,    78,    74,    80,   438,    38,   149,    35,   121,
+     443,   444,    83,   394,   124,    43,    44,   147,     1,    90,
+       1,    49,   121,    51,    21,   124,   562,     3,     4,     5,
+       6,    59,    60,     1,    10,    11,    12,   147,    66,    22,
+      23,    22,    23,    71,    72,    73,     1,    74,   166,   167,
+      22,     1,   123,    81,    22,    23,   156,     1,   337,    87,
+      88,   121,   341,     1,   121,   136,   137,    22,    23,   140,
+       0,   142,    22,    23,   145,   146,   147,   153,    22,    23,
+      21,   157,   158,   159,    22,    23,    14,   163,   164,   150,
+     116,   167,   149,    15,   527,   151,   123,   530,   531,   175,
+     533,   534,   535,   179,   164,   165,   166,   167,   149,   136,
+     137,   162,   188,   140,   116,   142,   183,   121,   185,   121,
+     196,   121,   164,   165,   166,   167,   109,   169,   121,   121,
+     201,   157,   203,   164,   165,   166,   167,    15,   565,   566,
+     216,   149,   218,   210,   220,   221,   152,   223,     1,   154,
+       3,     4,     5,     6,   153,   153,   589,    10,    11,    12,
+      39,   147,    41,    16,    17,    18,    19,    20,   239,    22,
+      23,   242,   243,   149,   201,   251,   203,   158,     1,    58,
+     116,   116,     1,   121,   145,   146,   147,   163,   259,   157,
+     116,   262,   263,   116,   270,   266,    15,   116,   269,    22,
+      23,   156,   152,    22,    23,   281,   282,     1,   116,   121,
+     121,   155,     1,   284,   285,   121,   154,   288,   289,     1,
+     283,   122,    16,    17,    18,    19,    20,    16,    17,    18,
+      19,    20,   259,    22,    23,   262,   263,   122,   121,   266,
+      22,    23,   269,   147,     1,   121,   116,   318,   319,   320,
+     321,   116,   157,     1,   331,   124,   343,    16,    17,    18,
+      19,    20,   325,   334,   335,    22,    23,   338,   331,   332,
+     357,   342,   124,   336,    22,    23,   339,   119,   120,   124,
+     347,   242,   243,   124,   126,   127,   357,    28,    29,    30,
+     353,   318,   319,   320,   321,   124,   124,    16,    17,    18,
+      19,    20,   121,   156,     1,   120,   148,   334,   121,   119,
+     120,   120,     1,   124,   390,   168,   126,   127,   395,    16,
+      17,    18,    19,    20,   124,    22,    23,    94,   399,   119,
+     120,    82,   395,    22,    23,   338,   126,   127,   148,   121,
+     411,   501,   343,   410,   467,    -1,   417,   375,   419,   377,
+      91,    92,   109,   445,    -1,    -1,   150,    -1,   148,    -1,
+       1,    -1,     3,     4,     5,     6,     1,   156,    -1,    10,
+      11,    12,   399,   121,   445,    16,    17,    18,    19,    20,
+      -1,    22,    23,    -1,   411,    -1,     5,    22,    23,     8,
+       9,   478,   455,    -1,   153,   482,   467,   473,    17,    18,
+      19,    20,    21,    22,    23,    -1,    -1,   478,    27,    28,
+      -1,   482,    -1,    32,    33,    34,    -1,    -1,    37,    38,
+      -1,    40,    -1,    42,   164,   165,   166,   167,    47,    48,
+     501,    50,    -1,    52,    53,    54,    55,   156,    57,    -1,
+      -1,    -1,    61,    62,    63,    64,    65,    -1,    67,    16,
+      17,    18,    19,    20,    -1,    -1,    75,   154,    77,    78,
+      79,    80,    -1,    -1,    83,    84,    85,    86,    -1,    -1,
+     119,   120,    91,    92,    -1,   562,    -1,   126,   127,     1,
+     121,     3,     4,     5,     6,   119,   120,    -1,    10,    11,
+      12,   562,   126,   127,    16,    17,    18,    19,    20,   148,
+      -1,     1,    -1,     3,     4,     5,     6,   126,    -1,    -1,
+      10,    11,    12,    -1,   133,   156,    16,    17,    18,    19,
+      20,     1,    -1,     3,     4,     5,     6,   168,   119,   120,
+      10,    11,    12,    -1,   153,   126,   127,   128,   118,    -1,
+     120,    -1,    22,    23,    -1,    -1,     1,   166,    -1,     4,
+      -1,   170,    -1,   172,   173,    10,    11,    12,   177,   139,
+     140,   141,    -1,    -1,    -1,    -1,    -1,    -1,   187,    -1,
+     189,   190,    -1,    -1,    -1,   194,    -1,    -1,   197,    -1,
+     199,    -1,    -1,    -1,    -1,   204,   205,    -1,    -1,   208,
+      -1,    -1,   211,    -1,   213,   214,    -1,   216,   217,    -1,
+     219,    -1,    -1,   222,    -1,    -1,   225,    -1,   227,   228,
+      -1,   230,    -1,   232,    -1,   234,    -1,   236,    -1,   238,
+      -1,    -1,   241,    -1,    -1,    -1,    -1,   246,   247,    -1,
+      -1,    -1,   251,    -1,   156,   254,   255,    -1,   257,   258,
+      -1,   260,     3,     4,     5,     6,   168,    -1,     9,    10,
+      11,    12,   271,    -1,    -1,   274,   156,   276,    -1,   278,
+      -1,    -1,   281,   282,    -1,    -1,    -1,    -1,   168,   149,
+      -1,    -1,    14,    15,    16,    17,    18,     1,    20,    -1,
+       4,    23,    24,   163,    -1,    -1,    10,    11,    12,    31,
+      32,   310,    -1,   312,    36,    -1,    -1,    -1,    22,    23,
+      42,    43,    44,    45,    46,    47,    48,   326,   327,    -1,
+      52,    53,    54,    55,    56,    -1,     3,     4,     5,     6,
+      62,    -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,
+      17,    18,    19,    20,    -1,    -1,    -1,    -1,     1,   358,
+       3,     4,     5,     6,   363,   364,     9,    10,    11,    12,
+      -1,    -1,    -1,    16,    17,    18,    19,    20,    -1,    22,
+      23,     3,     4,     5,     6,    -1,    -1,    -1,    10,    11,
+      12,   390,    -1,    -1,    16,    17,    18,    19,    20,    -1,
+      -1,    -1,    -1,   402,    -1,    -1,   405,    -1,   407,   408,
+     409,   410,    -1,    -1,    -1,     3,     4,     5,     6,    -1,
+      -1,   420,    10,    11,    12,    -1,    -1,    -1,    16,    17,
+      18,    19,    20,     3,     4,     5,     6,    -1,    -1,    -1,
+      10,    11,    12,    -1,    -1,    -1,    16,    17,    18,    19,
+      20,    -1,    -1,    -1,    -1,   454,    -1,   456,    -1,    -1,
+     459,   183,   461,   185,   463,   464,    -1,    -1,   467,    -1,
+      -1,    -1,    -1,    -1,   473,   474,    -1,    -1,   477,    -1,
+     479,   480,   481,    -1,    -1,   484,   153,    -1,   210,   488,
+      -1,    -1,   491,    -1,    -1,   494,   495,   496,   497,   498,
+     499,    -1,    -1,   502,    -1,   504,   505,    -1,    -1,    -1,
+     153,    -1,    -1,   512,   513,   514,   515,   516,    -1,    -1,
+      -1,   164,   165,   166,   167,    -1,    -1,    -1,     3,     4,
+       5,     6,    -1,    -1,   156,    10,    11,    12,    -1,    -1,
+      -1,    -1,   164,   165,   166,   167,   168,    -1,     1,    -1,
+       3,     4,     5,     6,    -1,    -1,     9,    10,    11,    12,
+       1,   283,    -1,    16,    17,    18,    19,    20,   156,    22,
+      23,    -1,    -1,    -1,    -1,    16,    17,    18,    19,    20,
+     168,    22,    23,   153,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    11,    12,   164,   165,   166,   167,    -1,    -1,
+      -1,    -1,    -1,   325,    -1,    -1,    -1,    -1,    -1,   331,
+     332,    -1,    -1,    -1,   336,    -1,    -1,   339,     1,    -1,
+       3,     4,     5,     6,    -1,   347,    -1,    10,    11,    12,
+      -1,   353,    -1,    16,    17,    18,    19,    20,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,
+      -1,     3,     4,     5,     6,    -1,    -1,    -1,    10,    11,
+      12,    -1,    -1,   395,   149,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    -1,    -1,    -1,    -1,    -1,    -1,   410,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,
+     153,     3,     4,     5,     6,   158,    -1,     9,    10,    11,
+      12,    -1,    14,    -1,    16,    17,    18,    19,    20,    -1,
+      22,    23,    -1,    -1,    -1,     1,    -1,     3,     4,     5,
+       6,    -1,   115,   455,    10,    11,    12,    -1,    -1,     7,
+      16,    17,    18,    19,    20,    13,    22,    23,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    -1,    -1,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    -1,   156,    42,    43,    44,    45,    46,   121,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,    -1,   110,   111,   112,   113,   114,    -1,    -1,    -1,
+       1,   153,     3,     4,     5,     6,    -1,    -1,     9,    10,
+      11,    12,    -1,    -1,    -1,    16,    17,    18,    19,    20,
+      -1,    22,    23,    -1,    -1,    -1,     7,   153,    -1,    -1,
+      -1,    -1,    13,    -1,   152,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   160,   161,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    -1,
+      -1,    42,    43,    44,    45,    46,    -1,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,    -1,   110,
+     111,   112,   113,   114,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
+      19,    20,   153,     1,    -1,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,    17,
+      18,    19,    20,     1,    -1,     3,     4,     5,     6,   160,
+     161,     9,    10,    11,    12,    -1,    -1,    -1,    16,    17,
+      18,    19,    20,     1,    -1,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,    17,
+      18,    19,    20,     1,    -1,     3,     4,     5,     6,    -1,
       -1,    -1,    10,    11,    12,    -1,    -1,    -1,    16,    17,
-      18,    19,    20,   152,     1,    -1,     3,     4,     5,     6,
-      -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,    16,
-      17,    18,    19,    20,    -1,    22,    23,    -1,    -1,    -1,
-     159,   160,     1,    -1,     3,     4,     5,     6,    -1,    -1,
-       9,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
-      19,    20,     1,    -1,     3,     4,     5,     6,    -1,    -1,
-       9,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
+      18,    19,    20,    -1,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    11,    12,    -1,    -1,   115,    16,    17,    18,
       19,    20,     1,    -1,     3,     4,     5,     6,    -1,    -1,
-       9,    10,    11,    12,    -1,    -1,    -1,    16,    17,    18,
-      19,    20,    -1,    -1,    -1,     1,   114,     3,     4,     5,
-       6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,
-      16,    17,    18,    19,    20,     3,     4,     5,     6,    -1,
-      -1,     9,    10,    11,    12,    -1,    -1,    -1,    16,    17,
-      18,    19,    20,    -1,    -1,    -1,     1,   155,     3,     4,
+      -1,    10,    11,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,     3,     4,     5,     6,    -1,
+      -1,    -1,    10,    11,    12,    -1,    -1,   156,     3,     4,
        5,     6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   152,    -1,    22,    23,     3,
-       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,     3,
-       4,     5,     6,    -1,    -1,    -1,    10,    11,    12,     3,
-       4,     5,     6,   152,    -1,    -1,    10,    11,    12,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
-       6,    -1,    -1,   152,    10,    11,    12,    -1,    -1,    -1,
-      -1,     3,     4,     5,     6,    -1,    -1,    -1,    10,    11,
-      12,     1,    -1,   152,     4,    -1,    -1,    -1,    -1,    -1,
-      10,    11,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    22,    23,    -1,    -1,   152,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   152,    -1,    -1,    -1,    -1,    -1,
-     114,    -1,   116,   117,    -1,    -1,   120,    -1,   122,    -1,
-     124,    -1,    -1,   148,    -1,   129,   130,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   136,   137,   138,   139,   140,   141,    -1,    -1,
-      -1,   117,    -1,    -1,   120,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   129,    -1,   131,   118,   119,    -1,    -1,
-      -1,    -1,    -1,   125,   126,   127
+      -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,    -1,
+      10,    11,    12,    -1,    -1,   153,    -1,     3,     4,     5,
+       6,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,    -1,    -1,    -1,    -1,
+      -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,    -1,    -1,   115,    -1,   117,
+     118,    -1,    -1,   121,    -1,   123,    -1,   125,    -1,    -1,
+     149,    -1,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,    -1,
+      -1,    -1,   137,   138,   139,   140,   141,   142,   118,    -1,
+      -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     130,    -1,   132,   119,   120,    -1,    -1,    -1,    -1,    -1,
+     126,   127,   128
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,     7,    13,    22,    25,    26,    27,    28,    29,    30,
@@ -1551,102 +1884,102 @@ static const yytype_uint8 yystos[] =
       74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
       84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
       94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   110,   111,   112,   113,   151,
-     159,   160,   170,   171,   173,   174,   175,   176,   177,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   219,     3,
-       4,     5,     6,    10,    11,    12,    16,    17,    18,    19,
-      20,   155,   167,   194,   203,   206,   214,   216,   217,     1,
-      22,    23,   161,   172,   172,   206,   206,   120,   172,   202,
-     172,   202,     1,   149,   190,   190,   190,     1,     4,    10,
-      11,    12,   197,   215,     9,   152,   199,   201,   203,   204,
-     205,   217,   199,   199,   172,   201,   203,   172,   194,   195,
-     196,   203,   157,   172,   157,   172,   198,   199,   201,    14,
-     172,   192,   193,   172,   193,   172,   201,   199,   190,   190,
-     172,     1,   172,   197,   197,   197,   201,   172,   198,   172,
-     202,   172,   202,   206,   203,   150,   172,   188,   172,   193,
-     188,   172,   188,   153,   172,   203,   190,   203,   190,   203,
-     201,   152,   203,   172,   203,   172,   203,   190,   172,   190,
-     172,   198,   172,   198,   172,   198,   172,   198,   201,   172,
-     188,   190,   190,   172,   172,   198,   154,   172,   172,   172,
-     190,   172,   150,   189,   148,   148,   190,   190,   190,   206,
-     172,   202,   202,   172,   172,   202,   172,   172,   202,   190,
-     189,     1,   172,   191,   206,   109,   172,   172,   190,   190,
-      21,   114,   116,   117,   120,   122,   124,   129,   130,   131,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   217,   221,   172,   197,   172,   197,
-       0,   173,    22,   206,   155,   163,   164,   165,   166,   172,
-     172,   206,   206,   206,   206,     1,   191,     1,   191,   191,
-     172,   202,   202,   202,   202,   202,   202,   172,   202,    21,
-     120,   172,   172,   172,   202,   172,    14,   198,   198,   172,
-     202,   172,   172,   172,    15,     1,   202,   172,   178,   172,
-     206,   206,   172,   172,   172,   198,   172,   172,   172,   172,
-     202,   172,   202,   172,   202,   202,   172,   202,   172,   172,
-     172,   172,   172,   172,   172,   172,   148,   210,   211,   217,
-     172,   191,   191,   172,   172,   172,   202,   172,   172,   148,
-     172,   172,   206,   172,   206,   206,   206,   206,   202,   172,
-     172,   172,   172,   202,   172,   202,   201,   136,   137,   138,
-     139,   140,   141,   217,   217,   120,   118,   119,   125,   126,
-     147,   222,   223,   117,   120,   129,   131,   217,   217,   120,
-     120,   120,   172,   172,     1,   168,   206,   206,   206,   206,
-     200,   202,   201,   172,   172,   200,     1,   199,     1,   201,
-     206,   148,   162,   212,   213,   217,   201,     9,   204,   210,
-     201,   217,   196,   198,    15,   207,   207,   201,   114,   194,
-     208,   209,   217,   172,   148,   218,   219,   220,   172,   172,
-     207,   153,   190,   190,   152,   152,   172,   202,   200,     1,
-     199,   206,   172,   172,   172,   172,   172,   172,   198,   206,
-     217,   217,    24,   172,   115,   115,   115,   115,   115,   115,
-     115,   120,   222,   147,   222,   146,   120,   147,   222,   120,
-     120,   120,   123,   222,   222,   118,   119,   126,   127,   217,
-     223,   172,   201,   172,   172,   172,   172,   172,   172,   213,
-     172,   172,   172,   208,   172,   172,   172,   208,   156,   172,
-     172,   121,   121,   172,   172,   172,   172,   172,   172,   172,
-     211,   172,   172,   172,   172,   172,   172,   172,   172,   120,
-     118,   126,   222,   146,   222,   147,   222,   123,   146,   222,
-     222,   127,   222,   120,     1,   115,     1,   208,   219,   219,
-     117,   119,   138,   139,   140,   115,   115,   123,   222,   123,
-     123,   146,   123,   123,   123,   123,   119,   120,   123,   123,
-     119
+     104,   105,   106,   107,   108,   110,   111,   112,   113,   114,
+     152,   160,   161,   171,   172,   174,   175,   176,   177,   178,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   220,
+       3,     4,     5,     6,    10,    11,    12,    16,    17,    18,
+      19,    20,   156,   168,   195,   204,   207,   215,   217,   218,
+       1,    22,    23,   162,   173,   173,   207,   207,   121,   173,
+     203,   173,   203,     1,   150,   191,   191,   191,     1,     4,
+      10,    11,    12,   198,   216,     9,   153,   200,   202,   204,
+     205,   206,   218,   200,   200,   173,   202,   204,   173,   195,
+     196,   197,   204,   158,   173,   158,   173,   199,   200,   202,
+      14,   173,   193,   194,   173,   194,   173,   202,   200,   191,
+     191,   173,     1,   173,   198,   198,   198,   202,   173,   199,
+     173,   203,   173,   203,   207,   204,   151,   173,   189,   173,
+     194,   189,   173,   189,   154,   173,   204,   191,   204,   191,
+     204,   202,   153,   204,   173,   204,   173,   204,   191,   173,
+     191,   173,   199,   173,   199,   173,   199,   173,   199,   202,
+     173,   189,   191,   191,   173,   173,   199,   155,   173,   173,
+     173,   191,   173,   151,   190,   149,   149,   191,   191,   191,
+     207,   173,   203,   203,   173,   173,   203,   173,   173,   203,
+     191,   190,     1,   173,   192,   207,   109,   173,   109,   173,
+     173,   191,   191,    21,   115,   117,   118,   121,   123,   125,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   218,   222,   173,
+     198,   173,   198,     0,   174,    22,   207,   156,   164,   165,
+     166,   167,   173,   173,   207,   207,   207,   207,     1,   192,
+       1,   192,   192,   173,   203,   203,   203,   203,   203,   203,
+     173,   203,    21,   121,   173,   173,   173,   203,   173,    14,
+     199,   199,   173,   203,   173,   173,   173,    15,     1,   203,
+     173,   179,   173,   207,   207,   173,   173,   173,   199,   173,
+     173,   173,   173,   203,   173,   203,   173,   203,   203,   173,
+     203,   173,   173,   173,   173,   173,   173,   173,   173,   149,
+     211,   212,   218,   173,   192,   192,   173,   173,   173,   203,
+     173,   173,   149,   173,   173,   207,   173,   207,   207,   207,
+     207,   203,   173,   173,   173,   173,   173,   203,   173,   203,
+     202,   137,   138,   139,   140,   141,   142,   218,   218,   121,
+     119,   120,   126,   127,   148,   223,   224,   118,   121,   130,
+     132,   218,   218,   121,   121,   121,   173,   173,     1,   169,
+     207,   207,   207,   207,   201,   203,   202,   173,   173,   201,
+       1,   200,     1,   202,   207,   149,   163,   213,   214,   218,
+     202,     9,   205,   211,   202,   218,   197,   199,    15,   208,
+     208,   202,   115,   195,   209,   210,   218,   173,   149,   219,
+     220,   221,   173,   173,   208,   154,   191,   191,   153,   153,
+     173,   203,   201,     1,   200,   207,   173,   173,   173,   173,
+     173,   173,   199,   207,   218,   218,    24,   173,   116,   116,
+     116,   116,   116,   116,   116,   121,   223,   148,   223,   147,
+     121,   148,   223,   121,   121,   121,   124,   223,   223,   119,
+     120,   127,   128,   218,   224,   173,   202,   173,   173,   173,
+     173,   173,   173,   214,   173,   173,   173,   209,   173,   173,
+     173,   209,   157,   173,   173,   122,   122,   173,   173,   173,
+     173,   173,   173,   173,   212,   173,   173,   173,   173,   173,
+     173,   173,   173,   121,   119,   127,   223,   147,   223,   148,
+     223,   124,   147,   223,   223,   128,   223,   121,     1,   116,
+       1,   209,   220,   220,   118,   120,   139,   140,   141,   116,
+     116,   124,   223,   124,   124,   147,   124,   124,   124,   124,
+     120,   121,   124,   124,   120
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,   169,   170,   170,   170,   171,   171,   172,   172,   172,
-     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
-     173,   173,   173,   174,   174,   174,   174,   174,   174,   174,
+       0,   170,   171,   171,   171,   172,   172,   173,   173,   173,
      174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
-     174,   174,   174,   174,   174,   174,   174,   174,   175,   175,
-     175,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   176,   176,   176,   178,   177,   177,   177,   177,   179,
-     179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
-     179,   179,   179,   179,   179,   179,   179,   179,   179,   180,
-     180,   180,   180,   180,   180,   180,   180,   181,   181,   181,
-     181,   181,   181,   181,   181,   181,   181,   181,   182,   182,
-     182,   182,   182,   182,   182,   182,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   184,
+     174,   174,   174,   175,   175,   175,   175,   175,   175,   175,
+     175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
+     175,   175,   175,   175,   175,   175,   175,   175,   176,   176,
+     176,   177,   177,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   177,   179,   178,   178,   178,   178,   180,
+     180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
+     180,   180,   180,   180,   180,   180,   180,   180,   180,   181,
+     181,   181,   181,   181,   181,   181,   181,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   182,   183,   183,
+     183,   183,   183,   183,   183,   183,   184,   184,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
      184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
-     184,   184,   184,   184,   184,   184,   184,   184,   185,   185,
-     185,   186,   186,   187,   188,   189,   189,   190,   190,   191,
+     184,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     186,   186,   186,   187,   187,   188,   189,   190,   190,   191,
      191,   192,   192,   193,   193,   194,   194,   195,   195,   196,
-     197,   197,   198,   198,   199,   199,   199,   200,   200,   201,
-     201,   201,   202,   202,   203,   203,   203,   203,   203,   204,
-     205,   206,   206,   206,   206,   206,   206,   206,   207,   207,
-     208,   208,   208,   208,   208,   209,   209,   210,   210,   211,
-     211,   212,   212,   213,   213,   213,   214,   214,   215,   215,
-     215,   215,   216,   216,   216,   217,   217,   217,   217,   217,
-     218,   218,   218,   219,   220,   220,   221,   221,   221,   221,
-     221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
-     221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
-     221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
-     221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
-     221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
-     221,   221,   221,   221,   221,   221,   221,   221,   222,   222,
-     222,   222,   223
+     196,   197,   198,   198,   199,   199,   200,   200,   200,   201,
+     201,   202,   202,   202,   203,   203,   204,   204,   204,   204,
+     204,   205,   206,   207,   207,   207,   207,   207,   207,   207,
+     208,   208,   209,   209,   209,   209,   209,   210,   210,   211,
+     211,   212,   212,   213,   213,   214,   214,   214,   215,   215,
+     216,   216,   216,   216,   217,   217,   217,   218,   218,   218,
+     218,   218,   219,   219,   219,   220,   221,   221,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   222,   222,   222,   222,   222,   222,   222,   222,
+     223,   223,   223,   223,   224
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     2,     1,     1,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -1661,61 +1994,61 @@ static const yytype_uint8 yyr2[] =
        2,     3,     5,     3,     2,     5,     5,     4,     3,     2,
        3,     2,     3,     2,     2,     2,     3,     3,     2,     3,
        3,     3,     3,     2,     3,     2,     3,     5,     3,     4,
-       3,     3,     2,     4,     4,     2,     3,     3,     2,     5,
-       5,     5,     3,     4,     5,     4,     5,     4,     5,     5,
-       2,     3,     4,     3,     3,     5,     3,     5,     3,     2,
-       3,     4,     2,     2,     1,     1,     0,     1,     1,     1,
-       1,     2,     1,     1,     0,     1,     2,     3,     1,     3,
-       1,     1,     1,     1,     3,     1,     3,     2,     0,     1,
-       3,     1,     1,     0,     1,     1,     1,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     3,     1,     2,     0,
-       3,     3,     3,     3,     1,     1,     1,     3,     1,     1,
-       1,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     3,     2,     4,     4,     2,     3,     3,     2,     3,
+       2,     5,     5,     5,     3,     4,     5,     4,     5,     4,
+       5,     5,     2,     3,     4,     3,     3,     5,     3,     5,
+       3,     2,     3,     4,     2,     2,     1,     1,     0,     1,
+       1,     1,     1,     2,     1,     1,     0,     1,     2,     3,
+       1,     3,     1,     1,     1,     1,     3,     1,     3,     2,
+       0,     1,     3,     1,     1,     0,     1,     1,     1,     1,
+       1,     1,     1,     3,     3,     3,     3,     3,     3,     1,
+       2,     0,     3,     3,     3,     3,     1,     1,     1,     3,
+       1,     1,     1,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     3,     2,     2,     1,     1,     2,     1,     3,     3,
-       3,     3,     3,     5,     7,     5,     3,     3,     3,     3,
-       3,     3,     5,     5,     5,     5,     0,     1,     1,     1,
+       1,     1,     3,     3,     2,     2,     1,     1,     2,     1,
+       3,     3,     3,     3,     3,     5,     7,     5,     3,     3,
+       3,     3,     3,     3,     5,     5,     5,     5,     0,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     3,     3,     4,     3,
-       4,     2,     3,     3,     3,     3,     5,     5,     6,     5,
-       6,     4,     5,     5,     5,     5,     3,     5,     1,     1,
-       1,     1,     1
+       1,     1,     1,     1,     1,     1,     1,     2,     3,     3,
+       4,     3,     4,     2,     3,     3,     3,     3,     5,     5,
+       6,     5,     6,     4,     5,     5,     5,     5,     3,     5,
+       1,     1,     1,     1,     1
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1732,55 +2065,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1789,7 +2119,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1812,21 +2142,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1841,8 +2171,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1865,249 +2195,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2116,6 +2227,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2123,43 +2236,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2167,71 +2273,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2239,30 +2349,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2273,18 +2384,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2312,15 +2434,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2335,7 +2455,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2355,433 +2475,433 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 195 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0; }
-#line 2362 "mon_parse.c" /* yacc.c:1646  */
+  case 2: /* top_level: command_list  */
+#line 195 "mon_parse.y"
+                        { (yyval.i) = 0; }
+#line 2482 "mon_parse.c"
     break;
 
-  case 3:
-#line 196 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0; }
-#line 2368 "mon_parse.c" /* yacc.c:1646  */
+  case 3: /* top_level: assembly_instruction TRAIL  */
+#line 196 "mon_parse.y"
+                                      { (yyval.i) = 0; }
+#line 2488 "mon_parse.c"
     break;
 
-  case 4:
-#line 197 "mon_parse.y" /* yacc.c:1646  */
-    { new_cmd = 1; asm_mode = 0;  (yyval.i) = 0; }
-#line 2374 "mon_parse.c" /* yacc.c:1646  */
+  case 4: /* top_level: TRAIL  */
+#line 197 "mon_parse.y"
+                 { new_cmd = 1; asm_mode = 0;  (yyval.i) = 0; }
+#line 2494 "mon_parse.c"
     break;
 
-  case 9:
-#line 206 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_END_CMD; }
-#line 2380 "mon_parse.c" /* yacc.c:1646  */
+  case 9: /* end_cmd: error  */
+#line 206 "mon_parse.y"
+               { return ERR_EXPECT_END_CMD; }
+#line 2500 "mon_parse.c"
     break;
 
-  case 22:
-#line 221 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_BAD_CMD; }
-#line 2386 "mon_parse.c" /* yacc.c:1646  */
+  case 22: /* command: BAD_CMD  */
+#line 221 "mon_parse.y"
+                 { return ERR_BAD_CMD; }
+#line 2506 "mon_parse.c"
     break;
 
-  case 23:
-#line 225 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank(e_default_space, NULL); }
-#line 2392 "mon_parse.c" /* yacc.c:1646  */
+  case 23: /* machine_state_rules: CMD_BANK end_cmd  */
+#line 225 "mon_parse.y"
+                     { mon_bank(e_default_space, NULL); }
+#line 2512 "mon_parse.c"
     break;
 
-  case 24:
-#line 227 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank((yyvsp[-1].i), NULL); }
-#line 2398 "mon_parse.c" /* yacc.c:1646  */
+  case 24: /* machine_state_rules: CMD_BANK memspace end_cmd  */
+#line 227 "mon_parse.y"
+                     { mon_bank((yyvsp[-1].i), NULL); }
+#line 2518 "mon_parse.c"
     break;
 
-  case 25:
-#line 229 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank(e_default_space, (yyvsp[-1].str)); }
-#line 2404 "mon_parse.c" /* yacc.c:1646  */
+  case 25: /* machine_state_rules: CMD_BANK BANKNAME end_cmd  */
+#line 229 "mon_parse.y"
+                     { mon_bank(e_default_space, (yyvsp[-1].str)); }
+#line 2524 "mon_parse.c"
     break;
 
-  case 26:
-#line 231 "mon_parse.y" /* yacc.c:1646  */
-    { mon_bank((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2410 "mon_parse.c" /* yacc.c:1646  */
+  case 26: /* machine_state_rules: CMD_BANK memspace opt_sep BANKNAME end_cmd  */
+#line 231 "mon_parse.y"
+                     { mon_bank((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2530 "mon_parse.c"
     break;
 
-  case 27:
-#line 233 "mon_parse.y" /* yacc.c:1646  */
-    { mon_jump((yyvsp[-1].a)); }
-#line 2416 "mon_parse.c" /* yacc.c:1646  */
+  case 27: /* machine_state_rules: CMD_GOTO address end_cmd  */
+#line 233 "mon_parse.y"
+                     { mon_jump((yyvsp[-1].a)); }
+#line 2536 "mon_parse.c"
     break;
 
-  case 28:
-#line 235 "mon_parse.y" /* yacc.c:1646  */
-    { mon_go(); }
-#line 2422 "mon_parse.c" /* yacc.c:1646  */
+  case 28: /* machine_state_rules: CMD_GOTO end_cmd  */
+#line 235 "mon_parse.y"
+                     { mon_go(); }
+#line 2542 "mon_parse.c"
     break;
 
-  case 29:
-#line 237 "mon_parse.y" /* yacc.c:1646  */
-    { mon_display_io_regs(0); }
-#line 2428 "mon_parse.c" /* yacc.c:1646  */
+  case 29: /* machine_state_rules: CMD_IO end_cmd  */
+#line 237 "mon_parse.y"
+                     { mon_display_io_regs(0); }
+#line 2548 "mon_parse.c"
     break;
 
-  case 30:
-#line 239 "mon_parse.y" /* yacc.c:1646  */
-    { mon_display_io_regs((yyvsp[-1].a)); }
-#line 2434 "mon_parse.c" /* yacc.c:1646  */
+  case 30: /* machine_state_rules: CMD_IO address end_cmd  */
+#line 239 "mon_parse.y"
+                     { mon_display_io_regs((yyvsp[-1].a)); }
+#line 2554 "mon_parse.c"
     break;
 
-  case 31:
-#line 241 "mon_parse.y" /* yacc.c:1646  */
-    { monitor_cpu_type_set(""); }
-#line 2440 "mon_parse.c" /* yacc.c:1646  */
+  case 31: /* machine_state_rules: CMD_CPU end_cmd  */
+#line 241 "mon_parse.y"
+                     { monitor_cpu_type_set(""); }
+#line 2560 "mon_parse.c"
     break;
 
-  case 32:
-#line 243 "mon_parse.y" /* yacc.c:1646  */
-    { monitor_cpu_type_set((yyvsp[-1].str)); }
-#line 2446 "mon_parse.c" /* yacc.c:1646  */
+  case 32: /* machine_state_rules: CMD_CPU CPUTYPE end_cmd  */
+#line 243 "mon_parse.y"
+                     { monitor_cpu_type_set((yyvsp[-1].str)); }
+#line 2566 "mon_parse.c"
     break;
 
-  case 33:
-#line 245 "mon_parse.y" /* yacc.c:1646  */
-    { mon_cpuhistory(-1); }
-#line 2452 "mon_parse.c" /* yacc.c:1646  */
+  case 33: /* machine_state_rules: CMD_CPUHISTORY end_cmd  */
+#line 245 "mon_parse.y"
+                     { mon_cpuhistory(-1); }
+#line 2572 "mon_parse.c"
     break;
 
-  case 34:
-#line 247 "mon_parse.y" /* yacc.c:1646  */
-    { mon_cpuhistory((yyvsp[-1].i)); }
-#line 2458 "mon_parse.c" /* yacc.c:1646  */
+  case 34: /* machine_state_rules: CMD_CPUHISTORY opt_sep expression end_cmd  */
+#line 247 "mon_parse.y"
+                     { mon_cpuhistory((yyvsp[-1].i)); }
+#line 2578 "mon_parse.c"
     break;
 
-  case 35:
-#line 249 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instruction_return(); }
-#line 2464 "mon_parse.c" /* yacc.c:1646  */
+  case 35: /* machine_state_rules: CMD_RETURN end_cmd  */
+#line 249 "mon_parse.y"
+                     { mon_instruction_return(); }
+#line 2584 "mon_parse.c"
     break;
 
-  case 36:
-#line 251 "mon_parse.y" /* yacc.c:1646  */
-    { machine_write_snapshot((yyvsp[-1].str),0,0,0); /* FIXME */ }
-#line 2470 "mon_parse.c" /* yacc.c:1646  */
+  case 36: /* machine_state_rules: CMD_DUMP filename end_cmd  */
+#line 251 "mon_parse.y"
+                     { machine_write_snapshot((yyvsp[-1].str),0,0,0); /* FIXME */ }
+#line 2590 "mon_parse.c"
     break;
 
-  case 37:
-#line 253 "mon_parse.y" /* yacc.c:1646  */
-    { machine_read_snapshot((yyvsp[-1].str), 0); }
-#line 2476 "mon_parse.c" /* yacc.c:1646  */
+  case 37: /* machine_state_rules: CMD_UNDUMP filename end_cmd  */
+#line 253 "mon_parse.y"
+                     { machine_read_snapshot((yyvsp[-1].str), 0); }
+#line 2596 "mon_parse.c"
     break;
 
-  case 38:
-#line 255 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_step(-1); }
-#line 2482 "mon_parse.c" /* yacc.c:1646  */
+  case 38: /* machine_state_rules: CMD_STEP end_cmd  */
+#line 255 "mon_parse.y"
+                     { mon_instructions_step(-1); }
+#line 2602 "mon_parse.c"
     break;
 
-  case 39:
-#line 257 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_step((yyvsp[-1].i)); }
-#line 2488 "mon_parse.c" /* yacc.c:1646  */
+  case 39: /* machine_state_rules: CMD_STEP opt_sep expression end_cmd  */
+#line 257 "mon_parse.y"
+                     { mon_instructions_step((yyvsp[-1].i)); }
+#line 2608 "mon_parse.c"
     break;
 
-  case 40:
-#line 259 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_next(-1); }
-#line 2494 "mon_parse.c" /* yacc.c:1646  */
+  case 40: /* machine_state_rules: CMD_NEXT end_cmd  */
+#line 259 "mon_parse.y"
+                     { mon_instructions_next(-1); }
+#line 2614 "mon_parse.c"
     break;
 
-  case 41:
-#line 261 "mon_parse.y" /* yacc.c:1646  */
-    { mon_instructions_next((yyvsp[-1].i)); }
-#line 2500 "mon_parse.c" /* yacc.c:1646  */
+  case 41: /* machine_state_rules: CMD_NEXT opt_sep expression end_cmd  */
+#line 261 "mon_parse.y"
+                     { mon_instructions_next((yyvsp[-1].i)); }
+#line 2620 "mon_parse.c"
     break;
 
-  case 42:
-#line 263 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_up(-1); }
-#line 2506 "mon_parse.c" /* yacc.c:1646  */
+  case 42: /* machine_state_rules: CMD_UP end_cmd  */
+#line 263 "mon_parse.y"
+                     { mon_stack_up(-1); }
+#line 2626 "mon_parse.c"
     break;
 
-  case 43:
-#line 265 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_up((yyvsp[-1].i)); }
-#line 2512 "mon_parse.c" /* yacc.c:1646  */
+  case 43: /* machine_state_rules: CMD_UP opt_sep expression end_cmd  */
+#line 265 "mon_parse.y"
+                     { mon_stack_up((yyvsp[-1].i)); }
+#line 2632 "mon_parse.c"
     break;
 
-  case 44:
-#line 267 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_down(-1); }
-#line 2518 "mon_parse.c" /* yacc.c:1646  */
+  case 44: /* machine_state_rules: CMD_DOWN end_cmd  */
+#line 267 "mon_parse.y"
+                     { mon_stack_down(-1); }
+#line 2638 "mon_parse.c"
     break;
 
-  case 45:
-#line 269 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stack_down((yyvsp[-1].i)); }
-#line 2524 "mon_parse.c" /* yacc.c:1646  */
+  case 45: /* machine_state_rules: CMD_DOWN opt_sep expression end_cmd  */
+#line 269 "mon_parse.y"
+                     { mon_stack_down((yyvsp[-1].i)); }
+#line 2644 "mon_parse.c"
     break;
 
-  case 46:
-#line 271 "mon_parse.y" /* yacc.c:1646  */
-    { mon_display_screen(); }
-#line 2530 "mon_parse.c" /* yacc.c:1646  */
+  case 46: /* machine_state_rules: CMD_SCREEN end_cmd  */
+#line 271 "mon_parse.y"
+                     { mon_display_screen(); }
+#line 2650 "mon_parse.c"
     break;
 
-  case 48:
-#line 276 "mon_parse.y" /* yacc.c:1646  */
-    { (monitor_cpu_for_memspace[default_memspace]->mon_register_print)(default_memspace); }
-#line 2536 "mon_parse.c" /* yacc.c:1646  */
+  case 48: /* register_mod: CMD_REGISTERS end_cmd  */
+#line 276 "mon_parse.y"
+              { (monitor_cpu_for_memspace[default_memspace]->mon_register_print)(default_memspace); }
+#line 2656 "mon_parse.c"
     break;
 
-  case 49:
-#line 278 "mon_parse.y" /* yacc.c:1646  */
-    { (monitor_cpu_for_memspace[(yyvsp[-1].i)]->mon_register_print)((yyvsp[-1].i)); }
-#line 2542 "mon_parse.c" /* yacc.c:1646  */
+  case 49: /* register_mod: CMD_REGISTERS memspace end_cmd  */
+#line 278 "mon_parse.y"
+              { (monitor_cpu_for_memspace[(yyvsp[-1].i)]->mon_register_print)((yyvsp[-1].i)); }
+#line 2662 "mon_parse.c"
     break;
 
-  case 51:
-#line 283 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 51: /* symbol_table_rules: CMD_LOAD_LABELS memspace opt_sep filename end_cmd  */
+#line 283 "mon_parse.y"
+                    {
                         /* What about the memspace? */
                         mon_playback_init((yyvsp[-1].str));
                     }
-#line 2551 "mon_parse.c" /* yacc.c:1646  */
+#line 2671 "mon_parse.c"
     break;
 
-  case 52:
-#line 288 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 52: /* symbol_table_rules: CMD_LOAD_LABELS filename end_cmd  */
+#line 288 "mon_parse.y"
+                    {
                         /* What about the memspace? */
                         mon_playback_init((yyvsp[-1].str));
                     }
-#line 2560 "mon_parse.c" /* yacc.c:1646  */
+#line 2680 "mon_parse.c"
     break;
 
-  case 53:
-#line 293 "mon_parse.y" /* yacc.c:1646  */
-    { mon_save_symbols((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2566 "mon_parse.c" /* yacc.c:1646  */
+  case 53: /* symbol_table_rules: CMD_SAVE_LABELS memspace opt_sep filename end_cmd  */
+#line 293 "mon_parse.y"
+                    { mon_save_symbols((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2686 "mon_parse.c"
     break;
 
-  case 54:
-#line 295 "mon_parse.y" /* yacc.c:1646  */
-    { mon_save_symbols(e_default_space, (yyvsp[-1].str)); }
-#line 2572 "mon_parse.c" /* yacc.c:1646  */
+  case 54: /* symbol_table_rules: CMD_SAVE_LABELS filename end_cmd  */
+#line 295 "mon_parse.y"
+                    { mon_save_symbols(e_default_space, (yyvsp[-1].str)); }
+#line 2692 "mon_parse.c"
     break;
 
-  case 55:
-#line 297 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_name_to_symbol_table((yyvsp[-3].a), (yyvsp[-1].str)); }
-#line 2578 "mon_parse.c" /* yacc.c:1646  */
+  case 55: /* symbol_table_rules: CMD_ADD_LABEL address opt_sep LABEL end_cmd  */
+#line 297 "mon_parse.y"
+                    { mon_add_name_to_symbol_table((yyvsp[-3].a), (yyvsp[-1].str)); }
+#line 2698 "mon_parse.c"
     break;
 
-  case 56:
-#line 299 "mon_parse.y" /* yacc.c:1646  */
-    { mon_remove_name_from_symbol_table(e_default_space, (yyvsp[-1].str)); }
-#line 2584 "mon_parse.c" /* yacc.c:1646  */
+  case 56: /* symbol_table_rules: CMD_DEL_LABEL LABEL end_cmd  */
+#line 299 "mon_parse.y"
+                    { mon_remove_name_from_symbol_table(e_default_space, (yyvsp[-1].str)); }
+#line 2704 "mon_parse.c"
     break;
 
-  case 57:
-#line 301 "mon_parse.y" /* yacc.c:1646  */
-    { mon_remove_name_from_symbol_table((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2590 "mon_parse.c" /* yacc.c:1646  */
+  case 57: /* symbol_table_rules: CMD_DEL_LABEL memspace opt_sep LABEL end_cmd  */
+#line 301 "mon_parse.y"
+                    { mon_remove_name_from_symbol_table((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 2710 "mon_parse.c"
     break;
 
-  case 58:
-#line 303 "mon_parse.y" /* yacc.c:1646  */
-    { mon_print_symbol_table((yyvsp[-1].i)); }
-#line 2596 "mon_parse.c" /* yacc.c:1646  */
+  case 58: /* symbol_table_rules: CMD_SHOW_LABELS memspace end_cmd  */
+#line 303 "mon_parse.y"
+                    { mon_print_symbol_table((yyvsp[-1].i)); }
+#line 2716 "mon_parse.c"
     break;
 
-  case 59:
-#line 305 "mon_parse.y" /* yacc.c:1646  */
-    { mon_print_symbol_table(e_default_space); }
-#line 2602 "mon_parse.c" /* yacc.c:1646  */
+  case 59: /* symbol_table_rules: CMD_SHOW_LABELS end_cmd  */
+#line 305 "mon_parse.y"
+                    { mon_print_symbol_table(e_default_space); }
+#line 2722 "mon_parse.c"
     break;
 
-  case 60:
-#line 307 "mon_parse.y" /* yacc.c:1646  */
-    { mon_clear_symbol_table((yyvsp[-1].i)); }
-#line 2608 "mon_parse.c" /* yacc.c:1646  */
+  case 60: /* symbol_table_rules: CMD_CLEAR_LABELS memspace end_cmd  */
+#line 307 "mon_parse.y"
+                    { mon_clear_symbol_table((yyvsp[-1].i)); }
+#line 2728 "mon_parse.c"
     break;
 
-  case 61:
-#line 309 "mon_parse.y" /* yacc.c:1646  */
-    { mon_clear_symbol_table(e_default_space); }
-#line 2614 "mon_parse.c" /* yacc.c:1646  */
+  case 61: /* symbol_table_rules: CMD_CLEAR_LABELS end_cmd  */
+#line 309 "mon_parse.y"
+                    { mon_clear_symbol_table(e_default_space); }
+#line 2734 "mon_parse.c"
     break;
 
-  case 62:
-#line 311 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 62: /* symbol_table_rules: CMD_LABEL_ASGN EQUALS address end_cmd  */
+#line 311 "mon_parse.y"
+                    {
                         mon_add_name_to_symbol_table((yyvsp[-1].a), mon_prepend_dot_to_name((yyvsp[-3].str)));
                     }
-#line 2622 "mon_parse.c" /* yacc.c:1646  */
+#line 2742 "mon_parse.c"
     break;
 
-  case 63:
-#line 315 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 63: /* symbol_table_rules: CMD_LABEL_ASGN EQUALS address LABEL_ASGN_COMMENT end_cmd  */
+#line 315 "mon_parse.y"
+                    {
                         mon_add_name_to_symbol_table((yyvsp[-2].a), mon_prepend_dot_to_name((yyvsp[-4].str)));
                     }
-#line 2630 "mon_parse.c" /* yacc.c:1646  */
+#line 2750 "mon_parse.c"
     break;
 
-  case 64:
-#line 321 "mon_parse.y" /* yacc.c:1646  */
-    { mon_start_assemble_mode((yyvsp[0].a), NULL); }
-#line 2636 "mon_parse.c" /* yacc.c:1646  */
+  case 64: /* $@1: %empty  */
+#line 321 "mon_parse.y"
+           { mon_start_assemble_mode((yyvsp[0].a), NULL); }
+#line 2756 "mon_parse.c"
     break;
 
-  case 65:
-#line 322 "mon_parse.y" /* yacc.c:1646  */
-    { }
-#line 2642 "mon_parse.c" /* yacc.c:1646  */
+  case 65: /* asm_rules: CMD_ASSEMBLE address $@1 post_assemble end_cmd  */
+#line 322 "mon_parse.y"
+           { }
+#line 2762 "mon_parse.c"
     break;
 
-  case 66:
-#line 324 "mon_parse.y" /* yacc.c:1646  */
-    { mon_start_assemble_mode((yyvsp[-1].a), NULL); }
-#line 2648 "mon_parse.c" /* yacc.c:1646  */
+  case 66: /* asm_rules: CMD_ASSEMBLE address end_cmd  */
+#line 324 "mon_parse.y"
+           { mon_start_assemble_mode((yyvsp[-1].a), NULL); }
+#line 2768 "mon_parse.c"
     break;
 
-  case 67:
-#line 326 "mon_parse.y" /* yacc.c:1646  */
-    { mon_disassemble_lines((yyvsp[-1].range)[0], (yyvsp[-1].range)[1]); }
-#line 2654 "mon_parse.c" /* yacc.c:1646  */
+  case 67: /* asm_rules: CMD_DISASSEMBLE address_opt_range end_cmd  */
+#line 326 "mon_parse.y"
+           { mon_disassemble_lines((yyvsp[-1].range)[0], (yyvsp[-1].range)[1]); }
+#line 2774 "mon_parse.c"
     break;
 
-  case 68:
-#line 328 "mon_parse.y" /* yacc.c:1646  */
-    { mon_disassemble_lines(BAD_ADDR, BAD_ADDR); }
-#line 2660 "mon_parse.c" /* yacc.c:1646  */
+  case 68: /* asm_rules: CMD_DISASSEMBLE end_cmd  */
+#line 328 "mon_parse.y"
+           { mon_disassemble_lines(BAD_ADDR, BAD_ADDR); }
+#line 2780 "mon_parse.c"
     break;
 
-  case 69:
-#line 332 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_move((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
-#line 2666 "mon_parse.c" /* yacc.c:1646  */
+  case 69: /* memory_rules: CMD_MOVE address_range opt_sep address end_cmd  */
+#line 332 "mon_parse.y"
+              { mon_memory_move((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
+#line 2786 "mon_parse.c"
     break;
 
-  case 70:
-#line 334 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_compare((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
-#line 2672 "mon_parse.c" /* yacc.c:1646  */
+  case 70: /* memory_rules: CMD_COMPARE address_range opt_sep address end_cmd  */
+#line 334 "mon_parse.y"
+              { mon_memory_compare((yyvsp[-3].range)[0], (yyvsp[-3].range)[1], (yyvsp[-1].a)); }
+#line 2792 "mon_parse.c"
     break;
 
-  case 71:
-#line 336 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_fill((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
-#line 2678 "mon_parse.c" /* yacc.c:1646  */
+  case 71: /* memory_rules: CMD_FILL address_range opt_sep data_list end_cmd  */
+#line 336 "mon_parse.y"
+              { mon_memory_fill((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
+#line 2798 "mon_parse.c"
     break;
 
-  case 72:
-#line 338 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_hunt((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
-#line 2684 "mon_parse.c" /* yacc.c:1646  */
+  case 72: /* memory_rules: CMD_HUNT address_range opt_sep hunt_list end_cmd  */
+#line 338 "mon_parse.y"
+              { mon_memory_hunt((yyvsp[-3].range)[0], (yyvsp[-3].range)[1],(unsigned char *)(yyvsp[-1].str)); }
+#line 2804 "mon_parse.c"
     break;
 
-  case 73:
-#line 340 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display((yyvsp[-3].rt), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2690 "mon_parse.c" /* yacc.c:1646  */
+  case 73: /* memory_rules: CMD_MEM_DISPLAY RADIX_TYPE opt_sep address_opt_range end_cmd  */
+#line 340 "mon_parse.y"
+              { mon_memory_display((yyvsp[-3].rt), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
+#line 2810 "mon_parse.c"
     break;
 
-  case 74:
-#line 342 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(default_radix, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2696 "mon_parse.c" /* yacc.c:1646  */
+  case 74: /* memory_rules: CMD_MEM_DISPLAY address_opt_range end_cmd  */
+#line 342 "mon_parse.y"
+              { mon_memory_display(default_radix, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
+#line 2816 "mon_parse.c"
     break;
 
-  case 75:
-#line 344 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(default_radix, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
-#line 2702 "mon_parse.c" /* yacc.c:1646  */
+  case 75: /* memory_rules: CMD_MEM_DISPLAY end_cmd  */
+#line 344 "mon_parse.y"
+              { mon_memory_display(default_radix, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
+#line 2822 "mon_parse.c"
     break;
 
-  case 76:
-#line 346 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 8, 8); }
-#line 2708 "mon_parse.c" /* yacc.c:1646  */
+  case 76: /* memory_rules: CMD_CHAR_DISPLAY address_opt_range end_cmd  */
+#line 346 "mon_parse.y"
+              { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 8, 8); }
+#line 2828 "mon_parse.c"
     break;
 
-  case 77:
-#line 348 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 8, 8); }
-#line 2714 "mon_parse.c" /* yacc.c:1646  */
+  case 77: /* memory_rules: CMD_CHAR_DISPLAY end_cmd  */
+#line 348 "mon_parse.y"
+              { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 8, 8); }
+#line 2834 "mon_parse.c"
     break;
 
-  case 78:
-#line 350 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 24, 21); }
-#line 2720 "mon_parse.c" /* yacc.c:1646  */
+  case 78: /* memory_rules: CMD_SPRITE_DISPLAY address_opt_range end_cmd  */
+#line 350 "mon_parse.y"
+              { mon_memory_display_data((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], 24, 21); }
+#line 2840 "mon_parse.c"
     break;
 
-  case 79:
-#line 352 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 24, 21); }
-#line 2726 "mon_parse.c" /* yacc.c:1646  */
+  case 79: /* memory_rules: CMD_SPRITE_DISPLAY end_cmd  */
+#line 352 "mon_parse.y"
+              { mon_memory_display_data(BAD_ADDR, BAD_ADDR, 24, 21); }
+#line 2846 "mon_parse.c"
     break;
 
-  case 80:
-#line 354 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
-#line 2732 "mon_parse.c" /* yacc.c:1646  */
+  case 80: /* memory_rules: CMD_TEXT_DISPLAY address_opt_range end_cmd  */
+#line 354 "mon_parse.y"
+              { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_PETSCII); }
+#line 2852 "mon_parse.c"
     break;
 
-  case 81:
-#line 356 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
-#line 2738 "mon_parse.c" /* yacc.c:1646  */
+  case 81: /* memory_rules: CMD_TEXT_DISPLAY end_cmd  */
+#line 356 "mon_parse.y"
+              { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_PETSCII); }
+#line 2858 "mon_parse.c"
     break;
 
-  case 82:
-#line 358 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_SCREEN_CODE); }
-#line 2744 "mon_parse.c" /* yacc.c:1646  */
+  case 82: /* memory_rules: CMD_SCREENCODE_DISPLAY address_opt_range end_cmd  */
+#line 358 "mon_parse.y"
+              { mon_memory_display(0, (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], DF_SCREEN_CODE); }
+#line 2864 "mon_parse.c"
     break;
 
-  case 83:
-#line 360 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_SCREEN_CODE); }
-#line 2750 "mon_parse.c" /* yacc.c:1646  */
+  case 83: /* memory_rules: CMD_SCREENCODE_DISPLAY end_cmd  */
+#line 360 "mon_parse.y"
+              { mon_memory_display(0, BAD_ADDR, BAD_ADDR, DF_SCREEN_CODE); }
+#line 2870 "mon_parse.c"
     break;
 
-  case 84:
-#line 362 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_zap(); }
-#line 2756 "mon_parse.c" /* yacc.c:1646  */
+  case 84: /* memory_rules: CMD_MEMMAPZAP end_cmd  */
+#line 362 "mon_parse.y"
+              { mon_memmap_zap(); }
+#line 2876 "mon_parse.c"
     break;
 
-  case 85:
-#line 364 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_show(-1,BAD_ADDR,BAD_ADDR); }
-#line 2762 "mon_parse.c" /* yacc.c:1646  */
+  case 85: /* memory_rules: CMD_MEMMAPSHOW end_cmd  */
+#line 364 "mon_parse.y"
+              { mon_memmap_show(-1,BAD_ADDR,BAD_ADDR); }
+#line 2882 "mon_parse.c"
     break;
 
-  case 86:
-#line 366 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_show((yyvsp[-1].i),BAD_ADDR,BAD_ADDR); }
-#line 2768 "mon_parse.c" /* yacc.c:1646  */
+  case 86: /* memory_rules: CMD_MEMMAPSHOW opt_sep expression end_cmd  */
+#line 366 "mon_parse.y"
+              { mon_memmap_show((yyvsp[-1].i),BAD_ADDR,BAD_ADDR); }
+#line 2888 "mon_parse.c"
     break;
 
-  case 87:
-#line 368 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_show((yyvsp[-2].i),(yyvsp[-1].range)[0],(yyvsp[-1].range)[1]); }
-#line 2774 "mon_parse.c" /* yacc.c:1646  */
+  case 87: /* memory_rules: CMD_MEMMAPSHOW opt_sep expression address_opt_range end_cmd  */
+#line 368 "mon_parse.y"
+              { mon_memmap_show((yyvsp[-2].i),(yyvsp[-1].range)[0],(yyvsp[-1].range)[1]); }
+#line 2894 "mon_parse.c"
     break;
 
-  case 88:
-#line 370 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memmap_save((yyvsp[-3].str),(yyvsp[-1].i)); }
-#line 2780 "mon_parse.c" /* yacc.c:1646  */
+  case 88: /* memory_rules: CMD_MEMMAPSAVE filename opt_sep expression end_cmd  */
+#line 370 "mon_parse.y"
+              { mon_memmap_save((yyvsp[-3].str),(yyvsp[-1].i)); }
+#line 2900 "mon_parse.c"
     break;
 
-  case 89:
-#line 374 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 89: /* checkpoint_rules: CMD_BREAK opt_mem_op address_opt_range opt_if_cond_expr end_cmd  */
+#line 374 "mon_parse.y"
+                  {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], TRUE, (yyvsp[-3].i), FALSE);
                       } else {
@@ -2789,32 +2909,32 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2793 "mon_parse.c" /* yacc.c:1646  */
+#line 2913 "mon_parse.c"
     break;
 
-  case 90:
-#line 383 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2799 "mon_parse.c" /* yacc.c:1646  */
+  case 90: /* checkpoint_rules: CMD_BREAK end_cmd  */
+#line 383 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2919 "mon_parse.c"
     break;
 
-  case 91:
-#line 386 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 91: /* checkpoint_rules: CMD_UNTIL address_opt_range end_cmd  */
+#line 386 "mon_parse.y"
+                  {
                       mon_breakpoint_add_checkpoint((yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE, e_exec, TRUE);
                   }
-#line 2807 "mon_parse.c" /* yacc.c:1646  */
+#line 2927 "mon_parse.c"
     break;
 
-  case 92:
-#line 390 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2813 "mon_parse.c" /* yacc.c:1646  */
+  case 92: /* checkpoint_rules: CMD_UNTIL end_cmd  */
+#line 390 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2933 "mon_parse.c"
     break;
 
-  case 93:
-#line 393 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 93: /* checkpoint_rules: CMD_WATCH opt_mem_op address_opt_range opt_if_cond_expr end_cmd  */
+#line 393 "mon_parse.y"
+                  {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], TRUE, (yyvsp[-3].i), FALSE);
                       } else {
@@ -2822,18 +2942,18 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2826 "mon_parse.c" /* yacc.c:1646  */
+#line 2946 "mon_parse.c"
     break;
 
-  case 94:
-#line 402 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2832 "mon_parse.c" /* yacc.c:1646  */
+  case 94: /* checkpoint_rules: CMD_WATCH end_cmd  */
+#line 402 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2952 "mon_parse.c"
     break;
 
-  case 95:
-#line 405 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 95: /* checkpoint_rules: CMD_TRACE opt_mem_op address_opt_range opt_if_cond_expr end_cmd  */
+#line 405 "mon_parse.y"
+                  {
                       if ((yyvsp[-3].i)) {
                           temp = mon_breakpoint_add_checkpoint((yyvsp[-2].range)[0], (yyvsp[-2].range)[1], FALSE, (yyvsp[-3].i), FALSE);
                       } else {
@@ -2841,105 +2961,105 @@ yyreduce:
                       }
                       mon_breakpoint_set_checkpoint_condition(temp, (yyvsp[-1].cond_node));
                   }
-#line 2845 "mon_parse.c" /* yacc.c:1646  */
+#line 2965 "mon_parse.c"
     break;
 
-  case 96:
-#line 414 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_print_checkpoints(); }
-#line 2851 "mon_parse.c" /* yacc.c:1646  */
+  case 96: /* checkpoint_rules: CMD_TRACE end_cmd  */
+#line 414 "mon_parse.y"
+                  { mon_breakpoint_print_checkpoints(); }
+#line 2971 "mon_parse.c"
     break;
 
-  case 97:
-#line 419 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_ON, (yyvsp[-1].i)); }
-#line 2857 "mon_parse.c" /* yacc.c:1646  */
+  case 97: /* checkpoint_control_rules: CMD_CHECKPT_ON checkpt_num end_cmd  */
+#line 419 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_ON, (yyvsp[-1].i)); }
+#line 2977 "mon_parse.c"
     break;
 
-  case 98:
-#line 421 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_ON, -1); }
-#line 2863 "mon_parse.c" /* yacc.c:1646  */
+  case 98: /* checkpoint_control_rules: CMD_CHECKPT_ON end_cmd  */
+#line 421 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_ON, -1); }
+#line 2983 "mon_parse.c"
     break;
 
-  case 99:
-#line 423 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_OFF, (yyvsp[-1].i)); }
-#line 2869 "mon_parse.c" /* yacc.c:1646  */
+  case 99: /* checkpoint_control_rules: CMD_CHECKPT_OFF checkpt_num end_cmd  */
+#line 423 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_OFF, (yyvsp[-1].i)); }
+#line 2989 "mon_parse.c"
     break;
 
-  case 100:
-#line 425 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_switch_checkpoint(e_OFF, -1); }
-#line 2875 "mon_parse.c" /* yacc.c:1646  */
+  case 100: /* checkpoint_control_rules: CMD_CHECKPT_OFF end_cmd  */
+#line 425 "mon_parse.y"
+                          { mon_breakpoint_switch_checkpoint(e_OFF, -1); }
+#line 2995 "mon_parse.c"
     break;
 
-  case 101:
-#line 427 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_ignore_count((yyvsp[-1].i), -1); }
-#line 2881 "mon_parse.c" /* yacc.c:1646  */
+  case 101: /* checkpoint_control_rules: CMD_IGNORE checkpt_num end_cmd  */
+#line 427 "mon_parse.y"
+                          { mon_breakpoint_set_ignore_count((yyvsp[-1].i), -1); }
+#line 3001 "mon_parse.c"
     break;
 
-  case 102:
-#line 429 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_ignore_count((yyvsp[-3].i), (yyvsp[-1].i)); }
-#line 2887 "mon_parse.c" /* yacc.c:1646  */
+  case 102: /* checkpoint_control_rules: CMD_IGNORE checkpt_num opt_sep expression end_cmd  */
+#line 429 "mon_parse.y"
+                          { mon_breakpoint_set_ignore_count((yyvsp[-3].i), (yyvsp[-1].i)); }
+#line 3007 "mon_parse.c"
     break;
 
-  case 103:
-#line 431 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_delete_checkpoint((yyvsp[-1].i)); }
-#line 2893 "mon_parse.c" /* yacc.c:1646  */
+  case 103: /* checkpoint_control_rules: CMD_DELETE checkpt_num end_cmd  */
+#line 431 "mon_parse.y"
+                          { mon_breakpoint_delete_checkpoint((yyvsp[-1].i)); }
+#line 3013 "mon_parse.c"
     break;
 
-  case 104:
-#line 433 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_delete_checkpoint(-1); }
-#line 2899 "mon_parse.c" /* yacc.c:1646  */
+  case 104: /* checkpoint_control_rules: CMD_DELETE end_cmd  */
+#line 433 "mon_parse.y"
+                          { mon_breakpoint_delete_checkpoint(-1); }
+#line 3019 "mon_parse.c"
     break;
 
-  case 105:
-#line 435 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_checkpoint_condition((yyvsp[-3].i), (yyvsp[-1].cond_node)); }
-#line 2905 "mon_parse.c" /* yacc.c:1646  */
+  case 105: /* checkpoint_control_rules: CMD_CONDITION checkpt_num IF cond_expr end_cmd  */
+#line 435 "mon_parse.y"
+                          { mon_breakpoint_set_checkpoint_condition((yyvsp[-3].i), (yyvsp[-1].cond_node)); }
+#line 3025 "mon_parse.c"
     break;
 
-  case 106:
-#line 437 "mon_parse.y" /* yacc.c:1646  */
-    { mon_breakpoint_set_checkpoint_command((yyvsp[-3].i), (yyvsp[-1].str)); }
-#line 2911 "mon_parse.c" /* yacc.c:1646  */
+  case 106: /* checkpoint_control_rules: CMD_COMMAND checkpt_num opt_sep STRING end_cmd  */
+#line 437 "mon_parse.y"
+                          { mon_breakpoint_set_checkpoint_command((yyvsp[-3].i), (yyvsp[-1].str)); }
+#line 3031 "mon_parse.c"
     break;
 
-  case 107:
-#line 439 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_STRING; }
-#line 2917 "mon_parse.c" /* yacc.c:1646  */
+  case 107: /* checkpoint_control_rules: CMD_COMMAND checkpt_num error end_cmd  */
+#line 439 "mon_parse.y"
+                          { return ERR_EXPECT_STRING; }
+#line 3037 "mon_parse.c"
     break;
 
-  case 108:
-#line 443 "mon_parse.y" /* yacc.c:1646  */
-    { sidefx = (((yyvsp[-1].action) == e_TOGGLE) ? (sidefx ^ 1) : (yyvsp[-1].action)); }
-#line 2923 "mon_parse.c" /* yacc.c:1646  */
+  case 108: /* monitor_state_rules: CMD_SIDEFX TOGGLE end_cmd  */
+#line 443 "mon_parse.y"
+                     { sidefx = (((yyvsp[-1].action) == e_TOGGLE) ? (sidefx ^ 1) : (yyvsp[-1].action)); }
+#line 3043 "mon_parse.c"
     break;
 
-  case 109:
-#line 445 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 109: /* monitor_state_rules: CMD_SIDEFX end_cmd  */
+#line 445 "mon_parse.y"
+                     {
                          mon_out("I/O side effects are %s\n",
                                    sidefx ? "enabled" : "disabled");
                      }
-#line 2932 "mon_parse.c" /* yacc.c:1646  */
+#line 3052 "mon_parse.c"
     break;
 
-  case 110:
-#line 450 "mon_parse.y" /* yacc.c:1646  */
-    { default_radix = (yyvsp[-1].rt); }
-#line 2938 "mon_parse.c" /* yacc.c:1646  */
+  case 110: /* monitor_state_rules: CMD_RADIX RADIX_TYPE end_cmd  */
+#line 450 "mon_parse.y"
+                     { default_radix = (yyvsp[-1].rt); }
+#line 3058 "mon_parse.c"
     break;
 
-  case 111:
-#line 452 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 111: /* monitor_state_rules: CMD_RADIX end_cmd  */
+#line 452 "mon_parse.y"
+                     {
                          const char *p;
 
                          if (default_radix == e_hexadecimal)
@@ -2955,749 +3075,761 @@ yyreduce:
 
                          mon_out("Default radix is %s\n", p);
                      }
-#line 2959 "mon_parse.c" /* yacc.c:1646  */
+#line 3079 "mon_parse.c"
     break;
 
-  case 112:
-#line 470 "mon_parse.y" /* yacc.c:1646  */
-    { monitor_change_device((yyvsp[-1].i)); }
-#line 2965 "mon_parse.c" /* yacc.c:1646  */
+  case 112: /* monitor_state_rules: CMD_DEVICE memspace end_cmd  */
+#line 470 "mon_parse.y"
+                     { monitor_change_device((yyvsp[-1].i)); }
+#line 3085 "mon_parse.c"
     break;
 
-  case 113:
-#line 472 "mon_parse.y" /* yacc.c:1646  */
-    { mon_export(); }
-#line 2971 "mon_parse.c" /* yacc.c:1646  */
+  case 113: /* monitor_state_rules: CMD_EXPORT end_cmd  */
+#line 472 "mon_parse.y"
+                     { mon_export(); }
+#line 3091 "mon_parse.c"
     break;
 
-  case 114:
-#line 474 "mon_parse.y" /* yacc.c:1646  */
-    { mon_quit(); YYACCEPT; }
-#line 2977 "mon_parse.c" /* yacc.c:1646  */
+  case 114: /* monitor_state_rules: CMD_QUIT end_cmd  */
+#line 474 "mon_parse.y"
+                     { mon_quit(); YYACCEPT; }
+#line 3097 "mon_parse.c"
     break;
 
-  case 115:
-#line 476 "mon_parse.y" /* yacc.c:1646  */
-    { mon_exit(); YYACCEPT; }
-#line 2983 "mon_parse.c" /* yacc.c:1646  */
+  case 115: /* monitor_state_rules: CMD_EXIT end_cmd  */
+#line 476 "mon_parse.y"
+                     { mon_exit(); YYACCEPT; }
+#line 3103 "mon_parse.c"
     break;
 
-  case 116:
-#line 480 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_execute_disk_cmd((yyvsp[-1].str)); }
-#line 2989 "mon_parse.c" /* yacc.c:1646  */
+  case 116: /* monitor_misc_rules: CMD_DISK rest_of_line end_cmd  */
+#line 480 "mon_parse.y"
+                    { mon_drive_execute_disk_cmd((yyvsp[-1].str)); }
+#line 3109 "mon_parse.c"
     break;
 
-  case 117:
-#line 482 "mon_parse.y" /* yacc.c:1646  */
-    { mon_out("\t%d\n",(yyvsp[-1].i)); }
-#line 2995 "mon_parse.c" /* yacc.c:1646  */
+  case 117: /* monitor_misc_rules: CMD_PRINT expression end_cmd  */
+#line 482 "mon_parse.y"
+                    { mon_out("\t%d\n",(yyvsp[-1].i)); }
+#line 3115 "mon_parse.c"
     break;
 
-  case 118:
-#line 484 "mon_parse.y" /* yacc.c:1646  */
-    { mon_command_print_help(NULL); }
-#line 3001 "mon_parse.c" /* yacc.c:1646  */
+  case 118: /* monitor_misc_rules: CMD_HELP end_cmd  */
+#line 484 "mon_parse.y"
+                    { mon_command_print_help(NULL); }
+#line 3121 "mon_parse.c"
     break;
 
-  case 119:
-#line 486 "mon_parse.y" /* yacc.c:1646  */
-    { mon_command_print_help((yyvsp[-1].str)); }
-#line 3007 "mon_parse.c" /* yacc.c:1646  */
+  case 119: /* monitor_misc_rules: CMD_HELP rest_of_line end_cmd  */
+#line 486 "mon_parse.y"
+                    { mon_command_print_help((yyvsp[-1].str)); }
+#line 3127 "mon_parse.c"
     break;
 
-  case 120:
-#line 488 "mon_parse.y" /* yacc.c:1646  */
-    { mon_print_convert((yyvsp[-1].i)); }
-#line 3013 "mon_parse.c" /* yacc.c:1646  */
+  case 120: /* monitor_misc_rules: CONVERT_OP expression end_cmd  */
+#line 488 "mon_parse.y"
+                    { mon_print_convert((yyvsp[-1].i)); }
+#line 3133 "mon_parse.c"
     break;
 
-  case 121:
-#line 490 "mon_parse.y" /* yacc.c:1646  */
-    { mon_change_dir((yyvsp[-1].str)); }
-#line 3019 "mon_parse.c" /* yacc.c:1646  */
+  case 121: /* monitor_misc_rules: CMD_CHDIR rest_of_line end_cmd  */
+#line 490 "mon_parse.y"
+                    { mon_change_dir((yyvsp[-1].str)); }
+#line 3139 "mon_parse.c"
     break;
 
-  case 122:
-#line 492 "mon_parse.y" /* yacc.c:1646  */
-    { mon_keyboard_feed((yyvsp[-1].str)); }
-#line 3025 "mon_parse.c" /* yacc.c:1646  */
+  case 122: /* monitor_misc_rules: CMD_KEYBUF rest_of_line end_cmd  */
+#line 492 "mon_parse.y"
+                    { mon_keyboard_feed((yyvsp[-1].str)); }
+#line 3145 "mon_parse.c"
     break;
 
-  case 123:
-#line 494 "mon_parse.y" /* yacc.c:1646  */
-    { mon_backtrace(); }
-#line 3031 "mon_parse.c" /* yacc.c:1646  */
+  case 123: /* monitor_misc_rules: CMD_BACKTRACE end_cmd  */
+#line 494 "mon_parse.y"
+                    { mon_backtrace(); }
+#line 3151 "mon_parse.c"
     break;
 
-  case 124:
-#line 496 "mon_parse.y" /* yacc.c:1646  */
-    { mon_show_dir((yyvsp[-1].str)); }
-#line 3037 "mon_parse.c" /* yacc.c:1646  */
+  case 124: /* monitor_misc_rules: CMD_DIR opt_rest_of_line end_cmd  */
+#line 496 "mon_parse.y"
+                     { mon_show_dir((yyvsp[-1].str)); }
+#line 3157 "mon_parse.c"
     break;
 
-  case 125:
-#line 498 "mon_parse.y" /* yacc.c:1646  */
-    { mon_show_pwd(); }
-#line 3043 "mon_parse.c" /* yacc.c:1646  */
+  case 125: /* monitor_misc_rules: CMD_PWD end_cmd  */
+#line 498 "mon_parse.y"
+                     { mon_show_pwd(); }
+#line 3163 "mon_parse.c"
     break;
 
-  case 126:
-#line 500 "mon_parse.y" /* yacc.c:1646  */
-    { mon_screenshot_save((yyvsp[-1].str),-1); }
-#line 3049 "mon_parse.c" /* yacc.c:1646  */
+  case 126: /* monitor_misc_rules: CMD_SCREENSHOT filename end_cmd  */
+#line 500 "mon_parse.y"
+                    { mon_screenshot_save((yyvsp[-1].str),-1); }
+#line 3169 "mon_parse.c"
     break;
 
-  case 127:
-#line 502 "mon_parse.y" /* yacc.c:1646  */
-    { mon_screenshot_save((yyvsp[-3].str),(yyvsp[-1].i)); }
-#line 3055 "mon_parse.c" /* yacc.c:1646  */
+  case 127: /* monitor_misc_rules: CMD_SCREENSHOT filename opt_sep expression end_cmd  */
+#line 502 "mon_parse.y"
+                    { mon_screenshot_save((yyvsp[-3].str),(yyvsp[-1].i)); }
+#line 3175 "mon_parse.c"
     break;
 
-  case 128:
-#line 504 "mon_parse.y" /* yacc.c:1646  */
-    { mon_resource_get((yyvsp[-1].str)); }
-#line 3061 "mon_parse.c" /* yacc.c:1646  */
+  case 128: /* monitor_misc_rules: CMD_RESOURCE_GET STRING end_cmd  */
+#line 504 "mon_parse.y"
+                    { mon_resource_get((yyvsp[-1].str)); }
+#line 3181 "mon_parse.c"
     break;
 
-  case 129:
-#line 506 "mon_parse.y" /* yacc.c:1646  */
-    { mon_resource_set((yyvsp[-2].str),(yyvsp[-1].str)); }
-#line 3067 "mon_parse.c" /* yacc.c:1646  */
+  case 129: /* monitor_misc_rules: CMD_RESOURCE_SET STRING STRING end_cmd  */
+#line 506 "mon_parse.y"
+                    { mon_resource_set((yyvsp[-2].str),(yyvsp[-1].str)); }
+#line 3187 "mon_parse.c"
     break;
 
-  case 130:
-#line 508 "mon_parse.y" /* yacc.c:1646  */
-    { resources_load((yyvsp[-1].str)); }
-#line 3073 "mon_parse.c" /* yacc.c:1646  */
+  case 130: /* monitor_misc_rules: CMD_LOAD_RESOURCES filename end_cmd  */
+#line 508 "mon_parse.y"
+                    { resources_load((yyvsp[-1].str)); }
+#line 3193 "mon_parse.c"
     break;
 
-  case 131:
-#line 510 "mon_parse.y" /* yacc.c:1646  */
-    { resources_save((yyvsp[-1].str)); }
-#line 3079 "mon_parse.c" /* yacc.c:1646  */
+  case 131: /* monitor_misc_rules: CMD_SAVE_RESOURCES filename end_cmd  */
+#line 510 "mon_parse.y"
+                    { resources_save((yyvsp[-1].str)); }
+#line 3199 "mon_parse.c"
     break;
 
-  case 132:
-#line 512 "mon_parse.y" /* yacc.c:1646  */
-    { mon_reset_machine(-1); }
-#line 3085 "mon_parse.c" /* yacc.c:1646  */
+  case 132: /* monitor_misc_rules: CMD_MON_RESET end_cmd  */
+#line 512 "mon_parse.y"
+                    { mon_reset_machine(-1); }
+#line 3205 "mon_parse.c"
     break;
 
-  case 133:
-#line 514 "mon_parse.y" /* yacc.c:1646  */
-    { mon_reset_machine((yyvsp[-1].i)); }
-#line 3091 "mon_parse.c" /* yacc.c:1646  */
+  case 133: /* monitor_misc_rules: CMD_MON_RESET opt_sep expression end_cmd  */
+#line 514 "mon_parse.y"
+                    { mon_reset_machine((yyvsp[-1].i)); }
+#line 3211 "mon_parse.c"
     break;
 
-  case 134:
-#line 516 "mon_parse.y" /* yacc.c:1646  */
-    { mon_tape_ctrl((yyvsp[-1].i)); }
-#line 3097 "mon_parse.c" /* yacc.c:1646  */
+  case 134: /* monitor_misc_rules: CMD_TAPECTRL opt_sep expression end_cmd  */
+#line 516 "mon_parse.y"
+                    { mon_tape_ctrl((yyvsp[-1].i)); }
+#line 3217 "mon_parse.c"
     break;
 
-  case 135:
-#line 518 "mon_parse.y" /* yacc.c:1646  */
-    { mon_cart_freeze(); }
-#line 3103 "mon_parse.c" /* yacc.c:1646  */
+  case 135: /* monitor_misc_rules: CMD_CARTFREEZE end_cmd  */
+#line 518 "mon_parse.y"
+                    { mon_cart_freeze(); }
+#line 3223 "mon_parse.c"
     break;
 
-  case 136:
-#line 520 "mon_parse.y" /* yacc.c:1646  */
-    { }
-#line 3109 "mon_parse.c" /* yacc.c:1646  */
+  case 136: /* monitor_misc_rules: CMD_COMMENT opt_rest_of_line end_cmd  */
+#line 520 "mon_parse.y"
+                     { }
+#line 3229 "mon_parse.c"
     break;
 
-  case 137:
-#line 522 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stopwatch_reset(); }
-#line 3115 "mon_parse.c" /* yacc.c:1646  */
+  case 137: /* monitor_misc_rules: CMD_STOPWATCH RESET end_cmd  */
+#line 522 "mon_parse.y"
+                     { mon_stopwatch_reset(); }
+#line 3235 "mon_parse.c"
     break;
 
-  case 138:
-#line 524 "mon_parse.y" /* yacc.c:1646  */
-    { mon_stopwatch_show("Stopwatch: ", "\n"); }
-#line 3121 "mon_parse.c" /* yacc.c:1646  */
+  case 138: /* monitor_misc_rules: CMD_STOPWATCH end_cmd  */
+#line 524 "mon_parse.y"
+                     { mon_stopwatch_show("Stopwatch: ", "\n"); }
+#line 3241 "mon_parse.c"
     break;
 
-  case 139:
-#line 528 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), FALSE); }
-#line 3127 "mon_parse.c" /* yacc.c:1646  */
+  case 139: /* monitor_misc_rules: CMD_HOSTTIMERS RESET end_cmd  */
+#line 526 "mon_parse.y"
+                     { mon_hosttimer_reset(); }
+#line 3247 "mon_parse.c"
     break;
 
-  case 140:
-#line 530 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), TRUE); }
-#line 3133 "mon_parse.c" /* yacc.c:1646  */
+  case 140: /* monitor_misc_rules: CMD_HOSTTIMERS end_cmd  */
+#line 528 "mon_parse.y"
+                     { mon_hosttimer_show(); }
+#line 3253 "mon_parse.c"
     break;
 
-  case 141:
-#line 532 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], FALSE); }
-#line 3139 "mon_parse.c" /* yacc.c:1646  */
+  case 141: /* disk_rules: CMD_LOAD filename device_num opt_address end_cmd  */
+#line 532 "mon_parse.y"
+            { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), FALSE); }
+#line 3259 "mon_parse.c"
     break;
 
-  case 142:
-#line 534 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_DEVICE_NUM; }
-#line 3145 "mon_parse.c" /* yacc.c:1646  */
+  case 142: /* disk_rules: CMD_BLOAD filename device_num opt_address end_cmd  */
+#line 534 "mon_parse.y"
+            { mon_file_load((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].a), TRUE); }
+#line 3265 "mon_parse.c"
     break;
 
-  case 143:
-#line 536 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3151 "mon_parse.c" /* yacc.c:1646  */
+  case 143: /* disk_rules: CMD_SAVE filename device_num address_range end_cmd  */
+#line 536 "mon_parse.y"
+            { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], FALSE); }
+#line 3271 "mon_parse.c"
     break;
 
-  case 144:
-#line 538 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE); }
-#line 3157 "mon_parse.c" /* yacc.c:1646  */
+  case 144: /* disk_rules: CMD_SAVE filename error  */
+#line 538 "mon_parse.y"
+            { return ERR_EXPECT_DEVICE_NUM; }
+#line 3277 "mon_parse.c"
     break;
 
-  case 145:
-#line 540 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3163 "mon_parse.c" /* yacc.c:1646  */
+  case 145: /* disk_rules: CMD_SAVE filename device_num error  */
+#line 540 "mon_parse.y"
+            { return ERR_EXPECT_ADDRESS; }
+#line 3283 "mon_parse.c"
     break;
 
-  case 146:
-#line 542 "mon_parse.y" /* yacc.c:1646  */
-    { mon_file_verify((yyvsp[-3].str),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3169 "mon_parse.c" /* yacc.c:1646  */
+  case 146: /* disk_rules: CMD_BSAVE filename device_num address_range end_cmd  */
+#line 542 "mon_parse.y"
+            { mon_file_save((yyvsp[-3].str), (yyvsp[-2].i), (yyvsp[-1].range)[0], (yyvsp[-1].range)[1], TRUE); }
+#line 3289 "mon_parse.c"
     break;
 
-  case 147:
-#line 544 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_ADDRESS; }
-#line 3175 "mon_parse.c" /* yacc.c:1646  */
+  case 147: /* disk_rules: CMD_BSAVE filename device_num error  */
+#line 544 "mon_parse.y"
+            { return ERR_EXPECT_ADDRESS; }
+#line 3295 "mon_parse.c"
     break;
 
-  case 148:
-#line 546 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_block_cmd(0,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3181 "mon_parse.c" /* yacc.c:1646  */
+  case 148: /* disk_rules: CMD_VERIFY filename device_num address end_cmd  */
+#line 546 "mon_parse.y"
+            { mon_file_verify((yyvsp[-3].str),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 3301 "mon_parse.c"
     break;
 
-  case 149:
-#line 548 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_block_cmd(1,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
-#line 3187 "mon_parse.c" /* yacc.c:1646  */
+  case 149: /* disk_rules: CMD_VERIFY filename device_num error  */
+#line 548 "mon_parse.y"
+            { return ERR_EXPECT_ADDRESS; }
+#line 3307 "mon_parse.c"
     break;
 
-  case 150:
-#line 550 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_list(-1); }
-#line 3193 "mon_parse.c" /* yacc.c:1646  */
+  case 150: /* disk_rules: CMD_BLOCK_READ expression expression opt_address end_cmd  */
+#line 550 "mon_parse.y"
+            { mon_drive_block_cmd(0,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 3313 "mon_parse.c"
     break;
 
-  case 151:
-#line 552 "mon_parse.y" /* yacc.c:1646  */
-    { mon_drive_list((yyvsp[-1].i)); }
-#line 3199 "mon_parse.c" /* yacc.c:1646  */
+  case 151: /* disk_rules: CMD_BLOCK_WRITE expression expression address end_cmd  */
+#line 552 "mon_parse.y"
+            { mon_drive_block_cmd(1,(yyvsp[-3].i),(yyvsp[-2].i),(yyvsp[-1].a)); }
+#line 3319 "mon_parse.c"
     break;
 
-  case 152:
-#line 554 "mon_parse.y" /* yacc.c:1646  */
-    { mon_attach((yyvsp[-2].str),(yyvsp[-1].i)); }
-#line 3205 "mon_parse.c" /* yacc.c:1646  */
+  case 152: /* disk_rules: CMD_LIST end_cmd  */
+#line 554 "mon_parse.y"
+            { mon_drive_list(-1); }
+#line 3325 "mon_parse.c"
     break;
 
-  case 153:
-#line 556 "mon_parse.y" /* yacc.c:1646  */
-    { mon_detach((yyvsp[-1].i)); }
-#line 3211 "mon_parse.c" /* yacc.c:1646  */
+  case 153: /* disk_rules: CMD_LIST device_num end_cmd  */
+#line 556 "mon_parse.y"
+            { mon_drive_list((yyvsp[-1].i)); }
+#line 3331 "mon_parse.c"
     break;
 
-  case 154:
-#line 558 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-1].str),0,1); }
-#line 3217 "mon_parse.c" /* yacc.c:1646  */
+  case 154: /* disk_rules: CMD_ATTACH filename expression end_cmd  */
+#line 558 "mon_parse.y"
+            { mon_attach((yyvsp[-2].str),(yyvsp[-1].i)); }
+#line 3337 "mon_parse.c"
     break;
 
-  case 155:
-#line 560 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),1); }
-#line 3223 "mon_parse.c" /* yacc.c:1646  */
+  case 155: /* disk_rules: CMD_DETACH expression end_cmd  */
+#line 560 "mon_parse.y"
+            { mon_detach((yyvsp[-1].i)); }
+#line 3343 "mon_parse.c"
     break;
 
-  case 156:
-#line 562 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-1].str),0,0); }
-#line 3229 "mon_parse.c" /* yacc.c:1646  */
+  case 156: /* disk_rules: CMD_AUTOSTART filename end_cmd  */
+#line 562 "mon_parse.y"
+            { mon_autostart((yyvsp[-1].str),0,1); }
+#line 3349 "mon_parse.c"
     break;
 
-  case 157:
-#line 564 "mon_parse.y" /* yacc.c:1646  */
-    { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),0); }
-#line 3235 "mon_parse.c" /* yacc.c:1646  */
+  case 157: /* disk_rules: CMD_AUTOSTART filename opt_sep number end_cmd  */
+#line 564 "mon_parse.y"
+            { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),1); }
+#line 3355 "mon_parse.c"
     break;
 
-  case 158:
-#line 568 "mon_parse.y" /* yacc.c:1646  */
-    { mon_record_commands((yyvsp[-1].str)); }
-#line 3241 "mon_parse.c" /* yacc.c:1646  */
+  case 158: /* disk_rules: CMD_AUTOLOAD filename end_cmd  */
+#line 566 "mon_parse.y"
+            { mon_autostart((yyvsp[-1].str),0,0); }
+#line 3361 "mon_parse.c"
     break;
 
-  case 159:
-#line 570 "mon_parse.y" /* yacc.c:1646  */
-    { mon_end_recording(); }
-#line 3247 "mon_parse.c" /* yacc.c:1646  */
+  case 159: /* disk_rules: CMD_AUTOLOAD filename opt_sep number end_cmd  */
+#line 568 "mon_parse.y"
+            { mon_autostart((yyvsp[-3].str),(yyvsp[-1].i),0); }
+#line 3367 "mon_parse.c"
     break;
 
-  case 160:
-#line 572 "mon_parse.y" /* yacc.c:1646  */
-    { mon_playback_init((yyvsp[-1].str)); }
-#line 3253 "mon_parse.c" /* yacc.c:1646  */
+  case 160: /* cmd_file_rules: CMD_RECORD filename end_cmd  */
+#line 572 "mon_parse.y"
+                { mon_record_commands((yyvsp[-1].str)); }
+#line 3373 "mon_parse.c"
     break;
 
-  case 161:
-#line 576 "mon_parse.y" /* yacc.c:1646  */
-    { mon_memory_fill((yyvsp[-2].a), BAD_ADDR, (unsigned char *)(yyvsp[-1].str)); }
-#line 3259 "mon_parse.c" /* yacc.c:1646  */
+  case 161: /* cmd_file_rules: CMD_MON_STOP end_cmd  */
+#line 574 "mon_parse.y"
+                { mon_end_recording(); }
+#line 3379 "mon_parse.c"
     break;
 
-  case 162:
-#line 578 "mon_parse.y" /* yacc.c:1646  */
-    { printf("Not yet.\n"); }
-#line 3265 "mon_parse.c" /* yacc.c:1646  */
+  case 162: /* cmd_file_rules: CMD_PLAYBACK filename end_cmd  */
+#line 576 "mon_parse.y"
+                { mon_playback_init((yyvsp[-1].str)); }
+#line 3385 "mon_parse.c"
     break;
 
-  case 163:
-#line 582 "mon_parse.y" /* yacc.c:1646  */
-    { yydebug = 1; }
-#line 3271 "mon_parse.c" /* yacc.c:1646  */
+  case 163: /* data_entry_rules: CMD_ENTER_DATA address data_list end_cmd  */
+#line 580 "mon_parse.y"
+                  { mon_memory_fill((yyvsp[-2].a), BAD_ADDR, (unsigned char *)(yyvsp[-1].str)); }
+#line 3391 "mon_parse.c"
     break;
 
-  case 164:
-#line 585 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 3277 "mon_parse.c" /* yacc.c:1646  */
+  case 164: /* data_entry_rules: CMD_ENTER_BIN_DATA end_cmd  */
+#line 582 "mon_parse.y"
+                  { printf("Not yet.\n"); }
+#line 3397 "mon_parse.c"
     break;
 
-  case 165:
-#line 588 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = (yyvsp[0].str); }
-#line 3283 "mon_parse.c" /* yacc.c:1646  */
+  case 165: /* monitor_debug_rules: CMD_YYDEBUG end_cmd  */
+#line 586 "mon_parse.y"
+                     { yydebug = 1; }
+#line 3403 "mon_parse.c"
     break;
 
-  case 166:
-#line 589 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.str) = NULL; }
-#line 3289 "mon_parse.c" /* yacc.c:1646  */
+  case 166: /* rest_of_line: R_O_L  */
+#line 589 "mon_parse.y"
+                    { (yyval.str) = (yyvsp[0].str); }
+#line 3409 "mon_parse.c"
     break;
 
-  case 168:
-#line 593 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_FILENAME; }
-#line 3295 "mon_parse.c" /* yacc.c:1646  */
+  case 167: /* opt_rest_of_line: R_O_L  */
+#line 592 "mon_parse.y"
+                        { (yyval.str) = (yyvsp[0].str); }
+#line 3415 "mon_parse.c"
     break;
 
-  case 170:
-#line 597 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_DEVICE_NUM; }
-#line 3301 "mon_parse.c" /* yacc.c:1646  */
+  case 168: /* opt_rest_of_line: %empty  */
+#line 593 "mon_parse.y"
+                    { (yyval.str) = NULL; }
+#line 3421 "mon_parse.c"
     break;
 
-  case 171:
-#line 600 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-1].i) | (yyvsp[0].i); }
-#line 3307 "mon_parse.c" /* yacc.c:1646  */
+  case 170: /* filename: error  */
+#line 597 "mon_parse.y"
+                { return ERR_EXPECT_FILENAME; }
+#line 3427 "mon_parse.c"
     break;
 
-  case 172:
-#line 601 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3313 "mon_parse.c" /* yacc.c:1646  */
+  case 172: /* device_num: error  */
+#line 601 "mon_parse.y"
+              { return ERR_EXPECT_DEVICE_NUM; }
+#line 3433 "mon_parse.c"
     break;
 
-  case 173:
-#line 604 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3319 "mon_parse.c" /* yacc.c:1646  */
+  case 173: /* mem_op: mem_op MEM_OP  */
+#line 604 "mon_parse.y"
+                      { (yyval.i) = (yyvsp[-1].i) | (yyvsp[0].i); }
+#line 3439 "mon_parse.c"
     break;
 
-  case 174:
-#line 605 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0; }
-#line 3325 "mon_parse.c" /* yacc.c:1646  */
+  case 174: /* mem_op: MEM_OP  */
+#line 605 "mon_parse.y"
+               { (yyval.i) = (yyvsp[0].i); }
+#line 3445 "mon_parse.c"
     break;
 
-  case 175:
-#line 608 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 175: /* opt_mem_op: mem_op  */
+#line 608 "mon_parse.y"
+                   { (yyval.i) = (yyvsp[0].i); }
+#line 3451 "mon_parse.c"
+    break;
+
+  case 176: /* opt_mem_op: %empty  */
+#line 609 "mon_parse.y"
+            { (yyval.i) = 0; }
+#line 3457 "mon_parse.c"
+    break;
+
+  case 177: /* register: MON_REGISTER  */
+#line 612 "mon_parse.y"
+                                {
                                     if (!mon_register_valid(default_memspace, (yyvsp[0].reg))) {
                                         return ERR_INVALID_REGISTER;
                                     }
                                     (yyval.i) = new_reg(default_memspace, (yyvsp[0].reg));
                                 }
-#line 3336 "mon_parse.c" /* yacc.c:1646  */
+#line 3468 "mon_parse.c"
     break;
 
-  case 176:
-#line 614 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 178: /* register: memspace MON_REGISTER  */
+#line 618 "mon_parse.y"
+                                {
                                     if (!mon_register_valid((yyvsp[-1].i), (yyvsp[0].reg))) {
                                         return ERR_INVALID_REGISTER;
                                     }
                                     (yyval.i) = new_reg((yyvsp[-1].i), (yyvsp[0].reg));
                                 }
-#line 3347 "mon_parse.c" /* yacc.c:1646  */
+#line 3479 "mon_parse.c"
     break;
 
-  case 179:
-#line 627 "mon_parse.y" /* yacc.c:1646  */
-    { (monitor_cpu_for_memspace[reg_memspace((yyvsp[-2].i))]->mon_register_set_val)(reg_memspace((yyvsp[-2].i)), reg_regid((yyvsp[-2].i)), (WORD) (yyvsp[0].i)); }
-#line 3353 "mon_parse.c" /* yacc.c:1646  */
+  case 181: /* reg_asgn: register EQUALS number  */
+#line 631 "mon_parse.y"
+          { (monitor_cpu_for_memspace[reg_memspace((yyvsp[-2].i))]->mon_register_set_val)(reg_memspace((yyvsp[-2].i)), reg_regid((yyvsp[-2].i)), (WORD) (yyvsp[0].i)); }
+#line 3485 "mon_parse.c"
     break;
 
-  case 180:
-#line 630 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3359 "mon_parse.c" /* yacc.c:1646  */
+  case 182: /* checkpt_num: d_number  */
+#line 634 "mon_parse.y"
+                      { (yyval.i) = (yyvsp[0].i); }
+#line 3491 "mon_parse.c"
     break;
 
-  case 181:
-#line 631 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_EXPECT_CHECKNUM; }
-#line 3365 "mon_parse.c" /* yacc.c:1646  */
+  case 183: /* checkpt_num: error  */
+#line 635 "mon_parse.y"
+                   { return ERR_EXPECT_CHECKNUM; }
+#line 3497 "mon_parse.c"
     break;
 
-  case 183:
-#line 635 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.range)[0] = (yyvsp[0].a); (yyval.range)[1] = BAD_ADDR; }
-#line 3371 "mon_parse.c" /* yacc.c:1646  */
+  case 185: /* address_opt_range: address  */
+#line 639 "mon_parse.y"
+                           { (yyval.range)[0] = (yyvsp[0].a); (yyval.range)[1] = BAD_ADDR; }
+#line 3503 "mon_parse.c"
     break;
 
-  case 184:
-#line 638 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.range)[0] = (yyvsp[-2].a); (yyval.range)[1] = (yyvsp[0].a); }
-#line 3377 "mon_parse.c" /* yacc.c:1646  */
+  case 186: /* address_range: address opt_sep address  */
+#line 642 "mon_parse.y"
+                                       { (yyval.range)[0] = (yyvsp[-2].a); (yyval.range)[1] = (yyvsp[0].a); }
+#line 3509 "mon_parse.c"
     break;
 
-  case 185:
-#line 640 "mon_parse.y" /* yacc.c:1646  */
-    { if (resolve_range(e_default_space, (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
-#line 3383 "mon_parse.c" /* yacc.c:1646  */
+  case 187: /* address_range: H_RANGE_GUESS  */
+#line 644 "mon_parse.y"
+               { if (resolve_range(e_default_space, (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
+#line 3515 "mon_parse.c"
     break;
 
-  case 186:
-#line 642 "mon_parse.y" /* yacc.c:1646  */
-    { if (resolve_range((yyvsp[-2].i), (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
-#line 3389 "mon_parse.c" /* yacc.c:1646  */
+  case 188: /* address_range: memspace opt_sep H_RANGE_GUESS  */
+#line 646 "mon_parse.y"
+               { if (resolve_range((yyvsp[-2].i), (yyval.range), (yyvsp[0].str))) return ERR_ADDR_TOO_BIG; }
+#line 3521 "mon_parse.c"
     break;
 
-  case 187:
-#line 645 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.a) = (yyvsp[0].a); }
-#line 3395 "mon_parse.c" /* yacc.c:1646  */
+  case 189: /* opt_address: opt_sep address  */
+#line 649 "mon_parse.y"
+                             { (yyval.a) = (yyvsp[0].a); }
+#line 3527 "mon_parse.c"
     break;
 
-  case 188:
-#line 646 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.a) = BAD_ADDR; }
-#line 3401 "mon_parse.c" /* yacc.c:1646  */
+  case 190: /* opt_address: %empty  */
+#line 650 "mon_parse.y"
+             { (yyval.a) = BAD_ADDR; }
+#line 3533 "mon_parse.c"
     break;
 
-  case 189:
-#line 650 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 191: /* address: memloc  */
+#line 654 "mon_parse.y"
+         {
              (yyval.a) = new_addr(e_default_space,(yyvsp[0].i));
              if (opt_asm) new_cmd = asm_mode = 1;
          }
-#line 3410 "mon_parse.c" /* yacc.c:1646  */
+#line 3542 "mon_parse.c"
     break;
 
-  case 190:
-#line 655 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 192: /* address: memspace opt_sep memloc  */
+#line 659 "mon_parse.y"
+         {
              (yyval.a) = new_addr((yyvsp[-2].i), (yyvsp[0].i));
              if (opt_asm) new_cmd = asm_mode = 1;
          }
-#line 3419 "mon_parse.c" /* yacc.c:1646  */
+#line 3551 "mon_parse.c"
     break;
 
-  case 191:
-#line 660 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 193: /* address: LABEL  */
+#line 664 "mon_parse.y"
+         {
              temp = mon_symbol_table_lookup_addr(e_default_space, (yyvsp[0].str));
              if (temp >= 0)
                  (yyval.a) = new_addr(e_default_space, temp);
              else
                  return ERR_UNDEFINED_LABEL;
          }
-#line 3431 "mon_parse.c" /* yacc.c:1646  */
+#line 3563 "mon_parse.c"
     break;
 
-  case 194:
-#line 673 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_comp_space; }
-#line 3437 "mon_parse.c" /* yacc.c:1646  */
+  case 196: /* memspace: MEM_COMP  */
+#line 677 "mon_parse.y"
+                   { (yyval.i) = e_comp_space; }
+#line 3569 "mon_parse.c"
     break;
 
-  case 195:
-#line 674 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk8_space; }
-#line 3443 "mon_parse.c" /* yacc.c:1646  */
+  case 197: /* memspace: MEM_DISK8  */
+#line 678 "mon_parse.y"
+                    { (yyval.i) = e_disk8_space; }
+#line 3575 "mon_parse.c"
     break;
 
-  case 196:
-#line 675 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk9_space; }
-#line 3449 "mon_parse.c" /* yacc.c:1646  */
+  case 198: /* memspace: MEM_DISK9  */
+#line 679 "mon_parse.y"
+                    { (yyval.i) = e_disk9_space; }
+#line 3581 "mon_parse.c"
     break;
 
-  case 197:
-#line 676 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk10_space; }
-#line 3455 "mon_parse.c" /* yacc.c:1646  */
+  case 199: /* memspace: MEM_DISK10  */
+#line 680 "mon_parse.y"
+                     { (yyval.i) = e_disk10_space; }
+#line 3587 "mon_parse.c"
     break;
 
-  case 198:
-#line 677 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = e_disk11_space; }
-#line 3461 "mon_parse.c" /* yacc.c:1646  */
+  case 200: /* memspace: MEM_DISK11  */
+#line 681 "mon_parse.y"
+                     { (yyval.i) = e_disk11_space; }
+#line 3593 "mon_parse.c"
     break;
 
-  case 199:
-#line 680 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); if (!CHECK_ADDR((yyvsp[0].i))) return ERR_ADDR_TOO_BIG; }
-#line 3467 "mon_parse.c" /* yacc.c:1646  */
+  case 201: /* memloc: memaddr  */
+#line 684 "mon_parse.y"
+                { (yyval.i) = (yyvsp[0].i); if (!CHECK_ADDR((yyvsp[0].i))) return ERR_ADDR_TOO_BIG; }
+#line 3599 "mon_parse.c"
     break;
 
-  case 200:
-#line 682 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3473 "mon_parse.c" /* yacc.c:1646  */
+  case 202: /* memaddr: number  */
+#line 686 "mon_parse.y"
+                { (yyval.i) = (yyvsp[0].i); }
+#line 3605 "mon_parse.c"
     break;
 
-  case 201:
-#line 684 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-2].i) + (yyvsp[0].i); }
-#line 3479 "mon_parse.c" /* yacc.c:1646  */
+  case 203: /* expression: expression '+' expression  */
+#line 688 "mon_parse.y"
+                                      { (yyval.i) = (yyvsp[-2].i) + (yyvsp[0].i); }
+#line 3611 "mon_parse.c"
     break;
 
-  case 202:
-#line 685 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-2].i) - (yyvsp[0].i); }
-#line 3485 "mon_parse.c" /* yacc.c:1646  */
+  case 204: /* expression: expression '-' expression  */
+#line 689 "mon_parse.y"
+                                      { (yyval.i) = (yyvsp[-2].i) - (yyvsp[0].i); }
+#line 3617 "mon_parse.c"
     break;
 
-  case 203:
-#line 686 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-2].i) * (yyvsp[0].i); }
-#line 3491 "mon_parse.c" /* yacc.c:1646  */
+  case 205: /* expression: expression '*' expression  */
+#line 690 "mon_parse.y"
+                                      { (yyval.i) = (yyvsp[-2].i) * (yyvsp[0].i); }
+#line 3623 "mon_parse.c"
     break;
 
-  case 204:
-#line 687 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = ((yyvsp[0].i)) ? ((yyvsp[-2].i) / (yyvsp[0].i)) : 1; }
-#line 3497 "mon_parse.c" /* yacc.c:1646  */
+  case 206: /* expression: expression '/' expression  */
+#line 691 "mon_parse.y"
+                                      { (yyval.i) = ((yyvsp[0].i)) ? ((yyvsp[-2].i) / (yyvsp[0].i)) : 1; }
+#line 3629 "mon_parse.c"
     break;
 
-  case 205:
-#line 688 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[-1].i); }
-#line 3503 "mon_parse.c" /* yacc.c:1646  */
+  case 207: /* expression: '(' expression ')'  */
+#line 692 "mon_parse.y"
+                               { (yyval.i) = (yyvsp[-1].i); }
+#line 3635 "mon_parse.c"
     break;
 
-  case 206:
-#line 689 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_MISSING_CLOSE_PAREN; }
-#line 3509 "mon_parse.c" /* yacc.c:1646  */
+  case 208: /* expression: '(' expression error  */
+#line 693 "mon_parse.y"
+                                 { return ERR_MISSING_CLOSE_PAREN; }
+#line 3641 "mon_parse.c"
     break;
 
-  case 207:
-#line 690 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3515 "mon_parse.c" /* yacc.c:1646  */
+  case 209: /* expression: value  */
+#line 694 "mon_parse.y"
+                  { (yyval.i) = (yyvsp[0].i); }
+#line 3647 "mon_parse.c"
     break;
 
-  case 208:
-#line 693 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = (yyvsp[0].cond_node); }
-#line 3521 "mon_parse.c" /* yacc.c:1646  */
+  case 210: /* opt_if_cond_expr: IF cond_expr  */
+#line 697 "mon_parse.y"
+                               { (yyval.cond_node) = (yyvsp[0].cond_node); }
+#line 3653 "mon_parse.c"
     break;
 
-  case 209:
-#line 694 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = 0; }
-#line 3527 "mon_parse.c" /* yacc.c:1646  */
+  case 211: /* opt_if_cond_expr: %empty  */
+#line 698 "mon_parse.y"
+                  { (yyval.cond_node) = 0; }
+#line 3659 "mon_parse.c"
     break;
 
-  case 210:
-#line 697 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 212: /* cond_expr: cond_expr COMPARE_OP cond_expr  */
+#line 701 "mon_parse.y"
+           {
                (yyval.cond_node) = new_cond; (yyval.cond_node)->is_parenthized = FALSE;
                (yyval.cond_node)->child1 = (yyvsp[-2].cond_node); (yyval.cond_node)->child2 = (yyvsp[0].cond_node); (yyval.cond_node)->operation = (yyvsp[-1].cond_op);
            }
-#line 3536 "mon_parse.c" /* yacc.c:1646  */
+#line 3668 "mon_parse.c"
     break;
 
-  case 211:
-#line 702 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_INCOMPLETE_COMPARE_OP; }
-#line 3542 "mon_parse.c" /* yacc.c:1646  */
+  case 213: /* cond_expr: cond_expr COMPARE_OP error  */
+#line 706 "mon_parse.y"
+           { return ERR_INCOMPLETE_COMPARE_OP; }
+#line 3674 "mon_parse.c"
     break;
 
-  case 212:
-#line 704 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = (yyvsp[-1].cond_node); (yyval.cond_node)->is_parenthized = TRUE; }
-#line 3548 "mon_parse.c" /* yacc.c:1646  */
+  case 214: /* cond_expr: L_PAREN cond_expr R_PAREN  */
+#line 708 "mon_parse.y"
+           { (yyval.cond_node) = (yyvsp[-1].cond_node); (yyval.cond_node)->is_parenthized = TRUE; }
+#line 3680 "mon_parse.c"
     break;
 
-  case 213:
-#line 706 "mon_parse.y" /* yacc.c:1646  */
-    { return ERR_MISSING_CLOSE_PAREN; }
-#line 3554 "mon_parse.c" /* yacc.c:1646  */
+  case 215: /* cond_expr: L_PAREN cond_expr error  */
+#line 710 "mon_parse.y"
+           { return ERR_MISSING_CLOSE_PAREN; }
+#line 3686 "mon_parse.c"
     break;
 
-  case 214:
-#line 708 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = (yyvsp[0].cond_node); }
-#line 3560 "mon_parse.c" /* yacc.c:1646  */
+  case 216: /* cond_expr: compare_operand  */
+#line 712 "mon_parse.y"
+           { (yyval.cond_node) = (yyvsp[0].cond_node); }
+#line 3692 "mon_parse.c"
     break;
 
-  case 215:
-#line 711 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = new_cond;
+  case 217: /* compare_operand: register  */
+#line 715 "mon_parse.y"
+                          { (yyval.cond_node) = new_cond;
                             (yyval.cond_node)->operation = e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->reg_num = (yyvsp[0].i); (yyval.cond_node)->is_reg = TRUE;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;
                           }
-#line 3571 "mon_parse.c" /* yacc.c:1646  */
+#line 3703 "mon_parse.c"
     break;
 
-  case 216:
-#line 717 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.cond_node) = new_cond;
+  case 218: /* compare_operand: number  */
+#line 721 "mon_parse.y"
+                          { (yyval.cond_node) = new_cond;
                             (yyval.cond_node)->operation = e_INV;
                             (yyval.cond_node)->is_parenthized = FALSE;
                             (yyval.cond_node)->value = (yyvsp[0].i); (yyval.cond_node)->is_reg = FALSE;
                             (yyval.cond_node)->child1 = NULL; (yyval.cond_node)->child2 = NULL;
                           }
-#line 3582 "mon_parse.c" /* yacc.c:1646  */
+#line 3714 "mon_parse.c"
     break;
 
-  case 219:
-#line 729 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_number_to_buffer((yyvsp[0].i)); }
-#line 3588 "mon_parse.c" /* yacc.c:1646  */
+  case 221: /* data_element: number  */
+#line 733 "mon_parse.y"
+                     { mon_add_number_to_buffer((yyvsp[0].i)); }
+#line 3720 "mon_parse.c"
     break;
 
-  case 220:
-#line 730 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_string_to_buffer((yyvsp[0].str)); }
-#line 3594 "mon_parse.c" /* yacc.c:1646  */
+  case 222: /* data_element: STRING  */
+#line 734 "mon_parse.y"
+                     { mon_add_string_to_buffer((yyvsp[0].str)); }
+#line 3726 "mon_parse.c"
     break;
 
-  case 223:
-#line 737 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_number_to_buffer((yyvsp[0].i)); }
-#line 3600 "mon_parse.c" /* yacc.c:1646  */
+  case 225: /* hunt_element: number  */
+#line 741 "mon_parse.y"
+                     { mon_add_number_to_buffer((yyvsp[0].i)); }
+#line 3732 "mon_parse.c"
     break;
 
-  case 224:
-#line 738 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_number_masked_to_buffer((yyvsp[0].i), 0x00); }
-#line 3606 "mon_parse.c" /* yacc.c:1646  */
+  case 226: /* hunt_element: MASK  */
+#line 742 "mon_parse.y"
+                     { mon_add_number_masked_to_buffer((yyvsp[0].i), 0x00); }
+#line 3738 "mon_parse.c"
     break;
 
-  case 225:
-#line 739 "mon_parse.y" /* yacc.c:1646  */
-    { mon_add_string_to_buffer((yyvsp[0].str)); }
-#line 3612 "mon_parse.c" /* yacc.c:1646  */
+  case 227: /* hunt_element: STRING  */
+#line 743 "mon_parse.y"
+                     { mon_add_string_to_buffer((yyvsp[0].str)); }
+#line 3744 "mon_parse.c"
     break;
 
-  case 226:
-#line 742 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3618 "mon_parse.c" /* yacc.c:1646  */
+  case 228: /* value: number  */
+#line 746 "mon_parse.y"
+              { (yyval.i) = (yyvsp[0].i); }
+#line 3750 "mon_parse.c"
     break;
 
-  case 227:
-#line 743 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (monitor_cpu_for_memspace[reg_memspace((yyvsp[0].i))]->mon_register_get_val)(reg_memspace((yyvsp[0].i)), reg_regid((yyvsp[0].i))); }
-#line 3624 "mon_parse.c" /* yacc.c:1646  */
+  case 229: /* value: register  */
+#line 747 "mon_parse.y"
+                { (yyval.i) = (monitor_cpu_for_memspace[reg_memspace((yyvsp[0].i))]->mon_register_get_val)(reg_memspace((yyvsp[0].i)), reg_regid((yyvsp[0].i))); }
+#line 3756 "mon_parse.c"
     break;
 
-  case 228:
-#line 746 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3630 "mon_parse.c" /* yacc.c:1646  */
+  case 230: /* d_number: D_NUMBER  */
+#line 750 "mon_parse.y"
+                   { (yyval.i) = (yyvsp[0].i); }
+#line 3762 "mon_parse.c"
     break;
 
-  case 229:
-#line 747 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3636 "mon_parse.c" /* yacc.c:1646  */
+  case 231: /* d_number: B_NUMBER_GUESS  */
+#line 751 "mon_parse.y"
+                         { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
+#line 3768 "mon_parse.c"
     break;
 
-  case 230:
-#line 748 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3642 "mon_parse.c" /* yacc.c:1646  */
+  case 232: /* d_number: O_NUMBER_GUESS  */
+#line 752 "mon_parse.y"
+                         { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
+#line 3774 "mon_parse.c"
     break;
 
-  case 231:
-#line 749 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
-#line 3648 "mon_parse.c" /* yacc.c:1646  */
+  case 233: /* d_number: D_NUMBER_GUESS  */
+#line 753 "mon_parse.y"
+                         { (yyval.i) = strtol((yyvsp[0].str), NULL, 10); }
+#line 3780 "mon_parse.c"
     break;
 
-  case 232:
-#line 752 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = resolve_datatype(B_NUMBER,(yyvsp[0].str)); }
-#line 3654 "mon_parse.c" /* yacc.c:1646  */
+  case 234: /* guess_default: B_NUMBER_GUESS  */
+#line 756 "mon_parse.y"
+                              { (yyval.i) = resolve_datatype(B_NUMBER,(yyvsp[0].str)); }
+#line 3786 "mon_parse.c"
     break;
 
-  case 233:
-#line 753 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = resolve_datatype(O_NUMBER,(yyvsp[0].str)); }
-#line 3660 "mon_parse.c" /* yacc.c:1646  */
+  case 235: /* guess_default: O_NUMBER_GUESS  */
+#line 757 "mon_parse.y"
+                              { (yyval.i) = resolve_datatype(O_NUMBER,(yyvsp[0].str)); }
+#line 3792 "mon_parse.c"
     break;
 
-  case 234:
-#line 754 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = resolve_datatype(D_NUMBER,(yyvsp[0].str)); }
-#line 3666 "mon_parse.c" /* yacc.c:1646  */
+  case 236: /* guess_default: D_NUMBER_GUESS  */
+#line 758 "mon_parse.y"
+                              { (yyval.i) = resolve_datatype(D_NUMBER,(yyvsp[0].str)); }
+#line 3798 "mon_parse.c"
     break;
 
-  case 235:
-#line 757 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3672 "mon_parse.c" /* yacc.c:1646  */
+  case 237: /* number: H_NUMBER  */
+#line 761 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3804 "mon_parse.c"
     break;
 
-  case 236:
-#line 758 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3678 "mon_parse.c" /* yacc.c:1646  */
+  case 238: /* number: D_NUMBER  */
+#line 762 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3810 "mon_parse.c"
     break;
 
-  case 237:
-#line 759 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3684 "mon_parse.c" /* yacc.c:1646  */
+  case 239: /* number: O_NUMBER  */
+#line 763 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3816 "mon_parse.c"
     break;
 
-  case 238:
-#line 760 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3690 "mon_parse.c" /* yacc.c:1646  */
+  case 240: /* number: B_NUMBER  */
+#line 764 "mon_parse.y"
+                 { (yyval.i) = (yyvsp[0].i); }
+#line 3822 "mon_parse.c"
     break;
 
-  case 239:
-#line 761 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 3696 "mon_parse.c" /* yacc.c:1646  */
+  case 241: /* number: guess_default  */
+#line 765 "mon_parse.y"
+                      { (yyval.i) = (yyvsp[0].i); }
+#line 3828 "mon_parse.c"
     break;
 
-  case 243:
-#line 769 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = 0;
+  case 245: /* assembly_instruction: OPCODE asm_operand_mode  */
+#line 773 "mon_parse.y"
+                                              { (yyval.i) = 0;
                                                 if ((yyvsp[-1].str)) {
                                                     (monitor_cpu_for_memspace[default_memspace]->mon_assemble_instr)((yyvsp[-1].str), (yyvsp[0].mode));
                                                 } else {
@@ -3706,30 +3838,30 @@ yyreduce:
                                                 }
                                                 opt_asm = 0;
                                               }
-#line 3710 "mon_parse.c" /* yacc.c:1646  */
+#line 3842 "mon_parse.c"
     break;
 
-  case 245:
-#line 780 "mon_parse.y" /* yacc.c:1646  */
-    { asm_mode = 0; }
-#line 3716 "mon_parse.c" /* yacc.c:1646  */
+  case 247: /* post_assemble: assembly_instr_list  */
+#line 784 "mon_parse.y"
+                                   { asm_mode = 0; }
+#line 3848 "mon_parse.c"
     break;
 
-  case 246:
-#line 783 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[0].i) > 0xff) {
+  case 248: /* asm_operand_mode: ARG_IMMEDIATE number  */
+#line 787 "mon_parse.y"
+                                       { if ((yyvsp[0].i) > 0xff) {
                           (yyval.mode).addr_mode = ASM_ADDR_MODE_IMMEDIATE_16;
                           (yyval.mode).param = (yyvsp[0].i);
                         } else {
                           (yyval.mode).addr_mode = ASM_ADDR_MODE_IMMEDIATE;
                           (yyval.mode).param = (yyvsp[0].i);
                         } }
-#line 3728 "mon_parse.c" /* yacc.c:1646  */
+#line 3860 "mon_parse.c"
     break;
 
-  case 247:
-#line 790 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[0].i) >= 0x10000) {
+  case 249: /* asm_operand_mode: number  */
+#line 794 "mon_parse.y"
+           { if ((yyvsp[0].i) >= 0x10000) {
                (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_LONG;
                (yyval.mode).param = (yyvsp[0].i);
              } else if ((yyvsp[0].i) < 0x100) {
@@ -3740,12 +3872,12 @@ yyreduce:
                (yyval.mode).param = (yyvsp[0].i);
              }
            }
-#line 3744 "mon_parse.c" /* yacc.c:1646  */
+#line 3876 "mon_parse.c"
     break;
 
-  case 248:
-#line 801 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) >= 0x10000) {
+  case 250: /* asm_operand_mode: number COMMA REG_X  */
+#line 805 "mon_parse.y"
+                        { if ((yyvsp[-2].i) >= 0x10000) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_LONG_X;
                             (yyval.mode).param = (yyvsp[-2].i);
                           } else if ((yyvsp[-2].i) < 0x100) { 
@@ -3756,12 +3888,12 @@ yyreduce:
                             (yyval.mode).param = (yyvsp[-2].i);
                           }
                         }
-#line 3760 "mon_parse.c" /* yacc.c:1646  */
+#line 3892 "mon_parse.c"
     break;
 
-  case 249:
-#line 812 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) < 0x100) {
+  case 251: /* asm_operand_mode: number COMMA REG_Y  */
+#line 816 "mon_parse.y"
+                        { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_ZERO_PAGE_Y;
                             (yyval.mode).param = (yyvsp[-2].i);
                           } else {
@@ -3769,12 +3901,12 @@ yyreduce:
                             (yyval.mode).param = (yyvsp[-2].i);
                           }
                         }
-#line 3773 "mon_parse.c" /* yacc.c:1646  */
+#line 3905 "mon_parse.c"
     break;
 
-  case 250:
-#line 820 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) < 0x100) {
+  case 252: /* asm_operand_mode: number COMMA REG_S  */
+#line 824 "mon_parse.y"
+                        { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_STACK_RELATIVE;
                             (yyval.mode).param = (yyvsp[-2].i);
                           } else { /* 6809 */
@@ -3793,23 +3925,23 @@ yyreduce:
                             }
                           }
                         }
-#line 3797 "mon_parse.c" /* yacc.c:1646  */
+#line 3929 "mon_parse.c"
     break;
 
-  case 251:
-#line 839 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-2].i) < 0x100) {
+  case 253: /* asm_operand_mode: number COMMA number  */
+#line 843 "mon_parse.y"
+                        { if ((yyvsp[-2].i) < 0x100) {
                             (yyval.mode).addr_mode = ASM_ADDR_MODE_DOUBLE;
                             (yyval.mode).param = (yyvsp[0].i);
                             (yyval.mode).addr_submode = (yyvsp[-2].i);
                           }
                         }
-#line 3808 "mon_parse.c" /* yacc.c:1646  */
+#line 3940 "mon_parse.c"
     break;
 
-  case 252:
-#line 845 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-1].i) < 0x100) {
+  case 254: /* asm_operand_mode: L_PAREN number R_PAREN  */
+#line 849 "mon_parse.y"
+                           { if ((yyvsp[-1].i) < 0x100) {
                                (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT;
                                (yyval.mode).param = (yyvsp[-1].i);
                              } else {
@@ -3817,12 +3949,12 @@ yyreduce:
                                (yyval.mode).param = (yyvsp[-1].i);
                              }
                            }
-#line 3821 "mon_parse.c" /* yacc.c:1646  */
+#line 3953 "mon_parse.c"
     break;
 
-  case 253:
-#line 853 "mon_parse.y" /* yacc.c:1646  */
-    { if ((yyvsp[-3].i) < 0x100) {
+  case 255: /* asm_operand_mode: L_PAREN number COMMA REG_X R_PAREN  */
+#line 857 "mon_parse.y"
+                                       { if ((yyvsp[-3].i) < 0x100) {
                                            (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_X;
                                            (yyval.mode).param = (yyvsp[-3].i);
                                          } else {
@@ -3830,204 +3962,204 @@ yyreduce:
                                            (yyval.mode).param = (yyvsp[-3].i);
                                          }
                                        }
-#line 3834 "mon_parse.c" /* yacc.c:1646  */
+#line 3966 "mon_parse.c"
     break;
 
-  case 254:
-#line 862 "mon_parse.y" /* yacc.c:1646  */
+  case 256: /* asm_operand_mode: L_PAREN number COMMA REG_S R_PAREN COMMA REG_Y  */
+#line 866 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_STACK_RELATIVE_Y; (yyval.mode).param = (yyvsp[-5].i); }
-#line 3840 "mon_parse.c" /* yacc.c:1646  */
+#line 3972 "mon_parse.c"
     break;
 
-  case 255:
-#line 864 "mon_parse.y" /* yacc.c:1646  */
+  case 257: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_Y  */
+#line 868 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_Y; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3846 "mon_parse.c" /* yacc.c:1646  */
+#line 3978 "mon_parse.c"
     break;
 
-  case 256:
-#line 865 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_BC; }
-#line 3852 "mon_parse.c" /* yacc.c:1646  */
+  case 258: /* asm_operand_mode: L_PAREN REG_BC R_PAREN  */
+#line 869 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_BC; }
+#line 3984 "mon_parse.c"
     break;
 
-  case 257:
-#line 866 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_DE; }
-#line 3858 "mon_parse.c" /* yacc.c:1646  */
+  case 259: /* asm_operand_mode: L_PAREN REG_DE R_PAREN  */
+#line 870 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_DE; }
+#line 3990 "mon_parse.c"
     break;
 
-  case 258:
-#line 867 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_HL; }
-#line 3864 "mon_parse.c" /* yacc.c:1646  */
+  case 260: /* asm_operand_mode: L_PAREN REG_HL R_PAREN  */
+#line 871 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_HL; }
+#line 3996 "mon_parse.c"
     break;
 
-  case 259:
-#line 868 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IX; }
-#line 3870 "mon_parse.c" /* yacc.c:1646  */
+  case 261: /* asm_operand_mode: L_PAREN REG_IX R_PAREN  */
+#line 872 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IX; }
+#line 4002 "mon_parse.c"
     break;
 
-  case 260:
-#line 869 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IY; }
-#line 3876 "mon_parse.c" /* yacc.c:1646  */
+  case 262: /* asm_operand_mode: L_PAREN REG_IY R_PAREN  */
+#line 873 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_IY; }
+#line 4008 "mon_parse.c"
     break;
 
-  case 261:
-#line 870 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_SP; }
-#line 3882 "mon_parse.c" /* yacc.c:1646  */
+  case 263: /* asm_operand_mode: L_PAREN REG_SP R_PAREN  */
+#line 874 "mon_parse.y"
+                           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IND_SP; }
+#line 4014 "mon_parse.c"
     break;
 
-  case 262:
-#line 872 "mon_parse.y" /* yacc.c:1646  */
+  case 264: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_A  */
+#line 876 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_A; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3888 "mon_parse.c" /* yacc.c:1646  */
+#line 4020 "mon_parse.c"
     break;
 
-  case 263:
-#line 874 "mon_parse.y" /* yacc.c:1646  */
+  case 265: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_HL  */
+#line 878 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_HL; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3894 "mon_parse.c" /* yacc.c:1646  */
+#line 4026 "mon_parse.c"
     break;
 
-  case 264:
-#line 876 "mon_parse.y" /* yacc.c:1646  */
+  case 266: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_IX  */
+#line 880 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_IX; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3900 "mon_parse.c" /* yacc.c:1646  */
+#line 4032 "mon_parse.c"
     break;
 
-  case 265:
-#line 878 "mon_parse.y" /* yacc.c:1646  */
+  case 267: /* asm_operand_mode: L_PAREN number R_PAREN COMMA REG_IY  */
+#line 882 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_ABSOLUTE_IY; (yyval.mode).param = (yyvsp[-3].i); }
-#line 3906 "mon_parse.c" /* yacc.c:1646  */
+#line 4038 "mon_parse.c"
     break;
 
-  case 266:
-#line 879 "mon_parse.y" /* yacc.c:1646  */
+  case 268: /* asm_operand_mode: %empty  */
+#line 883 "mon_parse.y"
     { (yyval.mode).addr_mode = ASM_ADDR_MODE_IMPLIED; }
-#line 3912 "mon_parse.c" /* yacc.c:1646  */
+#line 4044 "mon_parse.c"
     break;
 
-  case 267:
-#line 880 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_ACCUMULATOR; }
-#line 3918 "mon_parse.c" /* yacc.c:1646  */
+  case 269: /* asm_operand_mode: REG_A  */
+#line 884 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_ACCUMULATOR; }
+#line 4050 "mon_parse.c"
     break;
 
-  case 268:
-#line 881 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_B; }
-#line 3924 "mon_parse.c" /* yacc.c:1646  */
+  case 270: /* asm_operand_mode: REG_B  */
+#line 885 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_B; }
+#line 4056 "mon_parse.c"
     break;
 
-  case 269:
-#line 882 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_C; }
-#line 3930 "mon_parse.c" /* yacc.c:1646  */
+  case 271: /* asm_operand_mode: REG_C  */
+#line 886 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_C; }
+#line 4062 "mon_parse.c"
     break;
 
-  case 270:
-#line 883 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_D; }
-#line 3936 "mon_parse.c" /* yacc.c:1646  */
+  case 272: /* asm_operand_mode: REG_D  */
+#line 887 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_D; }
+#line 4068 "mon_parse.c"
     break;
 
-  case 271:
-#line 884 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_E; }
-#line 3942 "mon_parse.c" /* yacc.c:1646  */
+  case 273: /* asm_operand_mode: REG_E  */
+#line 888 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_E; }
+#line 4074 "mon_parse.c"
     break;
 
-  case 272:
-#line 885 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_H; }
-#line 3948 "mon_parse.c" /* yacc.c:1646  */
+  case 274: /* asm_operand_mode: REG_H  */
+#line 889 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_H; }
+#line 4080 "mon_parse.c"
     break;
 
-  case 273:
-#line 886 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXH; }
-#line 3954 "mon_parse.c" /* yacc.c:1646  */
+  case 275: /* asm_operand_mode: REG_IXH  */
+#line 890 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXH; }
+#line 4086 "mon_parse.c"
     break;
 
-  case 274:
-#line 887 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYH; }
-#line 3960 "mon_parse.c" /* yacc.c:1646  */
+  case 276: /* asm_operand_mode: REG_IYH  */
+#line 891 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYH; }
+#line 4092 "mon_parse.c"
     break;
 
-  case 275:
-#line 888 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_L; }
-#line 3966 "mon_parse.c" /* yacc.c:1646  */
+  case 277: /* asm_operand_mode: REG_L  */
+#line 892 "mon_parse.y"
+          { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_L; }
+#line 4098 "mon_parse.c"
     break;
 
-  case 276:
-#line 889 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXL; }
-#line 3972 "mon_parse.c" /* yacc.c:1646  */
+  case 278: /* asm_operand_mode: REG_IXL  */
+#line 893 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IXL; }
+#line 4104 "mon_parse.c"
     break;
 
-  case 277:
-#line 890 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYL; }
-#line 3978 "mon_parse.c" /* yacc.c:1646  */
+  case 279: /* asm_operand_mode: REG_IYL  */
+#line 894 "mon_parse.y"
+            { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IYL; }
+#line 4110 "mon_parse.c"
     break;
 
-  case 278:
-#line 891 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_AF; }
-#line 3984 "mon_parse.c" /* yacc.c:1646  */
+  case 280: /* asm_operand_mode: REG_AF  */
+#line 895 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_AF; }
+#line 4116 "mon_parse.c"
     break;
 
-  case 279:
-#line 892 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_BC; }
-#line 3990 "mon_parse.c" /* yacc.c:1646  */
+  case 281: /* asm_operand_mode: REG_BC  */
+#line 896 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_BC; }
+#line 4122 "mon_parse.c"
     break;
 
-  case 280:
-#line 893 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_DE; }
-#line 3996 "mon_parse.c" /* yacc.c:1646  */
+  case 282: /* asm_operand_mode: REG_DE  */
+#line 897 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_DE; }
+#line 4128 "mon_parse.c"
     break;
 
-  case 281:
-#line 894 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_HL; }
-#line 4002 "mon_parse.c" /* yacc.c:1646  */
+  case 283: /* asm_operand_mode: REG_HL  */
+#line 898 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_HL; }
+#line 4134 "mon_parse.c"
     break;
 
-  case 282:
-#line 895 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IX; }
-#line 4008 "mon_parse.c" /* yacc.c:1646  */
+  case 284: /* asm_operand_mode: REG_IX  */
+#line 899 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IX; }
+#line 4140 "mon_parse.c"
     break;
 
-  case 283:
-#line 896 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IY; }
-#line 4014 "mon_parse.c" /* yacc.c:1646  */
+  case 285: /* asm_operand_mode: REG_IY  */
+#line 900 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_IY; }
+#line 4146 "mon_parse.c"
     break;
 
-  case 284:
-#line 897 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_SP; }
-#line 4020 "mon_parse.c" /* yacc.c:1646  */
+  case 286: /* asm_operand_mode: REG_SP  */
+#line 901 "mon_parse.y"
+           { (yyval.mode).addr_mode = ASM_ADDR_MODE_REG_SP; }
+#line 4152 "mon_parse.c"
     break;
 
-  case 285:
-#line 899 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.mode).addr_mode = ASM_ADDR_MODE_DIRECT; (yyval.mode).param = (yyvsp[0].i); }
-#line 4026 "mon_parse.c" /* yacc.c:1646  */
+  case 287: /* asm_operand_mode: LESS_THAN number  */
+#line 903 "mon_parse.y"
+                     { (yyval.mode).addr_mode = ASM_ADDR_MODE_DIRECT; (yyval.mode).param = (yyvsp[0].i); }
+#line 4158 "mon_parse.c"
     break;
 
-  case 286:
-#line 900 "mon_parse.y" /* yacc.c:1646  */
-    {    /* Clash with addr,x addr,y addr,s modes! */
+  case 288: /* asm_operand_mode: number COMMA index_ureg  */
+#line 904 "mon_parse.y"
+                            {    /* Clash with addr,x addr,y addr,s modes! */
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         if ((yyvsp[-2].i) >= -16 && (yyvsp[-2].i) < 16) {
             (yyval.mode).addr_submode = (3 << 5) | ((yyvsp[-2].i) & 0x1F);
@@ -4042,84 +4174,84 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4046 "mon_parse.c" /* yacc.c:1646  */
+#line 4178 "mon_parse.c"
     break;
 
-  case 287:
-#line 915 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 289: /* asm_operand_mode: COMMA index_reg PLUS  */
+#line 919 "mon_parse.y"
+                         {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_INC1;
         }
-#line 4055 "mon_parse.c" /* yacc.c:1646  */
+#line 4187 "mon_parse.c"
     break;
 
-  case 288:
-#line 919 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 290: /* asm_operand_mode: COMMA index_reg PLUS PLUS  */
+#line 923 "mon_parse.y"
+                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_INC2;
         }
-#line 4064 "mon_parse.c" /* yacc.c:1646  */
+#line 4196 "mon_parse.c"
     break;
 
-  case 289:
-#line 923 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 291: /* asm_operand_mode: COMMA MINUS index_reg  */
+#line 927 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_DEC1;
         }
-#line 4073 "mon_parse.c" /* yacc.c:1646  */
+#line 4205 "mon_parse.c"
     break;
 
-  case 290:
-#line 927 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 292: /* asm_operand_mode: COMMA MINUS MINUS index_reg  */
+#line 931 "mon_parse.y"
+                                {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_DEC2;
         }
-#line 4082 "mon_parse.c" /* yacc.c:1646  */
+#line 4214 "mon_parse.c"
     break;
 
-  case 291:
-#line 931 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 293: /* asm_operand_mode: COMMA index_reg  */
+#line 935 "mon_parse.y"
+                    {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[0].i) | ASM_ADDR_MODE_INDEXED_OFF0;
         }
-#line 4091 "mon_parse.c" /* yacc.c:1646  */
+#line 4223 "mon_parse.c"
     break;
 
-  case 292:
-#line 935 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 294: /* asm_operand_mode: REG_B COMMA index_reg  */
+#line 939 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFB;
         }
-#line 4100 "mon_parse.c" /* yacc.c:1646  */
+#line 4232 "mon_parse.c"
     break;
 
-  case 293:
-#line 939 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 295: /* asm_operand_mode: REG_A COMMA index_reg  */
+#line 943 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFA;
         }
-#line 4109 "mon_parse.c" /* yacc.c:1646  */
+#line 4241 "mon_parse.c"
     break;
 
-  case 294:
-#line 943 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 296: /* asm_operand_mode: REG_D COMMA index_reg  */
+#line 947 "mon_parse.y"
+                          {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFFD;
         }
-#line 4118 "mon_parse.c" /* yacc.c:1646  */
+#line 4250 "mon_parse.c"
     break;
 
-  case 295:
-#line 947 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 297: /* asm_operand_mode: number COMMA REG_PC  */
+#line 951 "mon_parse.y"
+                        {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).param = (yyvsp[-2].i);
         if ((yyvsp[-2].i) >= -128 && (yyvsp[-2].i) < 128) {
@@ -4131,12 +4263,12 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4135 "mon_parse.c" /* yacc.c:1646  */
+#line 4267 "mon_parse.c"
     break;
 
-  case 296:
-#line 959 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 298: /* asm_operand_mode: L_BRACKET number COMMA index_reg R_BRACKET  */
+#line 963 "mon_parse.y"
+                                               {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         if ((yyvsp[-3].i) >= -16 && (yyvsp[-3].i) < 16) {
             (yyval.mode).addr_submode = (yyvsp[-3].i) & 0x1F;
@@ -4151,84 +4283,84 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4155 "mon_parse.c" /* yacc.c:1646  */
+#line 4287 "mon_parse.c"
     break;
 
-  case 297:
-#line 974 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 299: /* asm_operand_mode: L_BRACKET COMMA index_reg PLUS R_BRACKET  */
+#line 978 "mon_parse.y"
+                                             {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_INC1;
         }
-#line 4164 "mon_parse.c" /* yacc.c:1646  */
+#line 4296 "mon_parse.c"
     break;
 
-  case 298:
-#line 978 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 300: /* asm_operand_mode: L_BRACKET COMMA index_reg PLUS PLUS R_BRACKET  */
+#line 982 "mon_parse.y"
+                                                  {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-3].i) | ASM_ADDR_MODE_INDEXED_INC2;
         }
-#line 4173 "mon_parse.c" /* yacc.c:1646  */
+#line 4305 "mon_parse.c"
     break;
 
-  case 299:
-#line 982 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 301: /* asm_operand_mode: L_BRACKET COMMA MINUS index_reg R_BRACKET  */
+#line 986 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_DEC1;
         }
-#line 4182 "mon_parse.c" /* yacc.c:1646  */
+#line 4314 "mon_parse.c"
     break;
 
-  case 300:
-#line 986 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 302: /* asm_operand_mode: L_BRACKET COMMA MINUS MINUS index_reg R_BRACKET  */
+#line 990 "mon_parse.y"
+                                                    {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_DEC2;
         }
-#line 4191 "mon_parse.c" /* yacc.c:1646  */
+#line 4323 "mon_parse.c"
     break;
 
-  case 301:
-#line 990 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 303: /* asm_operand_mode: L_BRACKET COMMA index_reg R_BRACKET  */
+#line 994 "mon_parse.y"
+                                        {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-1].i) | ASM_ADDR_MODE_INDEXED_OFF0;
         }
-#line 4200 "mon_parse.c" /* yacc.c:1646  */
+#line 4332 "mon_parse.c"
     break;
 
-  case 302:
-#line 994 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 304: /* asm_operand_mode: L_BRACKET REG_B COMMA index_reg R_BRACKET  */
+#line 998 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFB;
         }
-#line 4209 "mon_parse.c" /* yacc.c:1646  */
+#line 4341 "mon_parse.c"
     break;
 
-  case 303:
-#line 998 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 305: /* asm_operand_mode: L_BRACKET REG_A COMMA index_reg R_BRACKET  */
+#line 1002 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFA;
         }
-#line 4218 "mon_parse.c" /* yacc.c:1646  */
+#line 4350 "mon_parse.c"
     break;
 
-  case 304:
-#line 1002 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 306: /* asm_operand_mode: L_BRACKET REG_D COMMA index_reg R_BRACKET  */
+#line 1006 "mon_parse.y"
+                                              {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | (yyvsp[-2].i) | ASM_ADDR_MODE_INDEXED_OFFD;
         }
-#line 4227 "mon_parse.c" /* yacc.c:1646  */
+#line 4359 "mon_parse.c"
     break;
 
-  case 305:
-#line 1006 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 307: /* asm_operand_mode: L_BRACKET number COMMA REG_PC R_BRACKET  */
+#line 1010 "mon_parse.y"
+                                            {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).param = (yyvsp[-3].i);
         if ((yyvsp[-3].i) >= -128 && (yyvsp[-3].i) < 128) {
@@ -4240,60 +4372,61 @@ yyreduce:
             mon_out("offset too large even for 16 bits (signed)\n");
         }
     }
-#line 4244 "mon_parse.c" /* yacc.c:1646  */
+#line 4376 "mon_parse.c"
     break;
 
-  case 306:
-#line 1018 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 308: /* asm_operand_mode: L_BRACKET number R_BRACKET  */
+#line 1022 "mon_parse.y"
+                               {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDEXED;
         (yyval.mode).addr_submode = 0x80 | ASM_ADDR_MODE_EXTENDED_INDIRECT;
         (yyval.mode).param = (yyvsp[-1].i);
         }
-#line 4254 "mon_parse.c" /* yacc.c:1646  */
+#line 4386 "mon_parse.c"
     break;
 
-  case 307:
-#line 1023 "mon_parse.y" /* yacc.c:1646  */
-    {
+  case 309: /* asm_operand_mode: L_BRACKET number R_BRACKET COMMA REG_Y  */
+#line 1027 "mon_parse.y"
+                                           {
         (yyval.mode).addr_mode = ASM_ADDR_MODE_INDIRECT_LONG_Y;
         (yyval.mode).param = (yyvsp[-3].i);
         }
-#line 4263 "mon_parse.c" /* yacc.c:1646  */
+#line 4395 "mon_parse.c"
     break;
 
-  case 308:
-#line 1031 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (0 << 5); printf("reg_x\n"); }
-#line 4269 "mon_parse.c" /* yacc.c:1646  */
+  case 310: /* index_reg: REG_X  */
+#line 1035 "mon_parse.y"
+          { (yyval.i) = (0 << 5); printf("reg_x\n"); }
+#line 4401 "mon_parse.c"
     break;
 
-  case 309:
-#line 1032 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (1 << 5); printf("reg_y\n"); }
-#line 4275 "mon_parse.c" /* yacc.c:1646  */
+  case 311: /* index_reg: REG_Y  */
+#line 1036 "mon_parse.y"
+          { (yyval.i) = (1 << 5); printf("reg_y\n"); }
+#line 4407 "mon_parse.c"
     break;
 
-  case 310:
-#line 1033 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (yyvsp[0].i); }
-#line 4281 "mon_parse.c" /* yacc.c:1646  */
+  case 312: /* index_reg: index_ureg  */
+#line 1037 "mon_parse.y"
+               { (yyval.i) = (yyvsp[0].i); }
+#line 4413 "mon_parse.c"
     break;
 
-  case 311:
-#line 1034 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (3 << 5); printf("reg_s\n"); }
-#line 4287 "mon_parse.c" /* yacc.c:1646  */
+  case 313: /* index_reg: REG_S  */
+#line 1038 "mon_parse.y"
+          { (yyval.i) = (3 << 5); printf("reg_s\n"); }
+#line 4419 "mon_parse.c"
     break;
 
-  case 312:
-#line 1038 "mon_parse.y" /* yacc.c:1646  */
-    { (yyval.i) = (2 << 5); printf("reg_u\n"); }
-#line 4293 "mon_parse.c" /* yacc.c:1646  */
+  case 314: /* index_ureg: REG_U  */
+#line 1042 "mon_parse.y"
+          { (yyval.i) = (2 << 5); printf("reg_u\n"); }
+#line 4425 "mon_parse.c"
     break;
 
 
-#line 4297 "mon_parse.c" /* yacc.c:1646  */
+#line 4429 "mon_parse.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4307,25 +4440,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -4336,50 +4467,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -4408,12 +4503,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -4430,13 +4524,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -4450,7 +4545,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4462,7 +4557,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4473,26 +4568,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -4508,20 +4607,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 1042 "mon_parse.y" /* yacc.c:1906  */
+
+#line 1046 "mon_parse.y"
 
 
 void parse_and_execute_line(char *input)
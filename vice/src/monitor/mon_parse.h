@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2013 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_MON_PARSE_H_INCLUDED
 # define YY_YY_MON_PARSE_H_INCLUDED
 /* Debug traces.  */
@@ -40,174 +45,184 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    H_NUMBER = 258,
-    D_NUMBER = 259,
-    O_NUMBER = 260,
-    B_NUMBER = 261,
-    CONVERT_OP = 262,
-    B_DATA = 263,
-    H_RANGE_GUESS = 264,
-    D_NUMBER_GUESS = 265,
-    O_NUMBER_GUESS = 266,
-    B_NUMBER_GUESS = 267,
-    BAD_CMD = 268,
-    MEM_OP = 269,
-    IF = 270,
-    MEM_COMP = 271,
-    MEM_DISK8 = 272,
-    MEM_DISK9 = 273,
-    MEM_DISK10 = 274,
-    MEM_DISK11 = 275,
-    EQUALS = 276,
-    TRAIL = 277,
-    CMD_SEP = 278,
-    LABEL_ASGN_COMMENT = 279,
-    CMD_SIDEFX = 280,
-    CMD_RETURN = 281,
-    CMD_BLOCK_READ = 282,
-    CMD_BLOCK_WRITE = 283,
-    CMD_UP = 284,
-    CMD_DOWN = 285,
-    CMD_LOAD = 286,
-    CMD_SAVE = 287,
-    CMD_VERIFY = 288,
-    CMD_IGNORE = 289,
-    CMD_HUNT = 290,
-    CMD_FILL = 291,
-    CMD_MOVE = 292,
-    CMD_GOTO = 293,
-    CMD_REGISTERS = 294,
-    CMD_READSPACE = 295,
-    CMD_WRITESPACE = 296,
-    CMD_RADIX = 297,
-    CMD_MEM_DISPLAY = 298,
-    CMD_BREAK = 299,
-    CMD_TRACE = 300,
-    CMD_IO = 301,
-    CMD_BRMON = 302,
-    CMD_COMPARE = 303,
-    CMD_DUMP = 304,
-    CMD_UNDUMP = 305,
-    CMD_EXIT = 306,
-    CMD_DELETE = 307,
-    CMD_CONDITION = 308,
-    CMD_COMMAND = 309,
-    CMD_ASSEMBLE = 310,
-    CMD_DISASSEMBLE = 311,
-    CMD_NEXT = 312,
-    CMD_STEP = 313,
-    CMD_PRINT = 314,
-    CMD_DEVICE = 315,
-    CMD_HELP = 316,
-    CMD_WATCH = 317,
-    CMD_DISK = 318,
-    CMD_QUIT = 319,
-    CMD_CHDIR = 320,
-    CMD_BANK = 321,
-    CMD_LOAD_LABELS = 322,
-    CMD_SAVE_LABELS = 323,
-    CMD_ADD_LABEL = 324,
-    CMD_DEL_LABEL = 325,
-    CMD_SHOW_LABELS = 326,
-    CMD_CLEAR_LABELS = 327,
-    CMD_RECORD = 328,
-    CMD_MON_STOP = 329,
-    CMD_PLAYBACK = 330,
-    CMD_CHAR_DISPLAY = 331,
-    CMD_SPRITE_DISPLAY = 332,
-    CMD_TEXT_DISPLAY = 333,
-    CMD_SCREENCODE_DISPLAY = 334,
-    CMD_ENTER_DATA = 335,
-    CMD_ENTER_BIN_DATA = 336,
-    CMD_KEYBUF = 337,
-    CMD_BLOAD = 338,
-    CMD_BSAVE = 339,
-    CMD_SCREEN = 340,
-    CMD_UNTIL = 341,
-    CMD_CPU = 342,
-    CMD_YYDEBUG = 343,
-    CMD_BACKTRACE = 344,
-    CMD_SCREENSHOT = 345,
-    CMD_PWD = 346,
-    CMD_DIR = 347,
-    CMD_RESOURCE_GET = 348,
-    CMD_RESOURCE_SET = 349,
-    CMD_LOAD_RESOURCES = 350,
-    CMD_SAVE_RESOURCES = 351,
-    CMD_ATTACH = 352,
-    CMD_DETACH = 353,
-    CMD_MON_RESET = 354,
-    CMD_TAPECTRL = 355,
-    CMD_CARTFREEZE = 356,
-    CMD_CPUHISTORY = 357,
-    CMD_MEMMAPZAP = 358,
-    CMD_MEMMAPSHOW = 359,
-    CMD_MEMMAPSAVE = 360,
-    CMD_COMMENT = 361,
-    CMD_LIST = 362,
-    CMD_STOPWATCH = 363,
-    RESET = 364,
-    CMD_EXPORT = 365,
-    CMD_AUTOSTART = 366,
-    CMD_AUTOLOAD = 367,
-    CMD_LABEL_ASGN = 368,
-    L_PAREN = 369,
-    R_PAREN = 370,
-    ARG_IMMEDIATE = 371,
-    REG_A = 372,
-    REG_X = 373,
-    REG_Y = 374,
-    COMMA = 375,
-    INST_SEP = 376,
-    L_BRACKET = 377,
-    R_BRACKET = 378,
-    LESS_THAN = 379,
-    REG_U = 380,
-    REG_S = 381,
-    REG_PC = 382,
-    REG_PCR = 383,
-    REG_B = 384,
-    REG_C = 385,
-    REG_D = 386,
-    REG_E = 387,
-    REG_H = 388,
-    REG_L = 389,
-    REG_AF = 390,
-    REG_BC = 391,
-    REG_DE = 392,
-    REG_HL = 393,
-    REG_IX = 394,
-    REG_IY = 395,
-    REG_SP = 396,
-    REG_IXH = 397,
-    REG_IXL = 398,
-    REG_IYH = 399,
-    REG_IYL = 400,
-    PLUS = 401,
-    MINUS = 402,
-    STRING = 403,
-    FILENAME = 404,
-    R_O_L = 405,
-    OPCODE = 406,
-    LABEL = 407,
-    BANKNAME = 408,
-    CPUTYPE = 409,
-    MON_REGISTER = 410,
-    COMPARE_OP = 411,
-    RADIX_TYPE = 412,
-    INPUT_SPEC = 413,
-    CMD_CHECKPT_ON = 414,
-    CMD_CHECKPT_OFF = 415,
-    TOGGLE = 416,
-    MASK = 417
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    H_NUMBER = 258,                /* H_NUMBER  */
+    D_NUMBER = 259,                /* D_NUMBER  */
+    O_NUMBER = 260,                /* O_NUMBER  */
+    B_NUMBER = 261,                /* B_NUMBER  */
+    CONVERT_OP = 262,              /* CONVERT_OP  */
+    B_DATA = 263,                  /* B_DATA  */
+    H_RANGE_GUESS = 264,           /* H_RANGE_GUESS  */
+    D_NUMBER_GUESS = 265,          /* D_NUMBER_GUESS  */
+    O_NUMBER_GUESS = 266,          /* O_NUMBER_GUESS  */
+    B_NUMBER_GUESS = 267,          /* B_NUMBER_GUESS  */
+    BAD_CMD = 268,                 /* BAD_CMD  */
+    MEM_OP = 269,                  /* MEM_OP  */
+    IF = 270,                      /* IF  */
+    MEM_COMP = 271,                /* MEM_COMP  */
+    MEM_DISK8 = 272,               /* MEM_DISK8  */
+    MEM_DISK9 = 273,               /* MEM_DISK9  */
+    MEM_DISK10 = 274,              /* MEM_DISK10  */
+    MEM_DISK11 = 275,              /* MEM_DISK11  */
+    EQUALS = 276,                  /* EQUALS  */
+    TRAIL = 277,                   /* TRAIL  */
+    CMD_SEP = 278,                 /* CMD_SEP  */
+    LABEL_ASGN_COMMENT = 279,      /* LABEL_ASGN_COMMENT  */
+    CMD_SIDEFX = 280,              /* CMD_SIDEFX  */
+    CMD_RETURN = 281,              /* CMD_RETURN  */
+    CMD_BLOCK_READ = 282,          /* CMD_BLOCK_READ  */
+    CMD_BLOCK_WRITE = 283,         /* CMD_BLOCK_WRITE  */
+    CMD_UP = 284,                  /* CMD_UP  */
+    CMD_DOWN = 285,                /* CMD_DOWN  */
+    CMD_LOAD = 286,                /* CMD_LOAD  */
+    CMD_SAVE = 287,                /* CMD_SAVE  */
+    CMD_VERIFY = 288,              /* CMD_VERIFY  */
+    CMD_IGNORE = 289,              /* CMD_IGNORE  */
+    CMD_HUNT = 290,                /* CMD_HUNT  */
+    CMD_FILL = 291,                /* CMD_FILL  */
+    CMD_MOVE = 292,                /* CMD_MOVE  */
+    CMD_GOTO = 293,                /* CMD_GOTO  */
+    CMD_REGISTERS = 294,           /* CMD_REGISTERS  */
+    CMD_READSPACE = 295,           /* CMD_READSPACE  */
+    CMD_WRITESPACE = 296,          /* CMD_WRITESPACE  */
+    CMD_RADIX = 297,               /* CMD_RADIX  */
+    CMD_MEM_DISPLAY = 298,         /* CMD_MEM_DISPLAY  */
+    CMD_BREAK = 299,               /* CMD_BREAK  */
+    CMD_TRACE = 300,               /* CMD_TRACE  */
+    CMD_IO = 301,                  /* CMD_IO  */
+    CMD_BRMON = 302,               /* CMD_BRMON  */
+    CMD_COMPARE = 303,             /* CMD_COMPARE  */
+    CMD_DUMP = 304,                /* CMD_DUMP  */
+    CMD_UNDUMP = 305,              /* CMD_UNDUMP  */
+    CMD_EXIT = 306,                /* CMD_EXIT  */
+    CMD_DELETE = 307,              /* CMD_DELETE  */
+    CMD_CONDITION = 308,           /* CMD_CONDITION  */
+    CMD_COMMAND = 309,             /* CMD_COMMAND  */
+    CMD_ASSEMBLE = 310,            /* CMD_ASSEMBLE  */
+    CMD_DISASSEMBLE = 311,         /* CMD_DISASSEMBLE  */
+    CMD_NEXT = 312,                /* CMD_NEXT  */
+    CMD_STEP = 313,                /* CMD_STEP  */
+    CMD_PRINT = 314,               /* CMD_PRINT  */
+    CMD_DEVICE = 315,              /* CMD_DEVICE  */
+    CMD_HELP = 316,                /* CMD_HELP  */
+    CMD_WATCH = 317,               /* CMD_WATCH  */
+    CMD_DISK = 318,                /* CMD_DISK  */
+    CMD_QUIT = 319,                /* CMD_QUIT  */
+    CMD_CHDIR = 320,               /* CMD_CHDIR  */
+    CMD_BANK = 321,                /* CMD_BANK  */
+    CMD_LOAD_LABELS = 322,         /* CMD_LOAD_LABELS  */
+    CMD_SAVE_LABELS = 323,         /* CMD_SAVE_LABELS  */
+    CMD_ADD_LABEL = 324,           /* CMD_ADD_LABEL  */
+    CMD_DEL_LABEL = 325,           /* CMD_DEL_LABEL  */
+    CMD_SHOW_LABELS = 326,         /* CMD_SHOW_LABELS  */
+    CMD_CLEAR_LABELS = 327,        /* CMD_CLEAR_LABELS  */
+    CMD_RECORD = 328,              /* CMD_RECORD  */
+    CMD_MON_STOP = 329,            /* CMD_MON_STOP  */
+    CMD_PLAYBACK = 330,            /* CMD_PLAYBACK  */
+    CMD_CHAR_DISPLAY = 331,        /* CMD_CHAR_DISPLAY  */
+    CMD_SPRITE_DISPLAY = 332,      /* CMD_SPRITE_DISPLAY  */
+    CMD_TEXT_DISPLAY = 333,        /* CMD_TEXT_DISPLAY  */
+    CMD_SCREENCODE_DISPLAY = 334,  /* CMD_SCREENCODE_DISPLAY  */
+    CMD_ENTER_DATA = 335,          /* CMD_ENTER_DATA  */
+    CMD_ENTER_BIN_DATA = 336,      /* CMD_ENTER_BIN_DATA  */
+    CMD_KEYBUF = 337,              /* CMD_KEYBUF  */
+    CMD_BLOAD = 338,               /* CMD_BLOAD  */
+    CMD_BSAVE = 339,               /* CMD_BSAVE  */
+    CMD_SCREEN = 340,              /* CMD_SCREEN  */
+    CMD_UNTIL = 341,               /* CMD_UNTIL  */
+    CMD_CPU = 342,                 /* CMD_CPU  */
+    CMD_YYDEBUG = 343,             /* CMD_YYDEBUG  */
+    CMD_BACKTRACE = 344,           /* CMD_BACKTRACE  */
+    CMD_SCREENSHOT = 345,          /* CMD_SCREENSHOT  */
+    CMD_PWD = 346,                 /* CMD_PWD  */
+    CMD_DIR = 347,                 /* CMD_DIR  */
+    CMD_RESOURCE_GET = 348,        /* CMD_RESOURCE_GET  */
+    CMD_RESOURCE_SET = 349,        /* CMD_RESOURCE_SET  */
+    CMD_LOAD_RESOURCES = 350,      /* CMD_LOAD_RESOURCES  */
+    CMD_SAVE_RESOURCES = 351,      /* CMD_SAVE_RESOURCES  */
+    CMD_ATTACH = 352,              /* CMD_ATTACH  */
+    CMD_DETACH = 353,              /* CMD_DETACH  */
+    CMD_MON_RESET = 354,           /* CMD_MON_RESET  */
+    CMD_TAPECTRL = 355,            /* CMD_TAPECTRL  */
+    CMD_CARTFREEZE = 356,          /* CMD_CARTFREEZE  */
+    CMD_CPUHISTORY = 357,          /* CMD_CPUHISTORY  */
+    CMD_MEMMAPZAP = 358,           /* CMD_MEMMAPZAP  */
+    CMD_MEMMAPSHOW = 359,          /* CMD_MEMMAPSHOW  */
+    CMD_MEMMAPSAVE = 360,          /* CMD_MEMMAPSAVE  */
+    CMD_COMMENT = 361,             /* CMD_COMMENT  */
+    CMD_LIST = 362,                /* CMD_LIST  */
+    CMD_STOPWATCH = 363,           /* CMD_STOPWATCH  */
+    RESET = 364,                   /* RESET  */
+    CMD_HOSTTIMERS = 365,          /* CMD_HOSTTIMERS  */
+    CMD_EXPORT = 366,              /* CMD_EXPORT  */
+    CMD_AUTOSTART = 367,           /* CMD_AUTOSTART  */
+    CMD_AUTOLOAD = 368,            /* CMD_AUTOLOAD  */
+    CMD_LABEL_ASGN = 369,          /* CMD_LABEL_ASGN  */
+    L_PAREN = 370,                 /* L_PAREN  */
+    R_PAREN = 371,                 /* R_PAREN  */
+    ARG_IMMEDIATE = 372,           /* ARG_IMMEDIATE  */
+    REG_A = 373,                   /* REG_A  */
+    REG_X = 374,                   /* REG_X  */
+    REG_Y = 375,                   /* REG_Y  */
+    COMMA = 376,                   /* COMMA  */
+    INST_SEP = 377,                /* INST_SEP  */
+    L_BRACKET = 378,               /* L_BRACKET  */
+    R_BRACKET = 379,               /* R_BRACKET  */
+    LESS_THAN = 380,               /* LESS_THAN  */
+    REG_U = 381,                   /* REG_U  */
+    REG_S = 382,                   /* REG_S  */
+    REG_PC = 383,                  /* REG_PC  */
+    REG_PCR = 384,                 /* REG_PCR  */
+    REG_B = 385,                   /* REG_B  */
+    REG_C = 386,                   /* REG_C  */
+    REG_D = 387,                   /* REG_D  */
+    REG_E = 388,                   /* REG_E  */
+    REG_H = 389,                   /* REG_H  */
+    REG_L = 390,                   /* REG_L  */
+    REG_AF = 391,                  /* REG_AF  */
+    REG_BC = 392,                  /* REG_BC  */
+    REG_DE = 393,                  /* REG_DE  */
+    REG_HL = 394,                  /* REG_HL  */
+    REG_IX = 395,                  /* REG_IX  */
+    REG_IY = 396,                  /* REG_IY  */
+    REG_SP = 397,                  /* REG_SP  */
+    REG_IXH = 398,                 /* REG_IXH  */
+    REG_IXL = 399,                 /* REG_IXL  */
+    REG_IYH = 400,                 /* REG_IYH  */
+    REG_IYL = 401,                 /* REG_IYL  */
+    PLUS = 402,                    /* PLUS  */
+    MINUS = 403,                   /* MINUS  */
+    STRING = 404,                  /* STRING  */
+    FILENAME = 405,                /* FILENAME  */
+    R_O_L = 406,                   /* R_O_L  */
+    OPCODE = 407,                  /* OPCODE  */
+    LABEL = 408,                   /* LABEL  */
+    BANKNAME = 409,                /* BANKNAME  */
+    CPUTYPE = 410,                 /* CPUTYPE  */
+    MON_REGISTER = 411,            /* MON_REGISTER  */
+    COMPARE_OP = 412,              /* COMPARE_OP  */
+    RADIX_TYPE = 413,              /* RADIX_TYPE  */
+    INPUT_SPEC = 414,              /* INPUT_SPEC  */
+    CMD_CHECKPT_ON = 415,          /* CMD_CHECKPT_ON  */
+    CMD_CHECKPT_OFF = 416,         /* CMD_CHECKPT_OFF  */
+    TOGGLE = 417,                  /* TOGGLE  */
+    MASK = 418                     /* MASK  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define H_NUMBER 258
 #define D_NUMBER 259
 #define O_NUMBER 260
@@ -315,66 +330,66 @@ extern int yydebug;
 #define CMD_LIST 362
 #define CMD_STOPWATCH 363
 #define RESET 364
-#define CMD_EXPORT 365
-#define CMD_AUTOSTART 366
-#define CMD_AUTOLOAD 367
-#define CMD_LABEL_ASGN 368
-#define L_PAREN 369
-#define R_PAREN 370
-#define ARG_IMMEDIATE 371
-#define REG_A 372
-#define REG_X 373
-#define REG_Y 374
-#define COMMA 375
-#define INST_SEP 376
-#define L_BRACKET 377
-#define R_BRACKET 378
-#define LESS_THAN 379
-#define REG_U 380
-#define REG_S 381
-#define REG_PC 382
-#define REG_PCR 383
-#define REG_B 384
-#define REG_C 385
-#define REG_D 386
-#define REG_E 387
-#define REG_H 388
-#define REG_L 389
-#define REG_AF 390
-#define REG_BC 391
-#define REG_DE 392
-#define REG_HL 393
-#define REG_IX 394
-#define REG_IY 395
-#define REG_SP 396
-#define REG_IXH 397
-#define REG_IXL 398
-#define REG_IYH 399
-#define REG_IYL 400
-#define PLUS 401
-#define MINUS 402
-#define STRING 403
-#define FILENAME 404
-#define R_O_L 405
-#define OPCODE 406
-#define LABEL 407
-#define BANKNAME 408
-#define CPUTYPE 409
-#define MON_REGISTER 410
-#define COMPARE_OP 411
-#define RADIX_TYPE 412
-#define INPUT_SPEC 413
-#define CMD_CHECKPT_ON 414
-#define CMD_CHECKPT_OFF 415
-#define TOGGLE 416
-#define MASK 417
+#define CMD_HOSTTIMERS 365
+#define CMD_EXPORT 366
+#define CMD_AUTOSTART 367
+#define CMD_AUTOLOAD 368
+#define CMD_LABEL_ASGN 369
+#define L_PAREN 370
+#define R_PAREN 371
+#define ARG_IMMEDIATE 372
+#define REG_A 373
+#define REG_X 374
+#define REG_Y 375
+#define COMMA 376
+#define INST_SEP 377
+#define L_BRACKET 378
+#define R_BRACKET 379
+#define LESS_THAN 380
+#define REG_U 381
+#define REG_S 382
+#define REG_PC 383
+#define REG_PCR 384
+#define REG_B 385
+#define REG_C 386
+#define REG_D 387
+#define REG_E 388
+#define REG_H 389
+#define REG_L 390
+#define REG_AF 391
+#define REG_BC 392
+#define REG_DE 393
+#define REG_HL 394
+#define REG_IX 395
+#define REG_IY 396
+#define REG_SP 397
+#define REG_IXH 398
+#define REG_IXL 399
+#define REG_IYH 400
+#define REG_IYL 401
+#define PLUS 402
+#define MINUS 403
+#define STRING 404
+#define FILENAME 405
+#define R_O_L 406
+#define OPCODE 407
+#define LABEL 408
+#define BANKNAME 409
+#define CPUTYPE 410
+#define MON_REGISTER 411
+#define COMPARE_OP 412
+#define RADIX_TYPE 413
+#define INPUT_SPEC 414
+#define CMD_CHECKPT_ON 415
+#define CMD_CHECKPT_OFF 416
+#define TOGGLE 417
+#define MASK 418
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE YYSTYPE;
 union YYSTYPE
 {
-#line 131 "mon_parse.y" /* yacc.c:1909  */
+#line 131 "mon_parse.y"
 
     MON_ADDR a;
     MON_ADDR range[2];
@@ -387,8 +402,10 @@ union YYSTYPE
     char *str;
     asm_mode_addr_info_t mode;
 
-#line 391 "mon_parse.h" /* yacc.c:1909  */
+#line 406 "mon_parse.h"
+
 };
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
 #endif
@@ -396,6 +413,8 @@ union YYSTYPE
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_MON_PARSE_H_INCLUDED  */
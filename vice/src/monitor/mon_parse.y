@@ -160,7 +160,7 @@ extern int cur_len, last_len;
 %token CMD_RESOURCE_GET CMD_RESOURCE_SET CMD_LOAD_RESOURCES CMD_SAVE_RESOURCES
 %token CMD_ATTACH CMD_DETACH CMD_MON_RESET CMD_TAPECTRL CMD_CARTFREEZE
 %token CMD_CPUHISTORY CMD_MEMMAPZAP CMD_MEMMAPSHOW CMD_MEMMAPSAVE
-%token CMD_COMMENT CMD_LIST CMD_STOPWATCH RESET
+%token CMD_COMMENT CMD_LIST CMD_STOPWATCH RESET CMD_HOSTTIMERS
 %token CMD_EXPORT CMD_AUTOSTART CMD_AUTOLOAD
 %token<str> CMD_LABEL_ASGN
 %token<i> L_PAREN R_PAREN ARG_IMMEDIATE REG_A REG_X REG_Y COMMA INST_SEP
@@ -522,6 +522,10 @@ monitor_misc_rules: CMD_DISK rest_of_line end_cmd
                      { mon_stopwatch_reset(); }
                   | CMD_STOPWATCH end_cmd
                      { mon_stopwatch_show("Stopwatch: ", "\n"); }
+                  | CMD_HOSTTIMERS RESET end_cmd
+                     { mon_hosttimer_reset(); }
+                  | CMD_HOSTTIMERS end_cmd
+                     { mon_hosttimer_show(); }
                   ;
 
 disk_rules: CMD_LOAD filename device_num opt_address end_cmd
@@ -55,6 +55,7 @@
 #include "fullscreenarch.h"
 #endif
 
+#include "hosttimer.h"
 #include "interrupt.h"
 #include "ioutil.h"
 #include "kbdbuf.h"
@@ -1193,6 +1194,66 @@ void mon_stopwatch_reset(void)
     mon_out("Stopwatch reset to 0.\n");
 }
 
+/* Host time per frame of the subsystems since the timers were switched on
+   or reset, largest first.  */
+void mon_hosttimer_show(void)
+{
+#ifdef FEATURE_HOSTTIMERS
+    char *listed;
+    unsigned int i, n, count, best;
+    double ns, best_ns, total = 0.0;
+
+    if (!hosttimer_active) {
+        mon_out("Host timers are off, set the HostTimers resource.\n");
+        return;
+    }
+    if (hosttimer_frames() == 0) {
+        mon_out("No frame timed yet.\n");
+        return;
+    }
+
+    count = hosttimer_count();
+    listed = lib_calloc(count, 1);
+    for (i = 0; i < count; i++) {
+        total += hosttimer_ns_per_frame(i);
+    }
+
+    mon_out("Host time per frame over %lu frames: %.0f us\n",
+            hosttimer_frames(), total / 1000.0);
+
+    for (n = 0; n < count; n++) {
+        best = count;
+        best_ns = 0.5;
+        for (i = 0; i < count; i++) {
+            ns = hosttimer_ns_per_frame(i);
+            if (!listed[i] && ns >= best_ns) {
+                best = i;
+                best_ns = ns;
+            }
+        }
+        if (best == count) {
+            break;
+        }
+        listed[best] = 1;
+        mon_out("  %-24s %10.0f ns %5.1f%%\n", hosttimer_name(best), best_ns,
+                best_ns * 100.0 / total);
+    }
+    lib_free(listed);
+#else
+    mon_out("Unsupported.\n");
+#endif
+}
+
+void mon_hosttimer_reset(void)
+{
+#ifdef FEATURE_HOSTTIMERS
+    hosttimer_reset();
+    mon_out("Host timers reset.\n");
+#else
+    mon_out("Unsupported.\n");
+#endif
+}
+
 /* Local helper functions for building the lists */
 static monitor_cpu_type_t* find_monitor_cpu_type(CPU_TYPE_t cputype)
 {
@@ -2297,6 +2358,12 @@ int monitor_check_breakpoints(MEMSPACE mem, WORD addr)
     return mon_breakpoint_check_checkpoint(mem, addr, 0, e_exec); /* FIXME */
 }
 
+/* called by the memory modules when (re)building their watchpoint tables */
+int monitor_watch_page_flags(MEMSPACE mem, unsigned int page)
+{
+    return mon_breakpoint_watch_page_flags(mem, page);
+}
+
 /* called by macro DO_INTERRUPT() in 6510(dtv)core.c */
 void monitor_check_watchpoints(unsigned int lastpc, unsigned int pc)
 {
@@ -2564,6 +2631,7 @@ void monitor_startup(MEMSPACE mem)
     }
 
     monitor_open();
+    monitor_network_event_stopped(default_memspace);
     while (!exit_mon) {
         make_prompt(prompt);
         p = uimon_in(prompt);
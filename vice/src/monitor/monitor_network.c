@@ -36,6 +36,8 @@
 #include "cmdline.h"
 #include "lib.h"
 #include "log.h"
+#include "mon_breakpoint.h"
+#include "mon_register.h"
 #include "monitor.h"
 #include "monitor_network.h"
 #include "montypes.h"
@@ -56,10 +58,11 @@ static vice_network_socket_t * connected_socket = NULL;
 static char * monitor_server_address = NULL;
 static int monitor_enabled = 0;
 
-static int monitor_binary_input = 0;
+/* While a binary command is processed, text output is dropped.  */
+static int monitor_binary_quiet = 0;
 
 
-int monitor_network_transmit(const char * buffer, size_t buffer_length)
+static int monitor_network_send(const char * buffer, size_t buffer_length)
 {
     int error = 0;
 
@@ -76,6 +79,16 @@ int monitor_network_transmit(const char * buffer, size_t buffer_length)
     return error;
 }
 
+int monitor_network_transmit(const char * buffer, size_t buffer_length)
+{
+    /* no text output while processing a binary command */
+    if (monitor_binary_quiet) {
+        return (int)buffer_length;
+    }
+
+    return monitor_network_send(buffer, buffer_length);
+}
+
 static void monitor_network_quit(void)
 {
     vice_network_socket_close(connected_socket);
@@ -181,31 +194,95 @@ static char * monitor_network_extract_text_command_line(char * pbuffer, int buff
     The binary remote monitor commands are injected into the "normal" commands.
     The remote monitor detects a binary command because it starts with ASCII STX
     (0x02). After this, there is one byte telling the length of the command. The
-    next byte describes the command. Currently, only 0x01 is implemented which
-    is "memdump".
+    next byte describes the command, followed by the parameters.
 
     Note that the command length byte (the one after STX) does *not* count the
     STX, the command length nor the command byte.
 
+    If the command length byte is 0xff, it is followed by two more bytes
+    (low, high) holding the real length. This allows for commands with up to
+    65535 bytes of parameters (for example, bulk memory writes).
+
     Also note that there is no termination character. The command length acts as
     synchronisation point.
 
-    For the memdump command, the next bytes are as follows:
-    1. start address low
-    2. start address high
-    3. end address low
-    4. end address high
-    5. memspace
+    All 16 and 32 bit values are transferred low byte first.
 
-    The memspace describes which part of the computer you want to read:
+    Memspaces are given as one byte:
     0 --> the computer (C64)
     1 --> drive 8, 2 --> drive 9, 3 --> drive 10, 4 --> drive 11
 
-    So, for a memdump of 0xa0fe to 0xa123, you have to issue the bytes
-    (in this order):
+    Banks are given as one byte; 0xff means the bank currently selected in the
+    monitor. The list of banks can be queried with the "banks" command.
+
+    The following commands are implemented:
+
+    0x01: memdump
+        start address (2), end address (2), memspace (1)
+        answer: the bytes from start to end address, read without side effects
+        and from the current bank.
+
+        So, for a memdump of 0xa0fe to 0xa123, you have to issue the bytes
+        (in this order):
+
+        0x02 (STX), 0x05 (command length), 0x01 (command: memdump), 0xfe (SA low),
+        0xa0 (SA high), 0x23 (EA low), 0xa1 (EA high), 0x00 (computer memspace)
+
+    0x02: memory get
+        memspace (1), bank (1), side effects (1), start address (2), end address (2)
+        answer: the bytes from start to end address (inclusive)
+
+    0x03: memory set
+        memspace (1), bank (1), start address (2), data (command length - 4)
+        answer: empty
+
+    0x04: registers get
+        memspace (1)
+        answer: number of registers (1), then for every register:
+        id (1), size in bits (1), value (4), name length (1), name
+
+    0x05: registers set
+        memspace (1), then for every register to set: id (1), value (2)
+        answer: empty. If any id is invalid, no register is changed.
 
-    0x02 (STX), 0x05 (command length), 0x01 (command: memdump), 0xfe (SA low),
-    0xa0 (SA high), 0x23 (EA low), 0xa1 (EA high), 0x00 (computer memspace)
+    0x06: banks get
+        memspace (1)
+        answer: number of banks (1), then for every bank:
+        bank (1), name length (1), name
+
+    0x07: checkpoint set
+        memspace (1), start address (2), end address (2),
+        operation (1: 0x01 load, 0x02 store, 0x04 exec, can be combined),
+        stop (1), temporary (1)
+        answer: checkpoint number (4)
+        A temporary checkpoint leaves the monitor (like "until").
+
+    0x08: checkpoint delete
+        checkpoint number (4), 0xffffffff deletes all checkpoints
+        answer: empty
+
+    0x09: step
+        step over subroutines (1), instruction count (2)
+        answer: empty. Leaves the monitor.
+
+    0x0a: run until
+        memspace (1), address (2)
+        answer: empty. Sets a temporary exec checkpoint and leaves the monitor.
+
+    0x0b: go
+        no parameters
+        answer: empty. Leaves the monitor.
+
+    0x0c: events
+        enable (1)
+        answer: empty. Enables or disables the event notifications below.
+
+    0x0d: batch
+        any number of commands, each as: parameter length (2), command (1),
+        parameters
+        answer: the concatenated answers of all commands, each with its own
+        header (see below). Commands that leave the monitor take effect after
+        the whole batch has been processed.
 
     The answer looks as follows:
 
@@ -225,15 +302,72 @@ static char * monitor_network_extract_text_command_line(char * pbuffer, int buff
 
     If an error stats but "ok" occurs, then VICE will output more details for
     the reason into its log. [...]
+
+    While a binary command is processed, the text output of the monitor is
+    suppressed.
+
+    When enabled with the events command, VICE sends notifications at any
+    time, framed like an answer, but with an event code in the error code
+    byte:
+    0x40: checkpoint hit
+        checkpoint number (4), memspace (1), operation (1), address (2)
+    0x41: monitor entered (after a step, a stopping checkpoint, ...)
+        memspace (1), program counter (2)
 */
 
 #define ASC_STX 0x02
-#define MON_CMD_MEMDUMP 1
+#define MON_CMD_LENGTH_EXTENDED 0xff
+
+#define MON_CMD_MEMDUMP           0x01
+#define MON_CMD_MEM_GET           0x02
+#define MON_CMD_MEM_SET           0x03
+#define MON_CMD_REGISTERS_GET     0x04
+#define MON_CMD_REGISTERS_SET     0x05
+#define MON_CMD_BANKS_GET         0x06
+#define MON_CMD_CHECKPOINT_SET    0x07
+#define MON_CMD_CHECKPOINT_DELETE 0x08
+#define MON_CMD_STEP              0x09
+#define MON_CMD_RUN_UNTIL         0x0a
+#define MON_CMD_GO                0x0b
+#define MON_CMD_EVENTS            0x0c
+#define MON_CMD_BATCH             0x0d
 
 #define MON_ERR_OK            0
 #define MON_ERR_CMD_TOO_SHORT 0x80  /* command length is not enough for this command */
 #define MON_ERR_INVALID_PARAMETER 0x81  /* command has invalid parameters */
 
+#define MON_EVENT_CHECKPOINT  0x40
+#define MON_EVENT_STOPPED     0x41
+
+#define MON_BANK_CURRENT      0xff
+
+#define GET_WORD(p)  ((unsigned int)(p)[0] | ((unsigned int)(p)[1] << 8))
+#define GET_DWORD(p) (GET_WORD(p) | (GET_WORD((p) + 2) << 16))
+
+/* Send event notifications.  */
+static int monitor_binary_events = 0;
+
+/* While a batch command is processed, the answers are collected here.  */
+static unsigned char *batch_buffer = NULL;
+static unsigned int batch_length = 0;
+static unsigned int batch_size = 0;
+
+static void monitor_network_binary_output(const unsigned char *data, unsigned int length)
+{
+    if (batch_buffer != NULL) {
+        if (batch_length + length > batch_size) {
+            while (batch_length + length > batch_size) {
+                batch_size *= 2;
+            }
+            batch_buffer = lib_realloc(batch_buffer, batch_size);
+        }
+        memcpy(batch_buffer + batch_length, data, length);
+        batch_length += length;
+    } else {
+        monitor_network_send((const char *)data, length);
+    }
+}
+
 static void monitor_network_binary_answer(unsigned int length, unsigned char errorcode, unsigned char * answer)
 {
     unsigned char binlength[6];
@@ -245,10 +379,10 @@ static void monitor_network_binary_answer(unsigned int length, unsigned char err
     binlength[4] = (length >> 24) & 0xFFu;
     binlength[5] = errorcode;
 
-    monitor_network_transmit((char*)binlength, sizeof binlength);
+    monitor_network_binary_output(binlength, sizeof binlength);
 
     if (answer != NULL) {
-        monitor_network_transmit((char*)answer, length);
+        monitor_network_binary_output(answer, length);
     }
 }
 
@@ -257,64 +391,531 @@ static void monitor_network_binary_error(unsigned char errorcode)
     monitor_network_binary_answer(0, errorcode, NULL);
 }
 
-static void monitor_network_process_binary_command(unsigned char * pbuffer, int buffer_size, int * pbuffer_pos, unsigned int command_length)
+static void monitor_network_binary_ok(void)
+{
+    monitor_network_binary_answer(0, MON_ERR_OK, NULL);
+}
+
+static void put_word(unsigned char *p, unsigned int value)
+{
+    p[0] = value & 0xffu;
+    p[1] = (value >> 8) & 0xffu;
+}
+
+static void put_dword(unsigned char *p, unsigned int value)
+{
+    put_word(p, value & 0xffffu);
+    put_word(p + 2, (value >> 16) & 0xffffu);
+}
+
+static int monitor_network_binary_memspace(unsigned char value, MEMSPACE *mem)
 {
-    int command = pbuffer[2];
-    int ok = 1;
+    switch (value) {
+        case 0: *mem = e_comp_space; break;
+        case 1: *mem = e_disk8_space; break;
+        case 2: *mem = e_disk9_space; break;
+        case 3: *mem = e_disk10_space; break;
+        case 4: *mem = e_disk11_space; break;
+        default:
+            log_message(LOG_DEFAULT, "monitor_network binary command: Unknown memspace %u", value);
+            return -1;
+    }
+    return 0;
+}
+
+static int monitor_network_binary_bank(MEMSPACE mem, unsigned char value)
+{
+    return (value == MON_BANK_CURRENT) ? mon_interfaces[mem]->current_bank : value;
+}
+
+static void monitor_network_binary_memdump(unsigned char *params, unsigned int length)
+{
+    unsigned int startaddress, endaddress;
+    MEMSPACE memspace = e_default_space;
+
+    if (length < 5) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    startaddress = GET_WORD(params);
+    endaddress = GET_WORD(params + 2);
+
+    if (monitor_network_binary_memspace(params[4], &memspace) < 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    if (startaddress >= endaddress) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        log_message(LOG_DEFAULT, "monitor_network binary memdump: wrong start and/or end address %04x - %04x",
+                    startaddress, endaddress);
+        return;
+    } else {
+        unsigned int len = endaddress - startaddress + 1;
+        unsigned int i;
+
+        unsigned char * p = lib_malloc(len);
+
+        for (i = 0; i < len; i++) {
+            p[i] = mon_get_mem_val(memspace, (WORD)ADDR_LIMIT(startaddress + i));
+        }
+
+        monitor_network_binary_answer(len, MON_ERR_OK, p);
+        lib_free(p);
+    }
+}
+
+static void monitor_network_binary_mem_get(unsigned char *params, unsigned int length)
+{
+    unsigned int startaddress, endaddress, len, i;
+    MEMSPACE memspace;
+    int bank, old_sidefx;
+    unsigned char *p;
+
+    if (length < 7) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    startaddress = GET_WORD(params + 3);
+    endaddress = GET_WORD(params + 5);
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0
+        || startaddress > endaddress) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    bank = monitor_network_binary_bank(memspace, params[1]);
+    len = endaddress - startaddress + 1;
+    p = lib_malloc(len);
+
+    old_sidefx = sidefx;
+    sidefx = params[2] ? 1 : 0;
+    for (i = 0; i < len; i++) {
+        p[i] = mon_get_mem_val_ex(memspace, bank, (WORD)(startaddress + i));
+    }
+    sidefx = old_sidefx;
+
+    monitor_network_binary_answer(len, MON_ERR_OK, p);
+    lib_free(p);
+}
+
+static void monitor_network_binary_mem_set(unsigned char *params, unsigned int length)
+{
+    unsigned int startaddress, i;
+    MEMSPACE memspace;
+    int old_bank;
+
+    if (length < 5) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    startaddress = GET_WORD(params + 2);
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0
+        || startaddress + (length - 4) > 0x10000) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    old_bank = mon_interfaces[memspace]->current_bank;
+    mon_interfaces[memspace]->current_bank = monitor_network_binary_bank(memspace, params[1]);
+    for (i = 0; i < length - 4; i++) {
+        mon_set_mem_val(memspace, (WORD)(startaddress + i), params[4 + i]);
+    }
+    mon_interfaces[memspace]->current_bank = old_bank;
+
+    monitor_network_binary_ok();
+}
+
+static void monitor_network_binary_registers_get(unsigned char *params, unsigned int length)
+{
+    mon_reg_list_t *regs, *r;
+    MEMSPACE memspace;
+    unsigned int count = 0, len = 1, namelen;
+    unsigned char *answer, *p;
+
+    if (length < 1) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    regs = mon_register_list_get(memspace);
+    for (r = regs; r->name != NULL && count < 0xff; r++) {
+        len += 8 + (unsigned int)strlen(r->name);
+        count++;
+    }
+
+    answer = lib_malloc(len);
+    answer[0] = (unsigned char)count;
+    p = answer + 1;
+    for (r = regs; count > 0; r++, count--) {
+        namelen = (unsigned int)strlen(r->name);
+        p[0] = (unsigned char)r->id;
+        p[1] = (unsigned char)r->size;
+        put_dword(p + 2, r->val);
+        p[6] = (unsigned char)namelen;
+        memcpy(p + 7, r->name, namelen);
+        p += 7 + namelen;
+    }
+    lib_free(regs);
+
+    monitor_network_binary_answer(len, MON_ERR_OK, answer);
+    lib_free(answer);
+}
+
+static void monitor_network_binary_registers_set(unsigned char *params, unsigned int length)
+{
+    MEMSPACE memspace;
+    unsigned int i;
+
+    if (length < 1 || ((length - 1) % 3) != 0) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    for (i = 1; i < length; i += 3) {
+        if (!mon_register_valid(memspace, params[i])) {
+            log_message(LOG_DEFAULT, "monitor_network binary registers set: invalid register id %u", params[i]);
+            monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+            return;
+        }
+    }
+
+    for (i = 1; i < length; i += 3) {
+        (monitor_cpu_for_memspace[memspace]->mon_register_set_val)(memspace, params[i],
+                                                                   (WORD)GET_WORD(params + i + 1));
+    }
+
+    monitor_network_binary_ok();
+}
+
+static void monitor_network_binary_banks_get(unsigned char *params, unsigned int length)
+{
+    const char **banks, **b;
+    MEMSPACE memspace;
+    unsigned int count = 0, len = 1, namelen;
+    unsigned char *answer, *p;
+
+    if (length < 1) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    banks = (mon_interfaces[memspace]->mem_bank_list != NULL) ? mon_interfaces[memspace]->mem_bank_list() : NULL;
+    for (b = banks; b != NULL && *b != NULL && count < 0xff; b++) {
+        len += 2 + (unsigned int)strlen(*b);
+        count++;
+    }
 
+    answer = lib_malloc(len);
+    answer[0] = (unsigned char)count;
+    p = answer + 1;
+    for (b = banks; count > 0; b++, count--) {
+        namelen = (unsigned int)strlen(*b);
+        p[0] = (unsigned char)mon_interfaces[memspace]->mem_bank_from_name(*b);
+        p[1] = (unsigned char)namelen;
+        memcpy(p + 2, *b, namelen);
+        p += 2 + namelen;
+    }
+
+    monitor_network_binary_answer(len, MON_ERR_OK, answer);
+    lib_free(answer);
+}
+
+static void monitor_network_binary_checkpoint_set(unsigned char *params, unsigned int length)
+{
+    MEMSPACE memspace;
+    unsigned int op;
+    unsigned char answer[4];
+    int checknum;
+
+    if (length < 8) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    op = params[5] & (e_load | e_store | e_exec);
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0 || op == 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    checknum = mon_breakpoint_add_checkpoint(new_addr(memspace, GET_WORD(params + 1)),
+                                             new_addr(memspace, GET_WORD(params + 3)),
+                                             params[6] ? TRUE : FALSE, (MEMORY_OP)op,
+                                             params[7] ? TRUE : FALSE);
+
+    put_dword(answer, (unsigned int)checknum);
+    monitor_network_binary_answer(sizeof answer, MON_ERR_OK, answer);
+}
+
+static void monitor_network_binary_checkpoint_delete(unsigned char *params, unsigned int length)
+{
+    if (length < 4) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    if (GET_DWORD(params) == 0 || mon_breakpoint_delete_checkpoint((int)GET_DWORD(params)) < 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    monitor_network_binary_ok();
+}
+
+static void monitor_network_binary_step(unsigned char *params, unsigned int length)
+{
+    if (length < 3) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    if (params[0]) {
+        mon_instructions_next((int)GET_WORD(params + 1));
+    } else {
+        mon_instructions_step((int)GET_WORD(params + 1));
+    }
+
+    monitor_network_binary_ok();
+}
+
+static void monitor_network_binary_run_until(unsigned char *params, unsigned int length)
+{
+    MEMSPACE memspace;
+    MON_ADDR addr;
+
+    if (length < 3) {
+        monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
+        return;
+    }
+
+    if (monitor_network_binary_memspace(params[0], &memspace) < 0) {
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    addr = new_addr(memspace, GET_WORD(params + 1));
+    mon_breakpoint_add_checkpoint(addr, addr, TRUE, e_exec, TRUE);
+
+    monitor_network_binary_ok();
+}
+
+static void monitor_network_process_binary_command(unsigned char command, unsigned char *params, unsigned int length);
+
+static void monitor_network_binary_batch(unsigned char *params, unsigned int length)
+{
+    unsigned char *answer;
+    unsigned int pos = 0, sublength, answer_length;
+
+    if (batch_buffer != NULL) {
+        log_message(LOG_DEFAULT, "monitor_network binary batch: batches cannot be nested");
+        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
+        return;
+    }
+
+    batch_size = 256;
+    batch_length = 0;
+    batch_buffer = lib_malloc(batch_size);
+
+    while (pos + 3 <= length) {
+        sublength = GET_WORD(params + pos);
+        if (pos + 3 + sublength > length) {
+            break;
+        }
+        monitor_network_process_binary_command(params[pos + 2], params + pos + 3, sublength);
+        pos += 3 + sublength;
+    }
+
+    answer = batch_buffer;
+    answer_length = batch_length;
+    batch_buffer = NULL;
+
+    if (pos != length) {
+        log_message(LOG_DEFAULT, "monitor_network binary batch: truncated command at offset %u", pos);
+        monitor_network_binary_answer(answer_length, MON_ERR_CMD_TOO_SHORT, answer);
+    } else {
+        monitor_network_binary_answer(answer_length, MON_ERR_OK, answer);
+    }
+    lib_free(answer);
+}
+
+static void monitor_network_process_binary_command(unsigned char command, unsigned char *params, unsigned int length)
+{
     switch (command) {
         case MON_CMD_MEMDUMP:
-            if (command_length < 5) {
+            monitor_network_binary_memdump(params, length);
+            break;
+        case MON_CMD_MEM_GET:
+            monitor_network_binary_mem_get(params, length);
+            break;
+        case MON_CMD_MEM_SET:
+            monitor_network_binary_mem_set(params, length);
+            break;
+        case MON_CMD_REGISTERS_GET:
+            monitor_network_binary_registers_get(params, length);
+            break;
+        case MON_CMD_REGISTERS_SET:
+            monitor_network_binary_registers_set(params, length);
+            break;
+        case MON_CMD_BANKS_GET:
+            monitor_network_binary_banks_get(params, length);
+            break;
+        case MON_CMD_CHECKPOINT_SET:
+            monitor_network_binary_checkpoint_set(params, length);
+            break;
+        case MON_CMD_CHECKPOINT_DELETE:
+            monitor_network_binary_checkpoint_delete(params, length);
+            break;
+        case MON_CMD_STEP:
+            monitor_network_binary_step(params, length);
+            break;
+        case MON_CMD_RUN_UNTIL:
+            monitor_network_binary_run_until(params, length);
+            break;
+        case MON_CMD_GO:
+            mon_go();
+            monitor_network_binary_ok();
+            break;
+        case MON_CMD_EVENTS:
+            if (length < 1) {
                 monitor_network_binary_error(MON_ERR_CMD_TOO_SHORT);
             } else {
-                unsigned int startaddress = pbuffer[3] | (pbuffer[4] << 8);
-                unsigned int endaddress = pbuffer[5] | (pbuffer[6] << 8);
-
-                MEMSPACE memspace = e_default_space;
-
-                switch (pbuffer[7]) {
-                    case 0: memspace = e_comp_space; break;
-                    case 1: memspace = e_disk8_space; break;
-                    case 2: memspace = e_disk9_space; break;
-                    case 3: memspace = e_disk10_space; break;
-                    case 4: memspace = e_disk11_space; break;
-                    default:
-                        monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
-                        log_message(LOG_DEFAULT, "monitor_network binary memdump: Unknown memspace %u", pbuffer[7]);
-                        ok = 0;
-                }
-
-                if (startaddress >= endaddress) {
-                    monitor_network_binary_error(MON_ERR_INVALID_PARAMETER);
-                    log_message(LOG_DEFAULT, "monitor_network binary memdump: wrong start and/or end address %04x - %04x",
-                                startaddress, endaddress);
-
-                    ok = 0;
-                }
-
-                if (ok) {
-                    unsigned int length = endaddress - startaddress + 1;
-                    unsigned int i;
-
-                    unsigned char * p = lib_malloc(length);
-
-                    for (i = 0; i < length; i++) {
-                        p[i] = mon_get_mem_val(memspace, (WORD)ADDR_LIMIT(startaddress + i));
-                    }
-
-                    monitor_network_binary_answer(length, MON_ERR_OK, p);
-                    lib_free(p);
-                }
+                monitor_binary_events = params[0] ? 1 : 0;
+                monitor_network_binary_ok();
             }
             break;
+        case MON_CMD_BATCH:
+            monitor_network_binary_batch(params, length);
+            break;
 
         default:
-            log_message(LOG_DEFAULT, "monitor_network binary command: unknown command %u, skipping command length of %u", command, command_length);
+            log_message(LOG_DEFAULT, "monitor_network binary command: unknown command %u, skipping command length of %u", command, length);
             break;
     }
+}
+
+static void monitor_network_binary_event(unsigned char event, unsigned char *data, unsigned int length)
+{
+    if (!monitor_binary_events || connected_socket == NULL) {
+        return;
+    }
+    monitor_network_binary_answer(length, event, data);
+}
+
+void monitor_network_event_checkpoint(int checknum, MEMSPACE mem, unsigned int addr, unsigned int op)
+{
+    unsigned char data[8];
+
+    put_dword(data, (unsigned int)checknum);
+    data[4] = (unsigned char)(mem - e_comp_space);
+    data[5] = (unsigned char)op;
+    put_word(data + 6, addr);
+
+    monitor_network_binary_event(MON_EVENT_CHECKPOINT, data, sizeof data);
+}
+
+void monitor_network_event_stopped(MEMSPACE mem)
+{
+    unsigned char data[3];
+
+    data[0] = (unsigned char)(mem - e_comp_space);
+    put_word(data + 1, (monitor_cpu_for_memspace[mem]->mon_register_get_val)(mem, e_PC));
+
+    monitor_network_binary_event(MON_EVENT_STOPPED, data, sizeof data);
+}
+
+/* Receive until the buffer holds at least `length' bytes.  */
+static int monitor_network_receive_exact(char *buffer, int *pbuffer_pos, int length)
+{
+    int n;
+
+    while (*pbuffer_pos < length) {
+        n = monitor_network_receive(buffer + *pbuffer_pos, (size_t)(length - *pbuffer_pos));
+        if (n <= 0) {
+            return -1;
+        }
+        *pbuffer_pos += n;
+    }
+    return 0;
+}
+
+/* The buffer starts with a binary command; read the rest of it, process it
+   and remove it from the buffer.  */
+static int monitor_network_binary_input(char *buffer, int buffer_size, int *pbuffer_pos)
+{
+    unsigned int header = 2, command_length, total;
+    int pos;
+    char *command;
+
+    if (monitor_network_receive_exact(buffer, pbuffer_pos, 2) < 0) {
+        return -1;
+    }
+
+    command_length = (unsigned char)buffer[1];
+    if (command_length == MON_CMD_LENGTH_EXTENDED) {
+        if (monitor_network_receive_exact(buffer, pbuffer_pos, 4) < 0) {
+            return -1;
+        }
+        command_length = GET_WORD((unsigned char *)buffer + 2);
+        header = 4;
+    }
+
+    /* header, command byte and parameters */
+    total = header + 1 + command_length;
+
+    if (total <= (unsigned int)buffer_size) {
+        if (monitor_network_receive_exact(buffer, pbuffer_pos, (int)total) < 0) {
+            return -1;
+        }
+        command = lib_malloc(total);
+        memcpy(command, buffer, total);
 
-    *pbuffer_pos = 0;
-    pbuffer[0] = 0;
+        /* keep anything that follows the command */
+        memmove(buffer, buffer + total, *pbuffer_pos - total);
+        *pbuffer_pos -= total;
+    } else {
+        /* too large for the buffer, which only holds part of it */
+        pos = *pbuffer_pos;
+        command = lib_malloc(total);
+        memcpy(command, buffer, pos);
+        if (monitor_network_receive_exact(command, &pos, (int)total) < 0) {
+            lib_free(command);
+            return -1;
+        }
+        *pbuffer_pos = 0;
+    }
+    buffer[*pbuffer_pos] = 0;
+
+    monitor_binary_quiet = 1;
+    monitor_network_process_binary_command((unsigned char)command[header],
+                                           (unsigned char *)command + header + 1,
+                                           command_length);
+    monitor_binary_quiet = 0;
+
+    lib_free(command);
+
+    return 0;
 }
 
 
@@ -336,28 +937,19 @@ char * monitor_network_get_command_line(void)
                 monitor_network_quit();
                 break;
             }
-
-            /* check if we got a binary command */
-            if (bufferpos == n) {
-                if (buffer[0] == ASC_STX) {
-                    monitor_binary_input = 1;
-                }
-            }
+            buffer[bufferpos] = 0;
         }
 
-        if (monitor_binary_input) {
-            if (bufferpos > 2) {
-                /* we already got the length, get it */
-                unsigned int command_length = buffer[1];
-
-                if (3 + command_length <= (unsigned int)bufferpos) {
-                    monitor_network_process_binary_command((unsigned char*)buffer, sizeof buffer, &bufferpos, command_length);
-                    monitor_binary_input = 0;
-                }
-            } else {
-                bufferpos = 0;
+        /* check if we got a binary command */
+        if (buffer[0] == ASC_STX) {
+            if (monitor_network_binary_input(buffer, sizeof buffer - 1, &bufferpos) < 0) {
+                monitor_network_quit();
+                break;
+            }
+            if (exit_mon) {
+                /* the command left the monitor (step, go, ...) */
+                break;
             }
-            monitor_binary_input = 0;
         } else {
             p = monitor_network_extract_text_command_line(buffer, sizeof buffer, &bufferpos);
             if (p) {
@@ -610,6 +1202,14 @@ char * monitor_network_get_command_line(void)
     return 0;
 }
 
+void monitor_network_event_checkpoint(int checknum, MEMSPACE mem, unsigned int addr, unsigned int op)
+{
+}
+
+void monitor_network_event_stopped(MEMSPACE mem)
+{
+}
+
 int monitor_is_remote(void)
 {
     return 0;
@@ -31,6 +31,7 @@
 #ifndef VICE_MONITOR_NETWORK_H
 #define VICE_MONITOR_NETWORK_H
 
+#include "monitor.h"
 #include "types.h"
 #include "uiapi.h"
 
@@ -43,6 +44,10 @@ extern int monitor_network_receive(char * buffer, size_t buffer_length);
 extern int monitor_network_transmit(const char * buffer, size_t buffer_length);
 extern char * monitor_network_get_command_line(void);
 
+/* Event notifications for binary clients.  */
+extern void monitor_network_event_checkpoint(int checknum, MEMSPACE mem, unsigned int addr, unsigned int op);
+extern void monitor_network_event_stopped(MEMSPACE mem);
+
 extern int monitor_is_remote(void);
 
 extern ui_jam_action_t monitor_network_ui_jam_dialog(const char *format, ...);
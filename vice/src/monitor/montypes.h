@@ -335,5 +335,7 @@ extern void mon_export(void);
 
 extern void mon_stopwatch_show(const char* prefix, const char* suffix);
 extern void mon_stopwatch_reset(void);
+extern void mon_hosttimer_show(void);
+extern void mon_hosttimer_reset(void);
 
 #endif
@@ -272,17 +272,13 @@ void zero_store(WORD addr, BYTE value)
 
 /* ------------------------------------------------------------------------- */
 
+static void mem_update_tab_ptrs(void);
+
 static void mem_config_set(unsigned int config)
 {
     mem_config = config;
 
-    if (watchpoints_active) {
-        _mem_read_tab_ptr = mem_read_tab_watch;
-        _mem_write_tab_ptr = mem_write_tab_watch;
-    } else {
-        _mem_read_tab_ptr = mem_read_tab[mem_config];
-        _mem_write_tab_ptr = mem_write_tab[mem_config];
-    }
+    mem_update_tab_ptrs();
 
     _mem_read_base_tab_ptr = mem_read_base_tab[mem_config];
     mem_read_limit_tab_ptr = mem_read_limit_tab[mem_config];
@@ -329,16 +325,43 @@ static void store_watch(WORD addr, BYTE value)
     mem_write_tab[mem_config][addr >> 8](addr, value);
 }
 
-void mem_toggle_watchpoints(int flag, void *context)
+/* Only the pages that contain a watched address go through the checking
+   handlers, all other pages keep the handlers of the current config.  */
+static void mem_update_watch_tab(void)
 {
-    if (flag) {
+    int i, flags;
+
+    for (i = 0; i <= 0x100; i++) {
+        flags = monitor_watch_page_flags(e_comp_space, (unsigned int)i);
+        if (flags & MONITOR_WATCH_LOAD) {
+            mem_read_tab_watch[i] = (i == 0) ? zero_read_watch : read_watch;
+        } else {
+            mem_read_tab_watch[i] = mem_read_tab[mem_config][i];
+        }
+        if (flags & MONITOR_WATCH_STORE) {
+            mem_write_tab_watch[i] = (i == 0) ? zero_store_watch : store_watch;
+        } else {
+            mem_write_tab_watch[i] = mem_write_tab[mem_config][i];
+        }
+    }
+}
+
+static void mem_update_tab_ptrs(void)
+{
+    if (watchpoints_active) {
+        mem_update_watch_tab();
         _mem_read_tab_ptr = mem_read_tab_watch;
         _mem_write_tab_ptr = mem_write_tab_watch;
     } else {
         _mem_read_tab_ptr = mem_read_tab[mem_config];
         _mem_write_tab_ptr = mem_write_tab[mem_config];
     }
+}
+
+void mem_toggle_watchpoints(int flag, void *context)
+{
     watchpoints_active = flag;
+    mem_update_tab_ptrs();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -606,14 +629,6 @@ void mem_initialize_memory(void)
 
     mem_limit_init(mem_read_limit_tab);
 
-    /* setup watchpoint tables */
-    mem_read_tab_watch[0] = zero_read_watch;
-    mem_write_tab_watch[0] = zero_store_watch;
-    for (i = 1; i <= 0x100; i++) {
-        mem_read_tab_watch[i] = read_watch;
-        mem_write_tab_watch[i] = store_watch;
-    }
-
     /* Default is RAM.  */
     for (i = 0; i < NUM_CONFIGS; i++) {
         set_write_hook(i, 0, zero_store);
@@ -831,8 +846,7 @@ void mem_initialize_memory(void)
         hard_reset_flag = 0;
         mem_config = 1;
     }
-    _mem_read_tab_ptr = mem_read_tab[mem_config];
-    _mem_write_tab_ptr = mem_write_tab[mem_config];
+    mem_update_tab_ptrs();
     _mem_read_base_tab_ptr = mem_read_base_tab[mem_config];
     mem_read_limit_tab_ptr = mem_read_limit_tab[mem_config];
 }
@@ -38,26 +38,27 @@
 #include "viewport.h"
 
 
-inline static void refresh_canvas(raster_t *raster)
+/* Work out the part of the canvas to refresh for `area'.  Return -1 if
+   there is nothing to refresh.  */
+static int canvas_area(raster_t *raster, raster_canvas_area_t *area,
+                       int *xp, int *yp, int *xxp, int *yyp, int *wp, int *hp)
 {
-    raster_canvas_area_t *update_area;
     viewport_t *viewport;
     int x, y, xx, yy;
     int w, h;
 
-    update_area = raster->update_area;
     viewport = raster->canvas->viewport;
 
-    if (update_area->is_null) {
-        return;
+    if (area->is_null) {
+        return -1;
     }
 
-    x = update_area->xs;
-    y = update_area->ys;
-    xx = update_area->xs - viewport->first_x;
-    yy = update_area->ys - viewport->first_line;
-    w = update_area->xe - update_area->xs + 1;
-    h = update_area->ye - update_area->ys + 1;
+    x = area->xs;
+    y = area->ys;
+    xx = area->xs - viewport->first_x;
+    yy = area->ys - viewport->first_line;
+    w = area->xe - area->xs + 1;
+    h = area->ye - area->ys + 1;
 
     if (raster->canvas->videoconfig->filter == VIDEO_FILTER_CRT) {
         /* if pal emu is activated, more pixels have to be updated: around,
@@ -94,11 +95,75 @@ inline static void refresh_canvas(raster_t *raster)
     xx += viewport->x_offset;
     yy += viewport->y_offset;
 
-    if ((int)(raster->canvas->draw_buffer->canvas_height) >= yy
-        && (int)(raster->canvas->draw_buffer->canvas_width) >= xx) {
-        video_canvas_refresh(raster->canvas, x, y, xx, yy,
-                             MIN(w, (int)(raster->canvas->draw_buffer->canvas_width - xx)),
-                             MIN(h, (int)(raster->canvas->draw_buffer->canvas_height - yy)));
+    if ((int)(raster->canvas->draw_buffer->canvas_height) < yy
+        || (int)(raster->canvas->draw_buffer->canvas_width) < xx) {
+        return -1;
+    }
+
+    *xp = x;
+    *yp = y;
+    *xxp = xx;
+    *yyp = yy;
+    *wp = MIN(w, (int)(raster->canvas->draw_buffer->canvas_width - xx));
+    *hp = MIN(h, (int)(raster->canvas->draw_buffer->canvas_height - yy));
+
+    return 0;
+}
+
+inline static void refresh_canvas(raster_t *raster)
+{
+    int x, y, xx, yy;
+    int w, h;
+
+    if (canvas_area(raster, raster->update_area, &x, &y, &xx, &yy, &w, &h) == 0) {
+        video_canvas_refresh(raster->canvas, x, y, xx, yy, w, h);
+    }
+
+    raster->update_area->is_null = 1;
+}
+
+/* Convert the area to update and add it to the pending area.  */
+static void convert_canvas(raster_t *raster)
+{
+    raster_canvas_area_t *update_area, *pending_area;
+    viewport_t *viewport;
+#ifdef VIDEO_CANVAS_REFRESH_SPLIT
+    int x, y, xx, yy;
+    int w, h;
+#endif
+
+    update_area = raster->update_area;
+    pending_area = raster->pending_area;
+
+    if (raster->dont_cache) {
+        viewport = raster->canvas->viewport;
+        update_area->xs = viewport->first_x;
+        update_area->ys = viewport->first_line;
+        update_area->xe = raster->geometry->screen_size.width - 1;
+        update_area->ye = viewport->last_line;
+        update_area->is_null = 0;
+    }
+
+    if (update_area->is_null) {
+        return;
+    }
+
+#ifdef VIDEO_CANVAS_REFRESH_SPLIT
+    if (canvas_area(raster, update_area, &x, &y, &xx, &yy, &w, &h) == 0
+        && video_canvas_refresh_convert(raster->canvas, x, y, xx, yy, w, h) < 0) {
+        raster->pending_convert = 1;
+    }
+#else
+    raster->pending_convert = 1;
+#endif
+
+    if (pending_area->is_null) {
+        *pending_area = *update_area;
+    } else {
+        pending_area->xs = MIN(pending_area->xs, update_area->xs);
+        pending_area->ys = MIN(pending_area->ys, update_area->ys);
+        pending_area->xe = MAX(pending_area->xe, update_area->xe);
+        pending_area->ye = MAX(pending_area->ye, update_area->ye);
     }
 
     update_area->is_null = 1;
@@ -118,21 +183,64 @@ void raster_canvas_handle_end_of_frame(raster_t *raster)
         return;
     }
 
-    if (raster->dont_cache) {
+    if (raster->refresh_deferred) {
+        convert_canvas(raster);
+    } else if (raster->dont_cache) {
         video_canvas_refresh_all(raster->canvas);
     } else {
         refresh_canvas(raster);
     }
 }
 
+void raster_canvas_refresh_prepare(raster_t *raster)
+{
+#ifdef VIDEO_CANVAS_REFRESH_SPLIT
+    if (video_disabled_mode) {
+        return;
+    }
+
+    video_canvas_refresh_prepare(raster->canvas);
+#endif
+}
+
+void raster_canvas_refresh_pending(raster_t *raster)
+{
+    int x, y, xx, yy;
+    int w, h;
+
+    if (raster->pending_area->is_null) {
+        return;
+    }
+
+    if (canvas_area(raster, raster->pending_area, &x, &y, &xx, &yy, &w, &h) == 0) {
+#ifdef VIDEO_CANVAS_REFRESH_SPLIT
+        if (!raster->pending_convert) {
+            video_canvas_refresh_show(raster->canvas, xx, yy, w, h);
+        } else
+#endif
+        {
+            video_canvas_refresh(raster->canvas, x, y, xx, yy, w, h);
+        }
+    }
+
+    raster->pending_area->is_null = 1;
+    raster->pending_convert = 0;
+}
+
 void raster_canvas_init(raster_t *raster)
 {
     raster->update_area = lib_malloc(sizeof(raster_canvas_area_t));
 
     raster->update_area->is_null = 1;
+
+    raster->refresh_deferred = 0;
+    raster->pending_area = lib_malloc(sizeof(raster_canvas_area_t));
+    raster->pending_area->is_null = 1;
+    raster->pending_convert = 0;
 }
 
 void raster_canvas_shutdown(raster_t *raster)
 {
     lib_free(raster->update_area);
+    lib_free(raster->pending_area);
 }
@@ -45,4 +45,9 @@ extern void raster_canvas_shutdown(struct raster_s *raster);
 extern void raster_canvas_handle_end_of_frame(struct raster_s *raster);
 extern void raster_canvas_update_all(struct raster_s *raster);
 
+/* For `raster->refresh_deferred': prepare the canvas on the UI thread
+   before the end of a frame, and show what the frames converted.  */
+extern void raster_canvas_refresh_prepare(struct raster_s *raster);
+extern void raster_canvas_refresh_pending(struct raster_s *raster);
+
 #endif
@@ -165,6 +165,15 @@ struct raster_s {
     /* Area to update.  */
     struct raster_canvas_area_s *update_area;
 
+    /* If set, the end of a frame only converts the area to update into the
+       canvas image, so it can run on another thread, and adds it to
+       `pending_area'.  `raster_canvas_refresh_pending()' shows it.  */
+    int refresh_deferred;
+
+    /* Area not shown yet, and whether it has not been converted either.  */
+    struct raster_canvas_area_s *pending_area;
+    int pending_convert;
+
     /* This is a bit mask representing each pixel on the screen (1 =
        foreground, 0 = background) and is used both for sprite-background
        collision checking and background sprite drawing.  When cache is
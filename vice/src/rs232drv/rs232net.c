@@ -51,6 +51,7 @@
 
 #include "lib.h"
 #include "log.h"
+#include "maincpu.h"
 #include "rs232.h"
 #include "vicesocket.h"
 #include "types.h"
@@ -80,6 +81,16 @@ int rs232net_cmdline_options_init(void)
 
 /* ------------------------------------------------------------------------- */
 
+/* Received bytes are fetched from the socket in bulk into a buffer and
+   handed out one by one as the emulated interface asks for them, so the
+   byte timing is still given by the emulation.  The socket is polled at
+   most once every RS232NET_POLL_CYCLES cycles while that buffer is empty.
+   Sent bytes are collected and written out together when the buffer is
+   full, on the next poll or after RS232NET_POLL_CYCLES cycles.  */
+
+#define RS232NET_BUFFER_SIZE 4096
+#define RS232NET_POLL_CYCLES 1000
+
 typedef struct rs232net {
     int inuse; /*!< 0 if the connection has not been opened, 1 otherwise. */
     vice_network_socket_t * fd; /*!< the vice_network_socket_t for the connection.
@@ -87,6 +98,15 @@ typedef struct rs232net {
                     although inuse == 1, then the socket has been closed
                     because of a previous error. This prevents the error
                     log from being flooded with error messages. */
+
+    BYTE rx_buf[RS232NET_BUFFER_SIZE]; /*!< bytes received, not yet read */
+    unsigned int rx_pos;   /*!< next byte to hand out from rx_buf */
+    unsigned int rx_len;   /*!< number of valid bytes in rx_buf */
+    CLOCK rx_poll_clk;     /*!< clock of the last poll of the socket */
+
+    BYTE tx_buf[RS232NET_BUFFER_SIZE]; /*!< bytes waiting to be sent */
+    unsigned int tx_len;   /*!< number of bytes in tx_buf */
+    CLOCK tx_clk;          /*!< clock when the first byte in tx_buf was queued */
 } rs232net_t;
 
 static rs232net_t fds[RS232_NUM_DEVICES] = {{0}};
@@ -152,6 +172,9 @@ int rs232net_open(int device)
         }
 
         fds[i].inuse = 1;
+        fds[i].rx_pos = fds[i].rx_len = 0;
+        fds[i].tx_len = 0;
+        fds[i].rx_poll_clk = maincpu_clk - RS232NET_POLL_CYCLES;
 
         index = i;
 
@@ -168,6 +191,27 @@ static void rs232net_closesocket(int index)
 {
     vice_network_socket_close(fds[index].fd);
     fds[index].fd = 0;
+    fds[index].rx_pos = fds[index].rx_len = 0;
+    fds[index].tx_len = 0;
+}
+
+/* writes out the pending bytes, returns -1 on error. */
+static int rs232net_flush(int fd)
+{
+    int n;
+
+    while (fds[fd].tx_len > 0) {
+        n = vice_network_send(fds[fd].fd, fds[fd].tx_buf, fds[fd].tx_len, 0);
+        if (n <= 0) {
+            log_error(rs232net_log, "Error writing: %u.", vice_network_get_errorcode());
+            rs232net_closesocket(fd);
+            return -1;
+        }
+        fds[fd].tx_len -= n;
+        memmove(fds[fd].tx_buf, fds[fd].tx_buf + n, fds[fd].tx_len);
+    }
+
+    return 0;
 }
 
 /* closes the rs232 window again */
@@ -186,7 +230,12 @@ void rs232net_close(int fd)
             break;
         }
 
-        rs232net_closesocket(fd);
+        if (fds[fd].fd) {
+            rs232net_flush(fd);
+        }
+        if (fds[fd].fd) {
+            rs232net_closesocket(fd);
+        }
         fds[fd].inuse = 0;
 
     } while (0);
@@ -195,8 +244,6 @@ void rs232net_close(int fd)
 /* sends a byte to the RS232 line */
 int rs232net_putc(int fd, BYTE b)
 {
-    int n;
-
     if (fd < 0 || fd >= RS232_NUM_DEVICES) {
         log_error(rs232net_log, "Attempt to write to invalid fd %d.", fd);
         return -1;
@@ -214,11 +261,14 @@ int rs232net_putc(int fd, BYTE b)
     /* for the beginning... */
     DEBUG_LOG_MESSAGE((rs232net_log, "Output `%c'.", b));
 
-    n = vice_network_send(fds[fd].fd, &b, 1, 0);
-    if (n < 0) {
-        log_error(rs232net_log, "Error writing: %u.", vice_network_get_errorcode());
-        rs232net_closesocket(fd);
-        return -1;
+    if (fds[fd].tx_len == 0) {
+        fds[fd].tx_clk = maincpu_clk;
+    }
+    fds[fd].tx_buf[fds[fd].tx_len++] = b;
+
+    if (fds[fd].tx_len == RS232NET_BUFFER_SIZE
+        || maincpu_clk - fds[fd].tx_clk >= RS232NET_POLL_CYCLES) {
+        return rs232net_flush(fd);
     }
 
     return 0;
@@ -250,22 +300,46 @@ int rs232net_getc(int fd, BYTE * b)
             break;
         }
 
-        ret = vice_network_select_poll_one(fds[fd].fd);
+        if (fds[fd].rx_pos == fds[fd].rx_len) {
+            /* buffer empty; do not ask the socket again too early */
+            if (maincpu_clk - fds[fd].rx_poll_clk < RS232NET_POLL_CYCLES) {
+                break;
+            }
+            fds[fd].rx_poll_clk = maincpu_clk;
 
-        if (ret > 0) {
+            if (rs232net_flush(fd) < 0) {
+                no_of_read_byte = -1;
+                break;
+            }
 
-            no_of_read_byte = vice_network_receive(fds[fd].fd, b, 1, 0);
+            ret = vice_network_select_poll_one(fds[fd].fd);
+            if (ret <= 0) {
+                break;
+            }
 
-            if ( no_of_read_byte != 1 ) {
-                if ( no_of_read_byte < 0 ) {
+            ret = vice_network_receive(fds[fd].fd, fds[fd].rx_buf, RS232NET_BUFFER_SIZE, 0);
+            if (ret <= 0) {
+                if (ret < 0) {
                     log_error(rs232net_log, "Error reading: %u.", vice_network_get_errorcode());
                 } else {
                     log_error(rs232net_log, "EOF");
                 }
                 rs232net_closesocket(fd);
                 no_of_read_byte = -1;
+                break;
+            }
+            fds[fd].rx_pos = 0;
+            fds[fd].rx_len = (unsigned int)ret;
+        } else if (fds[fd].tx_len
+                   && maincpu_clk - fds[fd].tx_clk >= RS232NET_POLL_CYCLES) {
+            if (rs232net_flush(fd) < 0) {
+                no_of_read_byte = -1;
+                break;
             }
         }
+
+        *b = fds[fd].rx_buf[fds[fd].rx_pos++];
+        no_of_read_byte = 1;
     } while (0);
 
     return (int)no_of_read_byte;
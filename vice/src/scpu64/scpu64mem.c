@@ -192,16 +192,43 @@ static void store_watch(WORD addr, BYTE value)
     mem_write_tab[mirror][mem_config][addr >> 8](addr, value);
 }
 
-void mem_toggle_watchpoints(int flag, void *context)
+/* Only the pages that contain a watched address go through the checking
+   handlers, all other pages keep the handlers of the current config.  */
+static void mem_update_watch_tab(void)
 {
-    if (flag) {
+    int i, flags;
+
+    for (i = 0; i <= 0x100; i++) {
+        flags = monitor_watch_page_flags(e_comp_space, (unsigned int)i);
+        if (flags & MONITOR_WATCH_LOAD) {
+            mem_read_tab_watch[i] = (i == 0) ? zero_read_watch : read_watch;
+        } else {
+            mem_read_tab_watch[i] = mem_read_tab[mem_config][i];
+        }
+        if (flags & MONITOR_WATCH_STORE) {
+            mem_write_tab_watch[i] = (i == 0) ? zero_store_watch : store_watch;
+        } else {
+            mem_write_tab_watch[i] = mem_write_tab[mirror][mem_config][i];
+        }
+    }
+}
+
+static void mem_update_tab_ptrs(void)
+{
+    if (watchpoints_active) {
+        mem_update_watch_tab();
         _mem_read_tab_ptr = mem_read_tab_watch;
         _mem_write_tab_ptr = mem_write_tab_watch;
     } else {
         _mem_read_tab_ptr = mem_read_tab[mem_config];
         _mem_write_tab_ptr = mem_write_tab[mirror][mem_config];
     }
+}
+
+void mem_toggle_watchpoints(int flag, void *context)
+{
     watchpoints_active = flag;
+    mem_update_tab_ptrs();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -217,13 +244,7 @@ void mem_pla_config_changed(void)
     mem_config = ((mem_pport & 7) | (export.exrom << 3) | (export.game << 4) 
                 | (mem_reg_hwenable << 5) | (mem_reg_dosext << 6) | (mem_reg_bootmap << 7));
 
-    if (watchpoints_active) {
-        _mem_read_tab_ptr = mem_read_tab_watch;
-        _mem_write_tab_ptr = mem_write_tab_watch;
-    } else {
-        _mem_read_tab_ptr = mem_read_tab[mem_config];
-        _mem_write_tab_ptr = mem_write_tab[mirror][mem_config];
-    }
+    mem_update_tab_ptrs();
 
     _mem_read_base_tab_ptr = mem_read_base_tab[mem_config];
     mem_read_limit_tab_ptr = mem_read_limit_tab[mem_config];
@@ -1082,14 +1103,6 @@ void mem_initialize_memory(void)
     mem_color_ram_cpu = mem_color_ram;
     mem_color_ram_vicii = mem_color_ram;
 
-    /* setup watchpoint tables */
-    mem_read_tab_watch[0] = zero_read_watch;
-    mem_write_tab_watch[0] = zero_store_watch;
-    for (i = 1; i <= 0x100; i++) {
-        mem_read_tab_watch[i] = read_watch;
-        mem_write_tab_watch[i] = store_watch;
-    }
-
     /* Default is RAM.  */
     /* normal RAM maps */
     for (i = 0; i < NUM_CONFIGS - 0x20; i++) {
@@ -1256,10 +1269,7 @@ void mem_set_mirroring(int new_mirroring)
     mirror = ((new_mirroring & 0x1) ? 1 : 0) | ((new_mirroring & 0x4) ? 2 : 0)
            | ((new_mirroring & 0x40) ? 4 : 0) | ((new_mirroring & 0x80) ? 8 : 0);
 
-    /* Do not override watchpoints on vbank switches.  */
-    if (_mem_write_tab_ptr != mem_write_tab_watch) {
-        _mem_write_tab_ptr = mem_write_tab[mirror][mem_config];
-    }
+    mem_update_tab_ptrs();
 }
 
 void mem_set_simm(int config)
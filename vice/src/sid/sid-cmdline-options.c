@@ -40,6 +40,7 @@
 #include "sid.h"
 #include "sid-cmdline-options.h"
 #include "sid-resources.h"
+#include "sid-writelog.h"
 #include "translate.h"
 #include "util.h"
 
@@ -308,6 +309,11 @@ int sid_cmdline_options_init(void)
             return -1;
         }
     }
+
+    if (sid_writelog_cmdline_options_init() < 0) {
+        return -1;
+    }
+
     return cmdline_register_options(common_cmdline_options);
 }
 
@@ -0,0 +1,307 @@
+/*
+ * sid-writelog.c - Record SID register writes and render them again.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+/* A SID write log holds every write to the SID registers with the cycle it
+   happened in, so a tune can be rendered again with other SID engine,
+   model, filter or sampling settings without emulating the machine.
+
+   The log starts with a header:
+
+   offset  size  contents
+   0       14    "VICE SID Log" followed by 0x1a and 0x00
+   14      1     major version (1)
+   15      1     minor version (0)
+   16      1     number of SIDs
+   17      4     CPU cycles per second, little endian
+
+   Every write follows as the cycles since the previous one (the first one
+   starts the log) in 7 bit groups, low group first, with bit 7 set in
+   all but the last byte; a byte with the register in bits 0-4 and the SID
+   in bits 5-6; and the value.  The log ends with the cycles up to the end
+   of the recording and a byte with bit 7 set.  */
+
+#include "vice.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "archdep.h"
+#include "clkguard.h"
+#include "cmdline.h"
+#include "lib.h"
+#include "log.h"
+#include "machine.h"
+#include "maincpu.h"
+#include "resources.h"
+#include "sid-writelog.h"
+#include "sound.h"
+#include "translate.h"
+#include "types.h"
+#include "util.h"
+
+#define SID_WRITELOG_MAGIC      "VICE SID Log\032"
+#define SID_WRITELOG_MAGIC_LEN  14
+#define SID_WRITELOG_VMAJOR     1
+#define SID_WRITELOG_VMINOR     0
+#define SID_WRITELOG_HEADER_LEN 21
+
+#define SID_WRITELOG_END        0x80
+
+static log_t writelog_log = LOG_ERR;
+
+/* Log being recorded.  It is opened at the first write, when the machine
+   is running.  */
+static char *writelog_name = NULL;
+static FILE *writelog_file = NULL;
+static CLOCK writelog_clk;
+static int writelog_clk_guard = 0;
+
+/* ------------------------------------------------------------------------- */
+
+static void writelog_clk_overflow_callback(CLOCK sub, void *data)
+{
+    writelog_clk -= sub;
+}
+
+static void writelog_put_cycles(CLOCK cycles)
+{
+    while (cycles >= 0x80) {
+        fputc((int)((cycles & 0x7f) | 0x80), writelog_file);
+        cycles >>= 7;
+    }
+    fputc((int)cycles, writelog_file);
+}
+
+static int writelog_open(void)
+{
+    BYTE header[SID_WRITELOG_HEADER_LEN];
+    int sids = 0;
+    DWORD cycles;
+
+    writelog_log = log_open("SIDWriteLog");
+
+    writelog_file = fopen(writelog_name, MODE_WRITE);
+    if (writelog_file == NULL) {
+        log_error(writelog_log, "Cannot create `%s'.", writelog_name);
+        lib_free(writelog_name);
+        writelog_name = NULL;
+        return -1;
+    }
+
+    resources_get_int("SidStereo", &sids);
+    cycles = (DWORD)machine_get_cycles_per_second();
+
+    memcpy(header, SID_WRITELOG_MAGIC, SID_WRITELOG_MAGIC_LEN);
+    header[14] = SID_WRITELOG_VMAJOR;
+    header[15] = SID_WRITELOG_VMINOR;
+    header[16] = (BYTE)(sids + 1);
+    header[17] = (BYTE)(cycles & 0xff);
+    header[18] = (BYTE)((cycles >> 8) & 0xff);
+    header[19] = (BYTE)((cycles >> 16) & 0xff);
+    header[20] = (BYTE)((cycles >> 24) & 0xff);
+    fwrite(header, 1, SID_WRITELOG_HEADER_LEN, writelog_file);
+
+    writelog_clk = maincpu_clk;
+    if (!writelog_clk_guard) {
+        clk_guard_add_callback(maincpu_clk_guard, writelog_clk_overflow_callback, NULL);
+        writelog_clk_guard = 1;
+    }
+
+    log_message(writelog_log, "Recording SID writes to `%s'.", writelog_name);
+
+    return 0;
+}
+
+void sid_writelog_store(WORD addr, BYTE val, int chipno)
+{
+    if (writelog_name == NULL) {
+        return;
+    }
+    if (writelog_file == NULL && writelog_open() < 0) {
+        return;
+    }
+
+    writelog_put_cycles(maincpu_clk - writelog_clk);
+    fputc((chipno << 5) | (addr & 0x1f), writelog_file);
+    fputc(val, writelog_file);
+    writelog_clk = maincpu_clk;
+}
+
+void sid_writelog_close(void)
+{
+    if (writelog_file != NULL) {
+        writelog_put_cycles(maincpu_clk - writelog_clk);
+        fputc(SID_WRITELOG_END, writelog_file);
+        if (fclose(writelog_file) != 0) {
+            log_error(writelog_log, "Cannot write `%s'.", writelog_name);
+        }
+        writelog_file = NULL;
+    }
+
+    lib_free(writelog_name);
+    writelog_name = NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int writelog_get_cycles(FILE *f, CLOCK *cycles)
+{
+    int c, shift = 0;
+
+    *cycles = 0;
+    do {
+        c = fgetc(f);
+        if (c == EOF || shift > 28) {
+            return -1;
+        }
+        *cycles |= (CLOCK)(c & 0x7f) << shift;
+        shift += 7;
+    } while (c & 0x80);
+
+    return 0;
+}
+
+/* Play the cycles up to the next write, flushing the sound once a
+   frame.  */
+static void writelog_advance(CLOCK cycles, CLOCK *next_flush)
+{
+    CLOCK frame = (CLOCK)machine_get_cycles_per_frame();
+
+    while (cycles >= *next_flush - maincpu_clk) {
+        cycles -= *next_flush - maincpu_clk;
+        maincpu_clk = *next_flush;
+        sound_flush();
+        clk_guard_prevent_overflow(maincpu_clk_guard);
+        *next_flush = maincpu_clk + frame;
+    }
+    maincpu_clk += cycles;
+}
+
+int sid_writelog_play(const char *filename)
+{
+    FILE *f;
+    BYTE header[SID_WRITELOG_HEADER_LEN];
+    DWORD log_cycles;
+    CLOCK cycles, next_flush;
+    int sids, machine_sids = 0, reg, val;
+    unsigned long writes = 0;
+
+    writelog_log = log_open("SIDWriteLog");
+
+    f = fopen(filename, MODE_READ);
+    if (f == NULL) {
+        log_error(writelog_log, "Cannot open `%s'.", filename);
+        return -1;
+    }
+
+    if (fread(header, 1, SID_WRITELOG_HEADER_LEN, f) != SID_WRITELOG_HEADER_LEN
+        || memcmp(header, SID_WRITELOG_MAGIC, SID_WRITELOG_MAGIC_LEN) != 0) {
+        log_error(writelog_log, "`%s' is not a SID write log.", filename);
+        fclose(f);
+        return -1;
+    }
+    if (header[14] != SID_WRITELOG_VMAJOR) {
+        log_error(writelog_log, "`%s' has unsupported version %d.%d.", filename, header[14], header[15]);
+        fclose(f);
+        return -1;
+    }
+
+    sids = header[16];
+    log_cycles = (DWORD)header[17] | ((DWORD)header[18] << 8)
+                 | ((DWORD)header[19] << 16) | ((DWORD)header[20] << 24);
+
+    /* Writes to SIDs the machine cannot have are dropped.  */
+    if (sids > 0) {
+        resources_set_int("SidStereo", sids - 1);
+    }
+    resources_get_int("SidStereo", &machine_sids);
+    machine_sids++;
+    if (machine_sids < sids) {
+        log_warning(writelog_log, "Playing %d of %d SIDs.", machine_sids, sids);
+        sids = machine_sids;
+    }
+
+    if (log_cycles != (DWORD)machine_get_cycles_per_second()) {
+        log_warning(writelog_log, "Recorded at %u cycles per second, playing at %ld.",
+                    (unsigned int)log_cycles, machine_get_cycles_per_second());
+    }
+
+    /* Apply the settings before the first write.  */
+    resources_set_int("Sound", 1);
+    sound_flush();
+
+    log_message(writelog_log, "Playing `%s'.", filename);
+
+    next_flush = maincpu_clk + (CLOCK)machine_get_cycles_per_frame();
+
+    while (writelog_get_cycles(f, &cycles) == 0) {
+        writelog_advance(cycles, &next_flush);
+
+        reg = fgetc(f);
+        if (reg == EOF || (reg & SID_WRITELOG_END)) {
+            break;
+        }
+        val = fgetc(f);
+        if (val == EOF) {
+            break;
+        }
+
+        if ((reg >> 5) < sids) {
+            sound_store((WORD)(reg & 0x1f), (BYTE)val, reg >> 5);
+            writes++;
+        }
+    }
+    sound_flush();
+
+    fclose(f);
+
+    log_message(writelog_log, "%lu writes played.", writes);
+
+    return 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static int set_writelog_name(const char *param, void *extra_param)
+{
+    if (writelog_file != NULL) {
+        return -1;
+    }
+    util_string_set(&writelog_name, param);
+
+    return 0;
+}
+
+static const cmdline_option_t cmdline_options[] = {
+    { "-sidwritelog", CALL_FUNCTION, 1,
+      set_writelog_name, NULL, NULL, NULL,
+      USE_PARAM_ID, USE_DESCRIPTION_ID,
+      IDCLS_P_FILE, IDCLS_SPECIFY_SID_WRITE_LOG_FILE,
+      NULL, NULL },
+    { NULL }
+};
+
+int sid_writelog_cmdline_options_init(void)
+{
+    return cmdline_register_options(cmdline_options);
+}
@@ -0,0 +1,42 @@
+/*
+ * sid-writelog.h - Record SID register writes and render them again.
+ *
+ * This file is part of VICE, the Versatile Commodore Emulator.
+ * See README for copyright notice.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ *  02111-1307  USA.
+ *
+ */
+
+#ifndef VICE_SID_WRITELOG_H
+#define VICE_SID_WRITELOG_H
+
+#include "types.h"
+
+extern int sid_writelog_cmdline_options_init(void);
+
+/* Called for every write to a SID register, at `maincpu_clk'.  */
+extern void sid_writelog_store(WORD addr, BYTE val, int chipno);
+
+/* Ends the log, if one is being recorded.  */
+extern void sid_writelog_close(void);
+
+/* Feed the writes from a log to the SID engines at their cycles through
+   the sound devices, without running the CPU.  Returns when the log has
+   been played, -1 if it cannot be read.  */
+extern int sid_writelog_play(const char *filename);
+
+#endif
@@ -45,6 +45,7 @@
 #include "resources.h"
 #include "sid-resources.h"
 #include "sid-snapshot.h"
+#include "sid-writelog.h"
 #include "sid.h"
 #include "sound.h"
 #include "types.h"
@@ -181,10 +182,12 @@ static void sid_store_chip(WORD addr, BYTE byte, int chipno)
     if (maincpu_rmw_flag) {
         maincpu_clk--;
         sid_store_func(addr, lastsidread, chipno);
+        sid_writelog_store(addr, lastsidread, chipno);
         maincpu_clk++;
     }
 
     sid_store_func(addr, byte, chipno);
+    sid_writelog_store(addr, byte, chipno);
 }
 
 /* ------------------------------------------------------------------------- */
@@ -35,6 +35,10 @@
 #include <time.h>
 #include <assert.h>
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #ifdef HAVE_STRINGS_H
 #include <strings.h>
 #endif
@@ -44,6 +48,7 @@
 #include "cmdline.h"
 #include "debug.h"
 #include "fixpoint.h"
+#include "hosttimer.h"
 #include "lib.h"
 #include "log.h"
 #include "machine.h"
@@ -56,6 +61,7 @@
 #include "uiapi.h"
 #include "util.h"
 #include "vsync.h"
+#include "vsyncapi.h"
 #include "math.h"
 
 
@@ -257,6 +263,8 @@ static int sound_machine_calculate_samples(sound_t **psid, SWORD *pbuf, int nr,
     int i;
     int temp;
 
+    HOSTTIMER_ENTER(HOSTTIMER_SID);
+
     if (sound_calls[0]->cycle_based() || (!sound_calls[0]->cycle_based() && sound_calls[0]->chip_enabled)) {
         temp = sound_calls[0]->calculate_samples(psid, pbuf, nr, soc, scc, delta_t);
     } else {
@@ -269,6 +277,8 @@ static int sound_machine_calculate_samples(sound_t **psid, SWORD *pbuf, int nr,
             sound_calls[i]->calculate_samples(psid, pbuf, temp, soc, scc, delta_t);
         }
     }
+
+    HOSTTIMER_LEAVE();
     return temp;
 }
 
@@ -362,6 +372,10 @@ static int sdev_open = FALSE;
 int sound_state_changed;
 int sid_state_changed;
 
+/* See `sound_set_observers()'.  */
+static sound_store_observer_t store_observer = NULL;
+static sound_write_observer_t write_observer = NULL;
+
 /* Sample based or cycle based sound engine. */
 static int cycle_based = 0;
 
@@ -529,6 +543,22 @@ static int set_volume(int val, void *param)
     return 0;
 }
 
+#ifdef HAVE_PTHREAD
+/* Flag: Write to the sound device from a separate thread?  */
+static int sound_thread_enabled = 0;
+
+static int set_sound_thread_enabled(int val, void *param)
+{
+    val = val ? 1 : 0;
+
+    if (sound_thread_enabled != val) {
+        sound_thread_enabled = val;
+        sound_state_changed = TRUE;
+    }
+    return 0;
+}
+#endif
+
 static const resource_string_t resources_string[] = {
     { "SoundDeviceName", "", RES_EVENT_NO, NULL,
       &device_name, set_device_name, NULL },
@@ -558,6 +588,10 @@ static const resource_int_t resources_int[] = {
       (void *)&volume, set_volume, NULL },
     { "SoundOutput", ARCHDEP_SOUND_OUTPUT_MODE, RES_EVENT_NO, NULL,
       (void *)&output_option, set_output_option, NULL },
+#ifdef HAVE_PTHREAD
+    { "SoundThread", 0, RES_EVENT_NO, NULL,
+      (void *)&sound_thread_enabled, set_sound_thread_enabled, NULL },
+#endif
     { NULL }
 };
 
@@ -628,6 +662,18 @@ static const cmdline_option_t cmdline_options[] = {
       USE_PARAM_ID, USE_DESCRIPTION_ID,
       IDCLS_P_VOLUME, IDCLS_SOUND_VOLUME,
       NULL, NULL },
+#ifdef HAVE_PTHREAD
+    { "-soundthread", SET_RESOURCE, 0,
+      NULL, NULL, "SoundThread", (resource_value_t)1,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_ENABLE_SOUND_THREAD,
+      NULL, NULL },
+    { "+soundthread", SET_RESOURCE, 0,
+      NULL, NULL, "SoundThread", (resource_value_t)0,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_DISABLE_SOUND_THREAD,
+      NULL, NULL },
+#endif
     { NULL }
 };
 
@@ -908,6 +954,323 @@ static void fill_buffer(int size, int rise)
 }
 
 
+#ifdef HAVE_PTHREAD
+/* ------------------------------------------------------------------------- */
+
+/* Audio output thread.
+
+   With "SoundThread" enabled, sound_flush() only pushes the generated
+   samples into a single producer, single consumer ring and returns.  The
+   thread takes them out one fragment at a time and writes them to the
+   device, so the emulation never waits for it.  Because the host audio
+   clock and the emulated clock drift apart, the thread resamples by a ratio
+   close to 1 that keeps the ring at its target fill.  */
+
+/* Ring size in samples, must be a power of two.  */
+#define SOUND_RING_SIZE 0x10000
+
+/* Maximum deviation of the resampling ratio from 1.  */
+#define SOUND_RING_MAX_RATIO 0.005
+
+#define SOUND_RING_BARRIER() __sync_synchronize()
+
+static struct {
+    pthread_t thread;
+    int running;
+    volatile int quit;
+
+    /* `ring_write' is only advanced by the emulation thread, `ring_read' only by
+       the audio thread; both count samples and wrap modulo 2^32.  */
+    SWORD ring[SOUND_RING_SIZE];
+    volatile unsigned int ring_write;
+    volatile unsigned int ring_read;
+
+    int channels;
+    int fragsize;
+
+    /* Target ring fill in sample frames.  */
+    double target;
+    double avg_fill;
+    double ratio;
+
+    /* Set while waiting for the ring to reach its target fill again.  */
+    int refill;
+
+    /* Interpolation state: output lies at `pos' between `cur' and `next'.  */
+    double pos;
+    SWORD cur[SOUND_CHANNELS_MAX];
+    SWORD next[SOUND_CHANNELS_MAX];
+    SWORD *out;
+
+    volatile unsigned int underruns;
+    volatile unsigned int overruns;
+    volatile int error;
+    unsigned int underruns_logged;
+    unsigned int overruns_logged;
+} sound_thread;
+
+static inline unsigned int sound_ring_frames(void)
+{
+    return (sound_thread.ring_write - sound_thread.ring_read) / sound_thread.channels;
+}
+
+static inline void sound_ring_pop(SWORD *frame)
+{
+    unsigned int r = sound_thread.ring_read;
+    int c;
+
+    for (c = 0; c < sound_thread.channels; c++) {
+        frame[c] = sound_thread.ring[(r + c) & (SOUND_RING_SIZE - 1)];
+    }
+    SOUND_RING_BARRIER();
+    sound_thread.ring_read = r + sound_thread.channels;
+}
+
+/* Fill `out' with `frames' resampled sample frames from the ring.  */
+static void sound_thread_resample(SWORD *out, int frames)
+{
+    unsigned int avail;
+    double fill;
+    int c, i;
+
+    SOUND_RING_BARRIER();
+    avail = sound_ring_frames();
+    fill = (double)avail;
+
+    if (sound_thread.refill) {
+        if (fill < sound_thread.target) {
+            /* Still waiting for enough data, hold the last sample.  */
+            for (i = 0; i < frames; i++) {
+                for (c = 0; c < sound_thread.channels; c++) {
+                    out[i * sound_thread.channels + c] = sound_thread.cur[c];
+                }
+            }
+            return;
+        }
+        sound_thread.refill = 0;
+        sound_thread.avg_fill = fill;
+    }
+
+    /* After a pause or a burst the ring may hold far more than wanted;
+       skip ahead instead of playing the backlog late.  */
+    if (fill > 4 * sound_thread.target) {
+        unsigned int skip = avail - (unsigned int)sound_thread.target;
+
+        SOUND_RING_BARRIER();
+        sound_thread.ring_read += skip * sound_thread.channels;
+        avail -= skip;
+        fill = sound_thread.avg_fill = (double)avail;
+    }
+
+    sound_thread.avg_fill += (fill - sound_thread.avg_fill) * 0.01;
+    sound_thread.ratio = 1.0 + 0.05 * (sound_thread.avg_fill - sound_thread.target) / sound_thread.target;
+    if (sound_thread.ratio > 1.0 + SOUND_RING_MAX_RATIO) {
+        sound_thread.ratio = 1.0 + SOUND_RING_MAX_RATIO;
+    } else if (sound_thread.ratio < 1.0 - SOUND_RING_MAX_RATIO) {
+        sound_thread.ratio = 1.0 - SOUND_RING_MAX_RATIO;
+    }
+
+    for (i = 0; i < frames; i++) {
+        while (sound_thread.pos >= 1.0) {
+            if (avail == 0) {
+                break;
+            }
+            memcpy(sound_thread.cur, sound_thread.next, sizeof(sound_thread.cur));
+            sound_ring_pop(sound_thread.next);
+            avail--;
+            sound_thread.pos -= 1.0;
+        }
+        if (sound_thread.pos >= 1.0) {
+            /* Underrun: hold the last sample until the ring has refilled.  */
+            sound_thread.underruns++;
+            sound_thread.refill = 1;
+            sound_thread.pos = 1.0;
+            memcpy(sound_thread.cur, sound_thread.next, sizeof(sound_thread.cur));
+            for (; i < frames; i++) {
+                for (c = 0; c < sound_thread.channels; c++) {
+                    out[i * sound_thread.channels + c] = sound_thread.cur[c];
+                }
+            }
+            return;
+        }
+        for (c = 0; c < sound_thread.channels; c++) {
+            out[i * sound_thread.channels + c] = (SWORD)(sound_thread.cur[c]
+                + (sound_thread.next[c] - sound_thread.cur[c]) * sound_thread.pos);
+        }
+        sound_thread.pos += sound_thread.ratio;
+    }
+}
+
+static void *sound_thread_main(void *unused)
+{
+    sound_device_t *dev = snddata.playdev;
+    int frames = sound_thread.fragsize;
+    unsigned long freq = vsyncarch_frequency();
+    unsigned long frag_ticks = (unsigned long)((double)freq * frames / sample_rate);
+    unsigned long start = vsyncarch_gettime();
+    double written = 0.0;
+    int space;
+
+    while (!sound_thread.quit) {
+        if (dev->bufferspace) {
+            space = dev->bufferspace();
+            if (space < 0) {
+                sound_thread.error = 1;
+                break;
+            }
+            if (space < frames) {
+                vsyncarch_sleep(frag_ticks / 2 + 1);
+                continue;
+            }
+        } else {
+            /* The device cannot tell how much it buffers.  Blocking
+               devices pace themselves; for the others keep at most one
+               buffer ahead of the wall clock.  */
+            double played = (double)(vsyncarch_gettime() - start) * sample_rate / freq;
+
+            if (written - played > snddata.bufsize) {
+                vsyncarch_sleep(frag_ticks / 2 + 1);
+                continue;
+            }
+        }
+
+        sound_thread_resample(sound_thread.out, frames);
+        if (dev->write(sound_thread.out, frames * sound_thread.channels)) {
+            sound_thread.error = 1;
+            break;
+        }
+        written += frames;
+    }
+    return NULL;
+}
+
+static void sound_thread_start(void)
+{
+    int c;
+
+    if (!sound_thread_enabled || sound_thread.running || !snddata.playdev
+        || snddata.issuspended || snddata.playdev->flush
+        || !snddata.playdev->write) {
+        return;
+    }
+
+    sound_thread.channels = snddata.sound_output_channels;
+    sound_thread.fragsize = snddata.fragsize;
+    sound_thread.ring_write = sound_thread.ring_read = 0;
+    sound_thread.target = sample_rate / rfsh_per_sec + snddata.fragsize;
+    if (sound_thread.target * sound_thread.channels * 4 > SOUND_RING_SIZE) {
+        sound_thread.target = SOUND_RING_SIZE / (sound_thread.channels * 4);
+    }
+    sound_thread.avg_fill = sound_thread.target;
+    sound_thread.ratio = 1.0;
+    sound_thread.refill = 1;
+    sound_thread.pos = 1.0;
+    for (c = 0; c < SOUND_CHANNELS_MAX; c++) {
+        sound_thread.cur[c] = sound_thread.next[c] = snddata.lastsample[c];
+    }
+    sound_thread.out = lib_malloc(sound_thread.fragsize * sound_thread.channels * sizeof(SWORD));
+    sound_thread.underruns = sound_thread.underruns_logged = 0;
+    sound_thread.overruns = sound_thread.overruns_logged = 0;
+    sound_thread.error = 0;
+    sound_thread.quit = 0;
+
+    if (pthread_create(&sound_thread.thread, NULL, sound_thread_main, NULL) != 0) {
+        log_error(sound_log, "Cannot start audio thread, writing from the emulation thread.");
+        lib_free(sound_thread.out);
+        sound_thread.out = NULL;
+        sound_thread_enabled = 0;
+        return;
+    }
+    sound_thread.running = 1;
+    log_message(sound_log, "Audio thread started, target latency %dms.",
+                (int)(1000.0 * sound_thread.target / sample_rate));
+}
+
+static void sound_thread_stop(void)
+{
+    if (!sound_thread.running) {
+        return;
+    }
+
+    sound_thread.quit = 1;
+    pthread_join(sound_thread.thread, NULL);
+    sound_thread.running = 0;
+
+    lib_free(sound_thread.out);
+    sound_thread.out = NULL;
+
+    if (sound_thread.underruns || sound_thread.overruns) {
+        log_message(sound_log, "Audio thread stopped, %u underruns, %u overruns.",
+                    sound_thread.underruns, sound_thread.overruns);
+    }
+}
+
+/* Hand the generated samples over to the audio thread.  */
+static int sound_thread_flush(void)
+{
+    int c, nr = snddata.bufptr;
+    unsigned int samples, space, w, i;
+
+    if (sound_thread.error) {
+        sound_error(translate_text(IDGS_WRITE_TO_SOUND_DEVICE_FAILED));
+        return 0;
+    }
+
+    if (!nr) {
+        return 0;
+    }
+
+    samples = nr * sound_thread.channels;
+    space = SOUND_RING_SIZE - (sound_thread.ring_write - sound_thread.ring_read);
+    if (samples > space) {
+        samples = space - space % sound_thread.channels;
+        sound_thread.overruns++;
+    }
+
+    w = sound_thread.ring_write;
+    for (i = 0; i < samples; i++) {
+        sound_thread.ring[(w + i) & (SOUND_RING_SIZE - 1)] = snddata.buffer[i];
+    }
+    SOUND_RING_BARRIER();
+    sound_thread.ring_write = w + samples;
+
+    if (snddata.recdev) {
+        if (snddata.recdev->write(snddata.buffer, nr * snddata.sound_output_channels)) {
+            sound_error(translate_text(IDGS_WRITE_TO_SOUND_DEVICE_FAILED));
+            return 0;
+        }
+    }
+
+    if (write_observer != NULL) {
+        write_observer(snddata.buffer, nr * snddata.sound_output_channels, snddata.sound_output_channels);
+    }
+
+    if (speed_percent > 0) {
+        snddata.clkfactor = SOUNDCLK_CONSTANT(speed_percent) / 100;
+        snddata.clkstep = SOUNDCLK_MULT(snddata.origclkstep, snddata.clkfactor);
+    }
+
+    for (c = 0; c < snddata.sound_output_channels; c++) {
+        snddata.lastsample[c] = snddata.buffer[(nr - 1) * snddata.sound_output_channels + c];
+    }
+    snddata.bufptr = 0;
+
+    /* The audio thread must not log, report for it here.  */
+    if (sound_thread.underruns != sound_thread.underruns_logged
+        && sound_thread.underruns_logged < 25) {
+        log_warning(sound_log, "Audio thread ran out of samples");
+        sound_thread.underruns_logged = sound_thread.underruns;
+    }
+    if (sound_thread.overruns != sound_thread.overruns_logged
+        && sound_thread.overruns_logged < 25) {
+        log_warning(sound_log, "Audio ring full, samples dropped");
+        sound_thread.overruns_logged = sound_thread.overruns;
+    }
+
+    return 0;
+}
+#endif
+
 /* open SID engine */
 static int sid_open(void)
 {
@@ -1069,6 +1432,9 @@ int sound_open(void)
     }
 
     if (pdev) {
+        /* Devices without an init function, like "dummy", take what they
+           are given.  */
+        snddata.sound_output_channels = channels;
         if (pdev->init) {
             channels_cap = channels;
             if (pdev->init(playparam, &speed, &fragsize, &fragnr, &channels_cap)) {
@@ -1082,8 +1448,6 @@ int sound_open(void)
                     log_warning(sound_log, "sound device lacks stereo capability, switching to mono output");
                 }
                 snddata.sound_output_channels = 1;
-            } else {
-                snddata.sound_output_channels = channels;
             }
         }
         snddata.issuspended = 0;
@@ -1134,6 +1498,10 @@ int sound_open(void)
     sdev_open = TRUE;
     sound_state_changed = FALSE;
 
+#ifdef HAVE_PTHREAD
+    sound_thread_start();
+#endif
+
     for (i = 0; (rdev = sound_devices[i]); i++) {
         if (recname && rdev->name && !strcasecmp(recname, rdev->name)) {
             break;
@@ -1182,6 +1550,10 @@ int sound_open(void)
 /* close sid */
 void sound_close(void)
 {
+#ifdef HAVE_PTHREAD
+    sound_thread_stop();
+#endif
+
     if (snddata.playdev) {
         log_message(sound_log, "Closing device `%s'", snddata.playdev->name);
         if (snddata.playdev->close) {
@@ -1370,11 +1742,22 @@ double sound_flush()
     }
 
     if (warp_mode_enabled && snddata.recdev == NULL) {
+        /* Nothing is played in warp mode, but the observers still get
+           the samples.  */
+        if (write_observer != NULL && snddata.bufptr > 0) {
+            write_observer(snddata.buffer, snddata.bufptr * snddata.sound_output_channels, snddata.sound_output_channels);
+        }
         snddata.bufptr = 0;
         return 0;
     }
     sound_resume();
 
+#ifdef HAVE_PTHREAD
+    if (sound_thread.running) {
+        return sound_thread_flush();
+    }
+#endif
+
     if (snddata.playdev->flush) {
         state = sound_machine_dump_state(snddata.psid[0]);
         i = snddata.playdev->flush(state);
@@ -1494,6 +1877,10 @@ double sound_flush()
                 return 0;
             }
         }
+
+        if (write_observer != NULL) {
+            write_observer(snddata.buffer, nr * snddata.sound_output_channels, snddata.sound_output_channels);
+        }
     }
 
     /* "No Limit" speed support: nuke the accumulated buffer. */
@@ -1555,6 +1942,10 @@ void sound_suspend(void)
         return;
     }
 
+#ifdef HAVE_PTHREAD
+    sound_thread_stop();
+#endif
+
     if (snddata.playdev->write && !snddata.issuspended
         && snddata.playdev->need_attenuation) {
         fill_buffer(snddata.fragsize, -1);
@@ -1586,6 +1977,10 @@ void sound_resume(void)
             fill_buffer(snddata.fragsize, 1);
         }
     }
+
+#ifdef HAVE_PTHREAD
+    sound_thread_start();
+#endif
 }
 
 /* set PAL/NTSC clock speed */
@@ -1664,6 +2059,10 @@ void sound_store(WORD addr, BYTE val, int chipno)
 
     sound_machine_store(snddata.psid[chipno], addr, val);
 
+    if (store_observer != NULL) {
+        store_observer(addr, val, chipno);
+    }
+
     if (!snddata.playdev->dump) {
         return;
     }
@@ -1759,6 +2158,12 @@ int sound_dac_calculate_samples(sound_dac_t *dac, SWORD *pbuf, int value, int nr
     return nr;
 }
 
+void sound_set_observers(sound_store_observer_t store, sound_write_observer_t write)
+{
+    store_observer = store;
+    write_observer = write;
+}
+
 /* recording related functions, equivalent to screenshot_... */
 void sound_stop_recording(void)
 {
@@ -226,6 +226,13 @@ extern int sound_read(WORD addr, int chipno);
 extern void sound_store(WORD addr, BYTE val, int chipno);
 extern long sound_sample_position(void);
 
+/* Observers of every SID write and every block of samples generated,
+   also in warp mode when nothing is played, e.g. to detect the end of a
+   tune.  NULL removes them.  */
+typedef void (*sound_store_observer_t)(WORD addr, BYTE val, int chipno);
+typedef void (*sound_write_observer_t)(const SWORD *pbuf, size_t nr, int channels);
+extern void sound_set_observers(sound_store_observer_t store, sound_write_observer_t write);
+
 /* functions and structs implemented by each machine */
 typedef struct sound_s sound_t;
 extern char *sound_machine_dump_state(sound_t *psid);
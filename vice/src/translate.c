@@ -62,16 +62,50 @@ int current_language_index = 0;
 
 /* --------------------------------------------------------------------- */
 
-static char *get_string_by_id(int id)
+/* The IDs are consecutive from ID_START_65536, so the string table and the
+   translation table are indexed by `id - ID_START_65536'.  */
+static int *string_index = NULL;
+static int string_index_size = 0;
+
+static void string_index_init(void)
 {
     unsigned int k;
+    int i;
 
+    string_index_size = 0;
     for (k = 0; k < countof(string_table); k++) {
-        if (string_table[k].resource_id == id) {
-            return string_table[k].text;
+        if (string_table[k].resource_id - ID_START_65536 >= string_index_size) {
+            string_index_size = string_table[k].resource_id - ID_START_65536 + 1;
+        }
+    }
+
+    string_index = lib_malloc(string_index_size * sizeof(int));
+    for (i = 0; i < string_index_size; i++) {
+        string_index[i] = -1;
+    }
+
+    /* Go backwards so the first entry wins, like the old linear search.  */
+    for (k = countof(string_table); k-- > 0;) {
+        i = string_table[k].resource_id - ID_START_65536;
+        if (i >= 0) {
+            string_index[i] = (int)k;
         }
     }
-    return NULL;
+}
+
+static char *get_string_by_id(int id)
+{
+    int i;
+
+    if (string_index == NULL) {
+        string_index_init();
+    }
+
+    i = id - ID_START_65536;
+    if (i < 0 || i >= string_index_size || string_index[i] < 0) {
+        return NULL;
+    }
+    return string_table[string_index[i]].text;
 }
 
 static char *sid_return = NULL;
@@ -150,9 +184,14 @@ static char *translate_and_build_sid_cmdline_option(int en_resource)
 
 static char *text_table[countof(translate_text_table)][countof(language_table)];
 
+/* Row of `translate_text_table' for each english ID.  */
+static int *text_index = NULL;
+static int text_index_size = 0;
+
 static void translate_text_init(void)
 {
     unsigned int i, j;
+    int k;
     char *temp;
 
     for (i = 0; i < countof(language_table); i++) {
@@ -165,6 +204,26 @@ static void translate_text_init(void)
             }
         }
     }
+
+    text_index_size = 0;
+    for (j = 0; j < countof(translate_text_table); j++) {
+        if (translate_text_table[j][0] - ID_START_65536 >= text_index_size) {
+            text_index_size = translate_text_table[j][0] - ID_START_65536 + 1;
+        }
+    }
+
+    text_index = lib_malloc(text_index_size * sizeof(int));
+    for (k = 0; k < text_index_size; k++) {
+        text_index[k] = -1;
+    }
+
+    /* The last row wins, like the old linear search.  */
+    for (j = 0; j < countof(translate_text_table); j++) {
+        k = translate_text_table[j][0] - ID_START_65536;
+        if (k >= 0) {
+            text_index[k] = (int)j;
+        }
+    }
 }
 
 char translate_id_error_text[30];
@@ -192,17 +251,15 @@ char *translate_text(int en_resource)
 
     if (en_resource < 0x10000) {
         retval = intl_translate_text(en_resource);
-    } else {
-        for (i = 0; i < countof(translate_text_table); i++) {
-            if (translate_text_table[i][0] == en_resource) {
-                if (translate_text_table[i][current_language_index] != 0 &&
-                    text_table[i][current_language_index] != NULL &&
-                    strlen(text_table[i][current_language_index]) != 0) {
-                    retval = text_table[i][current_language_index];
-                } else {
-                    retval = text_table[i][0];
-                }
-            }
+    } else if (en_resource - ID_START_65536 < text_index_size
+               && text_index[en_resource - ID_START_65536] >= 0) {
+        i = (unsigned int)text_index[en_resource - ID_START_65536];
+        if (translate_text_table[i][current_language_index] != 0 &&
+            text_table[i][current_language_index] != NULL &&
+            strlen(text_table[i][current_language_index]) != 0) {
+            retval = text_table[i][current_language_index];
+        } else {
+            retval = text_table[i][0];
         }
     }
 
@@ -270,6 +327,13 @@ void translate_resources_shutdown(void)
             lib_free(text_table[j][i]);
         }
     }
+    lib_free(text_index);
+    text_index = NULL;
+    text_index_size = 0;
+    lib_free(string_index);
+    string_index = NULL;
+    string_index_size = 0;
+
     intl_shutdown();
     lib_free(current_language);
 
@@ -1286,6 +1286,23 @@ translate_t string_table[] = {
 /* tr */ {IDGS_MON_GOTO_DESCRIPTION_TR, "PC'yi ADDRESS'e evirip altrmaya devam edin"},
 #endif
 
+/* monitor/mon_command.c */
+/* en */ {IDGS_MON_HOSTTIMERS_DESCRIPTION,    N_("Print the host time per frame spent in each emulator subsystem, largest first. 'reset' clears the timers.")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_DA, ""},  /* fuzzy */
+/* de */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_DE, ""},  /* fuzzy */
+/* es */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_ES, ""},  /* fuzzy */
+/* fr */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_FR, ""},  /* fuzzy */
+/* hu */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_HU, ""},  /* fuzzy */
+/* it */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_IT, ""},  /* fuzzy */
+/* ko */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_KO, ""},  /* fuzzy */
+/* nl */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_NL, ""},  /* fuzzy */
+/* pl */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_PL, ""},  /* fuzzy */
+/* ru */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_RU, ""},  /* fuzzy */
+/* sv */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_SV, ""},  /* fuzzy */
+/* tr */ {IDGS_MON_HOSTTIMERS_DESCRIPTION_TR, ""},  /* fuzzy */
+#endif
+
 /* monitor/mon_command.c */
 /* en */ {IDGS_MON_IO_DESCRIPTION,    N_("Print out the I/O area of the emulated machine.")},
 #ifdef HAS_TRANSLATION
@@ -11331,6 +11348,42 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_SET_VIDEO_STREAM_BITRATE_TR, "Grnt ak iin ortam dosyasndaki bithz'n ayarla"},
 #endif
 
+#ifdef HAVE_SHM_OPEN
+/* gfxoutputdrv/shmdrv.c */
+/* en */ {IDCLS_SET_SHM_VIDEO_FRAMES,    N_("Set number of frame slots in the shared memory stream")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_SHM_VIDEO_FRAMES_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_SHM_VIDEO_FRAMES_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_SHM_VIDEO_FRAMES_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_SHM_VIDEO_FRAMES_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_SHM_VIDEO_FRAMES_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_SHM_VIDEO_FRAMES_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_SHM_VIDEO_FRAMES_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_SHM_VIDEO_FRAMES_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_SHM_VIDEO_FRAMES_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_SHM_VIDEO_FRAMES_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_SHM_VIDEO_FRAMES_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_SHM_VIDEO_FRAMES_TR, ""},  /* fuzzy */
+#endif
+
+/* gfxoutputdrv/shmdrv.c */
+/* en */ {IDCLS_SET_SHM_AUDIO_BUFFER,    N_("Set size of the shared memory audio buffer in milliseconds")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_SHM_AUDIO_BUFFER_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_SHM_AUDIO_BUFFER_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_SHM_AUDIO_BUFFER_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_SHM_AUDIO_BUFFER_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_SHM_AUDIO_BUFFER_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_SHM_AUDIO_BUFFER_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_SHM_AUDIO_BUFFER_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_SHM_AUDIO_BUFFER_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_SHM_AUDIO_BUFFER_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_SHM_AUDIO_BUFFER_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_SHM_AUDIO_BUFFER_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_SHM_AUDIO_BUFFER_TR, ""},  /* fuzzy */
+#endif
+#endif
+
 /* pet/pet-cmdline-options.c */
 /* en */ {IDCLS_SPECIFY_PET_MODEL,    N_("Specify PET model to emulate. (2001/3008/3016/3032/3032B/4016/4032/4032B/8032/8096/8296/SuperPET)")},
 #ifdef HAS_TRANSLATION
@@ -13623,6 +13676,42 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_SET_VDC_REVISION_TR, "VDC revizyonunu ayarla (0..2)"},
 #endif
 
+#ifdef HAVE_PTHREAD
+/* vdc/vdc-cmdline-options.c */
+/* en */ {IDCLS_ENABLE_VDC_RENDER_THREAD,    N_("Draw VDC raster lines in a separate thread")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_ENABLE_VDC_RENDER_THREAD_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_ENABLE_VDC_RENDER_THREAD_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_ENABLE_VDC_RENDER_THREAD_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_ENABLE_VDC_RENDER_THREAD_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_ENABLE_VDC_RENDER_THREAD_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_ENABLE_VDC_RENDER_THREAD_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_ENABLE_VDC_RENDER_THREAD_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_ENABLE_VDC_RENDER_THREAD_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_ENABLE_VDC_RENDER_THREAD_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_ENABLE_VDC_RENDER_THREAD_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_ENABLE_VDC_RENDER_THREAD_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_ENABLE_VDC_RENDER_THREAD_TR, ""},  /* fuzzy */
+#endif
+
+/* vdc/vdc-cmdline-options.c */
+/* en */ {IDCLS_DISABLE_VDC_RENDER_THREAD,    N_("Draw VDC raster lines in the emulation thread")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_DISABLE_VDC_RENDER_THREAD_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_DISABLE_VDC_RENDER_THREAD_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_DISABLE_VDC_RENDER_THREAD_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_DISABLE_VDC_RENDER_THREAD_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_DISABLE_VDC_RENDER_THREAD_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_DISABLE_VDC_RENDER_THREAD_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_DISABLE_VDC_RENDER_THREAD_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_DISABLE_VDC_RENDER_THREAD_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_DISABLE_VDC_RENDER_THREAD_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_DISABLE_VDC_RENDER_THREAD_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_DISABLE_VDC_RENDER_THREAD_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_DISABLE_VDC_RENDER_THREAD_TR, ""},  /* fuzzy */
+#endif
+#endif
+
 /* vic20/vic20-cmdline-options.c */
 /* en */ {IDCLS_P_SPEC,    N_("<spec>")},
 #ifdef HAS_TRANSLATION
@@ -15241,6 +15330,40 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_DISABLE_EVENT_IMAGE_INCLUDE_TR, ""},  /* fuzzy */
 #endif
 
+/* event.c */
+/* en */ {IDCLS_ENABLE_EVENT_STATE_HASH,    N_("Record per-frame machine state hashes into event histories")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_ENABLE_EVENT_STATE_HASH_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_ENABLE_EVENT_STATE_HASH_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_ENABLE_EVENT_STATE_HASH_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_ENABLE_EVENT_STATE_HASH_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_ENABLE_EVENT_STATE_HASH_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_ENABLE_EVENT_STATE_HASH_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_ENABLE_EVENT_STATE_HASH_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_ENABLE_EVENT_STATE_HASH_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_ENABLE_EVENT_STATE_HASH_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_ENABLE_EVENT_STATE_HASH_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_ENABLE_EVENT_STATE_HASH_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_ENABLE_EVENT_STATE_HASH_TR, ""},  /* fuzzy */
+#endif
+
+/* event.c */
+/* en */ {IDCLS_DISABLE_EVENT_STATE_HASH,    N_("Do not record per-frame machine state hashes into event histories")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_DISABLE_EVENT_STATE_HASH_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_DISABLE_EVENT_STATE_HASH_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_DISABLE_EVENT_STATE_HASH_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_DISABLE_EVENT_STATE_HASH_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_DISABLE_EVENT_STATE_HASH_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_DISABLE_EVENT_STATE_HASH_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_DISABLE_EVENT_STATE_HASH_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_DISABLE_EVENT_STATE_HASH_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_DISABLE_EVENT_STATE_HASH_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_DISABLE_EVENT_STATE_HASH_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_DISABLE_EVENT_STATE_HASH_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_DISABLE_EVENT_STATE_HASH_TR, ""},  /* fuzzy */
+#endif
+
 /* monitor.c */
 /* en */ {IDCLS_EXECUTE_MONITOR_FROM_FILE,    N_("Execute monitor commands from file")},
 #ifdef HAS_TRANSLATION
@@ -15585,6 +15708,263 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_SPECIFY_DUMPCONFIG_FILE_TR, ""},  /* fuzzy */
 #endif
 
+/* benchmark.c */
+/* en */ {IDCLS_SPECIFY_BENCHMARK_FILE,    N_("Append a benchmark report to the specified file (\"-\" for stdout)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_BENCHMARK_FILE_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_BENCHMARK_FILE_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_BENCHMARK_FILE_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_BENCHMARK_FILE_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_BENCHMARK_FILE_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_BENCHMARK_FILE_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_BENCHMARK_FILE_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_BENCHMARK_FILE_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_BENCHMARK_FILE_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_BENCHMARK_FILE_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_BENCHMARK_FILE_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_BENCHMARK_FILE_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SPECIFY_BATCH_LIST_FILE,    N_("Render all tunes of the SID files listed in the specified file, one per line")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_BATCH_LIST_FILE_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_BATCH_LIST_FILE_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_BATCH_LIST_FILE_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_BATCH_LIST_FILE_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_BATCH_LIST_FILE_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_BATCH_LIST_FILE_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_BATCH_LIST_FILE_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_BATCH_LIST_FILE_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_BATCH_LIST_FILE_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_BATCH_LIST_FILE_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_BATCH_LIST_FILE_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_BATCH_LIST_FILE_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR,    N_("Directory for the batch renders (default: current directory)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_BATCH_OUTPUT_DIR_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE,    N_("Sound record driver for the batch renders (default: wav)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_BATCH_RECORD_DEVICE_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SET_BATCH_TIME,    N_("Render every tune for at most <number> seconds (default: 180)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_BATCH_TIME_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_BATCH_TIME_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_BATCH_TIME_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_BATCH_TIME_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_BATCH_TIME_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_BATCH_TIME_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_BATCH_TIME_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_BATCH_TIME_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_BATCH_TIME_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_BATCH_TIME_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_BATCH_TIME_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_BATCH_TIME_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SPECIFY_BATCH_REPORT_FILE,    N_("Append the length and end of every render to <file>")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_BATCH_REPORT_FILE_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SET_BATCH_JOBS,    N_("Number of worker processes for the batch renders (default: 1)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_BATCH_JOBS_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_BATCH_JOBS_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_BATCH_JOBS_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_BATCH_JOBS_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_BATCH_JOBS_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_BATCH_JOBS_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_BATCH_JOBS_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_BATCH_JOBS_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_BATCH_JOBS_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_BATCH_JOBS_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_BATCH_JOBS_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_BATCH_JOBS_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidend.c */
+/* en */ {IDCLS_SET_PSID_SILENCE_END,    N_("End a tune after <number> seconds of silence (0: never)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_PSID_SILENCE_END_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_PSID_SILENCE_END_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_PSID_SILENCE_END_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_PSID_SILENCE_END_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_PSID_SILENCE_END_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_PSID_SILENCE_END_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_PSID_SILENCE_END_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_PSID_SILENCE_END_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_PSID_SILENCE_END_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_PSID_SILENCE_END_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_PSID_SILENCE_END_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_PSID_SILENCE_END_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidend.c */
+/* en */ {IDCLS_ENABLE_PSID_LOOP_END,    N_("End a tune when it starts to loop")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_ENABLE_PSID_LOOP_END_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_ENABLE_PSID_LOOP_END_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_ENABLE_PSID_LOOP_END_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_ENABLE_PSID_LOOP_END_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_ENABLE_PSID_LOOP_END_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_ENABLE_PSID_LOOP_END_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_ENABLE_PSID_LOOP_END_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_ENABLE_PSID_LOOP_END_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_ENABLE_PSID_LOOP_END_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_ENABLE_PSID_LOOP_END_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_ENABLE_PSID_LOOP_END_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_ENABLE_PSID_LOOP_END_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidend.c */
+/* en */ {IDCLS_DISABLE_PSID_LOOP_END,    N_("Do not end a tune when it starts to loop")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_DISABLE_PSID_LOOP_END_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_DISABLE_PSID_LOOP_END_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_DISABLE_PSID_LOOP_END_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_DISABLE_PSID_LOOP_END_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_DISABLE_PSID_LOOP_END_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_DISABLE_PSID_LOOP_END_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_DISABLE_PSID_LOOP_END_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_DISABLE_PSID_LOOP_END_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_DISABLE_PSID_LOOP_END_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_DISABLE_PSID_LOOP_END_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_DISABLE_PSID_LOOP_END_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_DISABLE_PSID_LOOP_END_TR, ""},  /* fuzzy */
+#endif
+
+/* sid/sid-writelog.c */
+/* en */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE,    N_("Record all SID register writes with their cycles to <file>")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_SID_WRITE_LOG_FILE_TR, ""},  /* fuzzy */
+#endif
+
+/* c64/vsidbatch.c */
+/* en */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE,    N_("Render the SID write log <file> through the sound devices and exit")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SPECIFY_SID_WRITE_LOG_PLAY_FILE_TR, ""},  /* fuzzy */
+#endif
+
+#ifdef FEATURE_HOSTTIMERS
+/* hosttimer.c */
+/* en */ {IDCLS_ENABLE_HOST_TIMERS,    N_("Measure the host time spent in the emulator subsystems")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_ENABLE_HOST_TIMERS_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_ENABLE_HOST_TIMERS_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_ENABLE_HOST_TIMERS_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_ENABLE_HOST_TIMERS_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_ENABLE_HOST_TIMERS_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_ENABLE_HOST_TIMERS_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_ENABLE_HOST_TIMERS_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_ENABLE_HOST_TIMERS_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_ENABLE_HOST_TIMERS_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_ENABLE_HOST_TIMERS_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_ENABLE_HOST_TIMERS_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_ENABLE_HOST_TIMERS_TR, ""},  /* fuzzy */
+#endif
+
+/* hosttimer.c */
+/* en */ {IDCLS_DISABLE_HOST_TIMERS,    N_("Do not measure the host time spent in the emulator subsystems")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_DISABLE_HOST_TIMERS_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_DISABLE_HOST_TIMERS_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_DISABLE_HOST_TIMERS_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_DISABLE_HOST_TIMERS_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_DISABLE_HOST_TIMERS_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_DISABLE_HOST_TIMERS_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_DISABLE_HOST_TIMERS_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_DISABLE_HOST_TIMERS_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_DISABLE_HOST_TIMERS_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_DISABLE_HOST_TIMERS_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_DISABLE_HOST_TIMERS_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_DISABLE_HOST_TIMERS_TR, ""},  /* fuzzy */
+#endif
+
+/* hosttimer.c */
+/* en */ {IDCLS_SET_HOST_TIMERS_INTERVAL,    N_("Frames between the host time reports (0: never)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_HOST_TIMERS_INTERVAL_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_HOST_TIMERS_INTERVAL_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_HOST_TIMERS_INTERVAL_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_HOST_TIMERS_INTERVAL_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_HOST_TIMERS_INTERVAL_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_HOST_TIMERS_INTERVAL_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_HOST_TIMERS_INTERVAL_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_HOST_TIMERS_INTERVAL_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_HOST_TIMERS_INTERVAL_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_HOST_TIMERS_INTERVAL_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_HOST_TIMERS_INTERVAL_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_HOST_TIMERS_INTERVAL_TR, ""},  /* fuzzy */
+#endif
+#endif
+
 /* initcmdline.c */
 /* en */ {IDCLS_LIMIT_CYCLES,    N_("Specify number of cycles to run before quitting with an error.")},
 #ifdef HAS_TRANSLATION
@@ -15602,6 +15982,23 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_LIMIT_CYCLES_TR, ""},  /* fuzzy */
 #endif
 
+/* initcmdline.c */
+/* en */ {IDCLS_LOG_STARTUP_TIME,    N_("Log how long each phase of the startup takes")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_LOG_STARTUP_TIME_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_LOG_STARTUP_TIME_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_LOG_STARTUP_TIME_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_LOG_STARTUP_TIME_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_LOG_STARTUP_TIME_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_LOG_STARTUP_TIME_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_LOG_STARTUP_TIME_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_LOG_STARTUP_TIME_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_LOG_STARTUP_TIME_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_LOG_STARTUP_TIME_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_LOG_STARTUP_TIME_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_LOG_STARTUP_TIME_TR, ""},  /* fuzzy */
+#endif
+
 /* initcmdline.c */
 /* en */ {IDCLS_ATTACH_AND_AUTOSTART,    N_("Attach and autostart tape/disk image <name>")},
 #ifdef HAS_TRANSLATION
@@ -15806,6 +16203,59 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_ENABLE_VERBOSE_LOG_OUTPUT_TR, "Verbose log ktsn aktif et."},
 #endif
 
+#ifdef HAVE_PTHREAD
+/* log.c */
+/* en */ {IDCLS_ENABLE_LOG_THREAD,    N_("Write log messages from a separate thread")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_ENABLE_LOG_THREAD_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_ENABLE_LOG_THREAD_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_ENABLE_LOG_THREAD_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_ENABLE_LOG_THREAD_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_ENABLE_LOG_THREAD_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_ENABLE_LOG_THREAD_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_ENABLE_LOG_THREAD_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_ENABLE_LOG_THREAD_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_ENABLE_LOG_THREAD_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_ENABLE_LOG_THREAD_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_ENABLE_LOG_THREAD_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_ENABLE_LOG_THREAD_TR, ""},  /* fuzzy */
+#endif
+
+/* log.c */
+/* en */ {IDCLS_DISABLE_LOG_THREAD,    N_("Write log messages directly")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_DISABLE_LOG_THREAD_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_DISABLE_LOG_THREAD_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_DISABLE_LOG_THREAD_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_DISABLE_LOG_THREAD_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_DISABLE_LOG_THREAD_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_DISABLE_LOG_THREAD_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_DISABLE_LOG_THREAD_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_DISABLE_LOG_THREAD_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_DISABLE_LOG_THREAD_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_DISABLE_LOG_THREAD_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_DISABLE_LOG_THREAD_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_DISABLE_LOG_THREAD_TR, ""},  /* fuzzy */
+#endif
+#endif
+
+/* log.c */
+/* en */ {IDCLS_SET_LOG_RATE_LIMIT,    N_("Set the maximum number of messages per second for each log (0: no limit)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_LOG_RATE_LIMIT_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_LOG_RATE_LIMIT_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_LOG_RATE_LIMIT_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_LOG_RATE_LIMIT_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_LOG_RATE_LIMIT_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_LOG_RATE_LIMIT_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_LOG_RATE_LIMIT_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_LOG_RATE_LIMIT_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_LOG_RATE_LIMIT_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_LOG_RATE_LIMIT_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_LOG_RATE_LIMIT_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_LOG_RATE_LIMIT_TR, ""},  /* fuzzy */
+#endif
+
 /* mouse.c */
 /* en */ {IDCLS_ENABLE_MOUSE_GRAB,    N_("Enable mouse grab")},
 #ifdef HAS_TRANSLATION
@@ -16384,6 +16834,42 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_SOUND_VOLUME_TR, ""},  /* fuzzy */
 #endif
 
+#ifdef HAVE_PTHREAD
+/* sound.c */
+/* en */ {IDCLS_ENABLE_SOUND_THREAD,    N_("Write to the sound device from a separate thread")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_ENABLE_SOUND_THREAD_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_ENABLE_SOUND_THREAD_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_ENABLE_SOUND_THREAD_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_ENABLE_SOUND_THREAD_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_ENABLE_SOUND_THREAD_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_ENABLE_SOUND_THREAD_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_ENABLE_SOUND_THREAD_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_ENABLE_SOUND_THREAD_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_ENABLE_SOUND_THREAD_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_ENABLE_SOUND_THREAD_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_ENABLE_SOUND_THREAD_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_ENABLE_SOUND_THREAD_TR, ""},  /* fuzzy */
+#endif
+
+/* sound.c */
+/* en */ {IDCLS_DISABLE_SOUND_THREAD,    N_("Write to the sound device from the emulation thread")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_DISABLE_SOUND_THREAD_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_DISABLE_SOUND_THREAD_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_DISABLE_SOUND_THREAD_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_DISABLE_SOUND_THREAD_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_DISABLE_SOUND_THREAD_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_DISABLE_SOUND_THREAD_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_DISABLE_SOUND_THREAD_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_DISABLE_SOUND_THREAD_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_DISABLE_SOUND_THREAD_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_DISABLE_SOUND_THREAD_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_DISABLE_SOUND_THREAD_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_DISABLE_SOUND_THREAD_TR, ""},  /* fuzzy */
+#endif
+#endif
+
 /* sysfile.c */
 /* en */ {IDCLS_P_PATH,    N_("<Path>")},
 #ifdef HAS_TRANSLATION
@@ -17270,6 +17756,23 @@ translate_t string_table[] = {
 /* tr */ {IDCLS_DISABLE_CPM_CART_TR, ""},  /* fuzzy */
 #endif
 
+/* c64/cart/cpmcart.c */
+/* en */ {IDCLS_SET_CPM_CART_BATCH,    N_("Run the CP/M cartridge Z80 for up to <value> cycles between synchronizations with the C64 (0: cycle exact)")},
+#ifdef HAS_TRANSLATION
+/* da */ {IDCLS_SET_CPM_CART_BATCH_DA, ""},  /* fuzzy */
+/* de */ {IDCLS_SET_CPM_CART_BATCH_DE, ""},  /* fuzzy */
+/* es */ {IDCLS_SET_CPM_CART_BATCH_ES, ""},  /* fuzzy */
+/* fr */ {IDCLS_SET_CPM_CART_BATCH_FR, ""},  /* fuzzy */
+/* hu */ {IDCLS_SET_CPM_CART_BATCH_HU, ""},  /* fuzzy */
+/* it */ {IDCLS_SET_CPM_CART_BATCH_IT, ""},  /* fuzzy */
+/* ko */ {IDCLS_SET_CPM_CART_BATCH_KO, ""},  /* fuzzy */
+/* nl */ {IDCLS_SET_CPM_CART_BATCH_NL, ""},  /* fuzzy */
+/* pl */ {IDCLS_SET_CPM_CART_BATCH_PL, ""},  /* fuzzy */
+/* ru */ {IDCLS_SET_CPM_CART_BATCH_RU, ""},  /* fuzzy */
+/* sv */ {IDCLS_SET_CPM_CART_BATCH_SV, ""},  /* fuzzy */
+/* tr */ {IDCLS_SET_CPM_CART_BATCH_TR, ""},  /* fuzzy */
+#endif
+
 /* c64/cart/turbomaster.c */
 /* en */ {IDCLS_ENABLE_TURBOMASTER,    N_("Enable the TurboMaster cartridge")},
 #ifdef HAS_TRANSLATION
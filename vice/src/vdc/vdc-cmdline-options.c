@@ -65,6 +65,18 @@ static const cmdline_option_t cmdline_options[] =
       USE_PARAM_ID, USE_DESCRIPTION_ID,
       IDCLS_P_NUMBER, IDCLS_SET_VDC_REVISION,
       NULL, NULL },
+#ifdef HAVE_PTHREAD
+    { "-VDCrenderthread", SET_RESOURCE, 0,
+      NULL, NULL, "VDCRenderThread", (resource_value_t)1,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_ENABLE_VDC_RENDER_THREAD,
+      NULL, NULL },
+    { "+VDCrenderthread", SET_RESOURCE, 0,
+      NULL, NULL, "VDCRenderThread", (resource_value_t)0,
+      USE_PARAM_STRING, USE_DESCRIPTION_ID,
+      IDCLS_UNUSED, IDCLS_DISABLE_VDC_RENDER_THREAD,
+      NULL, NULL },
+#endif
     CMDLINE_LIST_END
 };
 
@@ -133,6 +133,8 @@ void vdc_store(WORD addr, BYTE value)
         return;
     }
 
+    vdc_render_sync();
+
     /* otherwise we are writing to $d601
     save the old register value in case we need it for reference */
     oldval = vdc.regs[vdc.update_reg];
@@ -476,6 +478,8 @@ BYTE vdc_read(WORD addr)
 
     machine_handle_pending_alarms(0);
 
+    vdc_render_sync();
+
     if (addr & 1) { /* read $d601 (and mirrors $d603/5/7....$d6ff)  */
         /*log_message(vdc.log, "read: addr = %x", addr);*/
 
@@ -555,6 +559,7 @@ BYTE vdc_ram_read(WORD addr)
 
 void vdc_ram_store(WORD addr, BYTE value)
 {
+    vdc_render_sync();
     vdc.ram[addr & vdc.vdc_address_mask] = value;
 }
 
@@ -563,6 +568,8 @@ int vdc_dump(void)
 {
     unsigned int r, c, regnum=0;
 
+    vdc_render_sync();
+
     mon_out("VDC Revision: %d\n", vdc.revision);
     mon_out("Vertical Blanking Period: ");
     mon_out(((vdc.raster.current_line <= vdc.border_height) || (vdc.raster.current_line > (vdc.border_height + vdc.screen_ypix))) ? "Yes" : "No");
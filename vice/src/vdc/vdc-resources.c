@@ -42,6 +42,7 @@
 #include "raster-resources.h"
 #include "resources.h"
 #include "vdc-resources.h"
+#include "vdc.h"
 #include "vdctypes.h"
 #include "video.h"
 
@@ -50,6 +51,7 @@ static video_chip_cap_t video_chip_cap;
 
 static int set_64kb_expansion(int val, void *param)
 {
+    vdc_render_sync();
     vdc_resources.vdc_64kb_expansion = val ? 1 : 0;
 
     vdc.vdc_address_mask = vdc_resources.vdc_64kb_expansion
@@ -59,6 +61,8 @@ static int set_64kb_expansion(int val, void *param)
 
 static int set_vdc_revision(int val, void *param)
 {
+    vdc_render_sync();
+
     switch (val) {
         case VDC_REVISION_0:
         case VDC_REVISION_1:
@@ -93,6 +97,15 @@ void vdc_update_renderer(void)
     }
 }
 
+#ifdef HAVE_PTHREAD
+static int set_render_thread(int val, void *param)
+{
+    vdc_render_sync();
+    vdc_resources.render_thread = val ? 1 : 0;
+    return 0;
+}
+#endif
+
 static int set_stretch(int val, void *param)
 {
     DBG(("set_stretch"));
@@ -111,6 +124,10 @@ static const resource_int_t resources_int[] =
       (int *)&vdc.revision, set_vdc_revision, NULL },
     { "VDCStretchVertical", 1, RES_EVENT_SAME, NULL,
       &vdc_resources.stretchy, set_stretch, NULL },
+#ifdef HAVE_PTHREAD
+    { "VDCRenderThread", 0, RES_EVENT_NO, NULL,
+      &vdc_resources.render_thread, set_render_thread, NULL },
+#endif
     { NULL, 0, 0, NULL,
       NULL, NULL, NULL }
 };
@@ -32,11 +32,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "alarm.h"
 #include "lib.h"
 #include "log.h"
 #include "machine.h"
 #include "maincpu.h"
+#include "raster-canvas.h"
 #include "raster.h"
 #include "raster-line.h"
 #include "raster-modes.h"
@@ -236,6 +241,219 @@ struct video_canvas_s *vdc_get_canvas(void)
     return vdc.raster.canvas;
 }
 
+/* ---------------------------------------------------------------------*/
+
+#ifdef HAVE_PTHREAD
+/* Line drawing thread.
+
+   With "VDCRenderThread" enabled, the raster alarm only queues the line
+   and the thread runs the rest of the alarm handler for it, up to a whole
+   frame behind the emulation.  What it computes only depends on the
+   registers, the VDC RAM and the lines before, so everything that reads
+   or changes them calls `vdc_render_sync()' first, which waits until the
+   queued lines are drawn: register and RAM accesses, snapshots,
+   resources, the vsync hook (before UI events are handled) and the last
+   line of a frame, before the colours for the canvas are prepared.  The
+   thread converts the finished frame into the canvas image
+   (`refresh_deferred' of the raster) and `vdc_render_sync()' shows it.
+   A line 0 that resizes the canvas is drawn directly.  A sleeping thread
+   is only woken for a batch of lines or by `vdc_render_sync()'.  */
+
+/* Number of polls before waiting on the other thread.  */
+#define VDC_THREAD_SPIN 2000
+
+/* Number of queued lines that wake the sleeping thread.  */
+#define VDC_THREAD_BATCH 32
+
+#define VDC_THREAD_BARRIER() __sync_synchronize()
+
+static struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_cond_t done;
+    int running;
+    int failed;
+    volatile int sleeping;
+    volatile int waiting;
+    volatile int quit;
+    /* Lines queued and drawn, they wrap.  */
+    volatile unsigned int queued;
+    volatile unsigned int drawn;
+    /* Next line to queue.  */
+    unsigned int line;
+} vdc_thread;
+
+static void vdc_raster_draw_line(void);
+
+static void *vdc_thread_main(void *unused)
+{
+    int spin;
+
+    while (1) {
+        for (spin = 0; spin < VDC_THREAD_SPIN && vdc_thread.drawn == vdc_thread.queued && !vdc_thread.quit; spin++) {
+        }
+
+        if (vdc_thread.drawn == vdc_thread.queued && !vdc_thread.quit) {
+            pthread_mutex_lock(&vdc_thread.lock);
+            vdc_thread.sleeping = 1;
+            VDC_THREAD_BARRIER();
+            while (vdc_thread.drawn == vdc_thread.queued && !vdc_thread.quit) {
+                pthread_cond_wait(&vdc_thread.cond, &vdc_thread.lock);
+            }
+            vdc_thread.sleeping = 0;
+            pthread_mutex_unlock(&vdc_thread.lock);
+        }
+
+        if (vdc_thread.drawn == vdc_thread.queued) {
+            break;
+        }
+
+        while (vdc_thread.drawn != vdc_thread.queued) {
+            VDC_THREAD_BARRIER();
+            vdc_raster_draw_line();
+            VDC_THREAD_BARRIER();
+            vdc_thread.drawn++;
+        }
+
+        VDC_THREAD_BARRIER();
+        if (vdc_thread.waiting) {
+            pthread_mutex_lock(&vdc_thread.lock);
+            pthread_cond_signal(&vdc_thread.done);
+            pthread_mutex_unlock(&vdc_thread.lock);
+        }
+    }
+    return NULL;
+}
+
+static int vdc_thread_start(void)
+{
+    if (vdc_thread.running) {
+        return 0;
+    }
+    if (vdc_thread.failed) {
+        return -1;
+    }
+
+    vdc_thread.queued = 0;
+    vdc_thread.drawn = 0;
+    vdc_thread.quit = 0;
+    vdc_thread.sleeping = 0;
+    vdc_thread.waiting = 0;
+    pthread_mutex_init(&vdc_thread.lock, NULL);
+    pthread_cond_init(&vdc_thread.cond, NULL);
+    pthread_cond_init(&vdc_thread.done, NULL);
+
+    if (pthread_create(&vdc_thread.thread, NULL, vdc_thread_main, NULL) != 0) {
+        log_error(vdc.log, "Cannot create the line drawing thread.");
+        pthread_cond_destroy(&vdc_thread.done);
+        pthread_cond_destroy(&vdc_thread.cond);
+        pthread_mutex_destroy(&vdc_thread.lock);
+        vdc_thread.failed = 1;
+        return -1;
+    }
+    vdc_thread.running = 1;
+
+    return 0;
+}
+
+static void vdc_thread_wake(void)
+{
+    pthread_mutex_lock(&vdc_thread.lock);
+    pthread_cond_signal(&vdc_thread.cond);
+    pthread_mutex_unlock(&vdc_thread.lock);
+}
+
+static void vdc_thread_stop(void)
+{
+    if (!vdc_thread.running) {
+        return;
+    }
+
+    vdc_render_sync();
+
+    vdc_thread.quit = 1;
+    vdc_thread_wake();
+
+    pthread_join(vdc_thread.thread, NULL);
+    pthread_cond_destroy(&vdc_thread.done);
+    pthread_cond_destroy(&vdc_thread.cond);
+    pthread_mutex_destroy(&vdc_thread.lock);
+    vdc_thread.running = 0;
+    vdc.raster.refresh_deferred = 0;
+}
+
+/* Queue the current line, or draw it if it resizes the canvas.  */
+static void vdc_thread_draw_line(void)
+{
+    unsigned int line;
+
+    if (vdc_thread.drawn == vdc_thread.queued) {
+        VDC_THREAD_BARRIER();
+        vdc_thread.line = vdc.raster.current_line;
+        vdc.raster.refresh_deferred = 1;
+    }
+    line = vdc_thread.line;
+
+    if (line == 0 && (vdc.update_geometry || vdc.force_resize)) {
+        vdc_render_sync();
+        vdc_raster_draw_line();
+        return;
+    }
+
+    if (++vdc_thread.line == vdc.raster.geometry->screen_size.height) {
+        /* The thread converts the frame after this line.  */
+        vdc_thread.line = 0;
+        vdc_render_sync();
+        raster_canvas_refresh_prepare(&vdc.raster);
+    }
+
+    VDC_THREAD_BARRIER();
+    vdc_thread.queued++;
+    VDC_THREAD_BARRIER();
+    if (vdc_thread.sleeping
+        && vdc_thread.queued - vdc_thread.drawn >= VDC_THREAD_BATCH) {
+        vdc_thread_wake();
+    }
+}
+
+void vdc_render_sync(void)
+{
+    int spin;
+
+    if (!vdc_thread.running) {
+        return;
+    }
+
+    if (vdc_thread.drawn != vdc_thread.queued) {
+        VDC_THREAD_BARRIER();
+        if (vdc_thread.sleeping) {
+            vdc_thread_wake();
+        }
+
+        for (spin = 0; spin < VDC_THREAD_SPIN && vdc_thread.drawn != vdc_thread.queued; spin++) {
+        }
+
+        if (vdc_thread.drawn != vdc_thread.queued) {
+            pthread_mutex_lock(&vdc_thread.lock);
+            vdc_thread.waiting = 1;
+            VDC_THREAD_BARRIER();
+            while (vdc_thread.drawn != vdc_thread.queued) {
+                pthread_cond_wait(&vdc_thread.done, &vdc_thread.lock);
+            }
+            vdc_thread.waiting = 0;
+            pthread_mutex_unlock(&vdc_thread.lock);
+        }
+    }
+    VDC_THREAD_BARRIER();
+
+    raster_canvas_refresh_pending(&vdc.raster);
+}
+#else
+void vdc_render_sync(void)
+{
+}
+#endif
 
 static void vdc_set_next_alarm(CLOCK offset)
 {
@@ -311,6 +529,8 @@ static void vdc_update_geometry(void)
 /* Reset the VDC chip */
 void vdc_reset(void)
 {
+    vdc_render_sync();
+
     if (vdc.initialized) {
         raster_reset(&vdc.raster);
     }
@@ -340,6 +560,9 @@ void vdc_powerup(void)
     /* Setup the VDC's ram with a 0xff00ff00.. pattern */
     unsigned int i;
     BYTE v = 0xff;
+
+    vdc_render_sync();
+
     for (i = 0; i < sizeof(vdc.ram); i++) {
         vdc.ram[i] = v;
         v ^= 0xff;
@@ -362,6 +585,8 @@ void vdc_powerup(void)
 /* Trigger the light pen.  */
 void vdc_trigger_light_pen(CLOCK mclk)
 {
+    vdc_render_sync();
+
     vdc.light_pen.triggered = 1;
     vdc.regs[16] = vdc.light_pen.y;
     vdc.regs[17] = vdc.light_pen.x;
@@ -422,7 +647,7 @@ static void vdc_set_video_mode(void)
 
 
 /* Redraw the current raster line. */
-static void vdc_raster_draw_alarm_handler(CLOCK offset, void *data)
+static void vdc_raster_draw_line(void)
 {
     int in_idle_state, calculated_border_height;
     static unsigned int old_screen_adr, old_attribute_adr, screen_ystart, need_increment_memory_pointer;
@@ -550,6 +775,20 @@ static void vdc_raster_draw_alarm_handler(CLOCK offset, void *data)
 
     /* update the memory pointers if we are past screen_ystart, which may be above or below the top border */
     need_increment_memory_pointer = (vdc.raster.current_line > screen_ystart);
+}
+
+static void vdc_raster_draw_alarm_handler(CLOCK offset, void *data)
+{
+#ifdef HAVE_PTHREAD
+    if (vdc_resources.render_thread && vdc_thread_start() == 0) {
+        vdc_thread_draw_line();
+    } else {
+        vdc.raster.refresh_deferred = 0;
+        vdc_raster_draw_line();
+    }
+#else
+    vdc_raster_draw_line();
+#endif
 
     vdc_set_next_alarm(offset);
 }
@@ -569,21 +808,25 @@ void vdc_calculate_xsync(void)
 
 void vdc_set_canvas_refresh(int enable)
 {
+    vdc_render_sync();
     raster_set_canvas_refresh(&vdc.raster, enable);
 }
 
 int vdc_write_snapshot_module(snapshot_t *s)
 {
+    vdc_render_sync();
     return vdc_snapshot_write_module(s);
 }
 
 int vdc_read_snapshot_module(snapshot_t *s)
 {
+    vdc_render_sync();
     return vdc_snapshot_read_module(s);
 }
 
 void vdc_screenshot(screenshot_t *screenshot)
 {
+    vdc_render_sync();
     raster_screenshot(&vdc.raster, screenshot);
     screenshot->chipid = "VDC";
     screenshot->video_regs = vdc.regs;
@@ -597,10 +840,14 @@ void vdc_screenshot(screenshot_t *screenshot)
 
 void vdc_async_refresh(struct canvas_refresh_s *refresh)
 {
+    vdc_render_sync();
     raster_async_refresh(&vdc.raster, refresh);
 }
 
 void vdc_shutdown(void)
 {
+#ifdef HAVE_PTHREAD
+    vdc_thread_stop();
+#endif
     raster_shutdown(&vdc.raster);
 }
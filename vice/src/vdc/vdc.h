@@ -55,4 +55,7 @@ extern int vdc_read_snapshot_module(struct snapshot_s *s);
 extern void vdc_set_canvas_refresh(int enable);
 extern void vdc_shutdown(void);
 
+/* Wait until the line drawing thread is idle.  */
+extern void vdc_render_sync(void);
+
 #endif
@@ -302,6 +302,27 @@ static void store_watch(WORD addr, BYTE value)
     _mem_write_tab_nowatch[addr >> 8](addr, value);
 }
 
+/* Only the pages that contain a watched address go through the checking
+   handlers, all other pages keep their normal handlers.  */
+static void mem_update_watch_tab(void)
+{
+    int i, flags;
+
+    for (i = 0; i <= 0x100; i++) {
+        flags = monitor_watch_page_flags(e_comp_space, (unsigned int)i);
+        if (flags & MONITOR_WATCH_LOAD) {
+            _mem_read_tab_watch[i] = (i == 0) ? zero_read_watch : read_watch;
+        } else {
+            _mem_read_tab_watch[i] = _mem_read_tab_nowatch[i];
+        }
+        if (flags & MONITOR_WATCH_STORE) {
+            _mem_write_tab_watch[i] = (i == 0) ? zero_store_watch : store_watch;
+        } else {
+            _mem_write_tab_watch[i] = _mem_write_tab_nowatch[i];
+        }
+    }
+}
+
 /* ------------------------------------------------------------------------- */
 /* Generic memory access.  */
 
@@ -347,6 +368,10 @@ static void set_mem(int start_page, int end_page,
             mem_read_limit_tab[i] = 0;
         }
     }
+
+    if (watchpoints_active) {
+        mem_update_watch_tab();
+    }
 }
 
 int vic20_mem_enable_ram_block(int num)
@@ -387,8 +412,6 @@ int vic20_mem_disable_ram_block(int num)
 
 void mem_initialize_memory(void)
 {
-    int i;
-
     /* Setup zero page at $0000-$00FF. */
     set_mem(0x00, 0x00,
             zero_read, zero_store, ram_peek,
@@ -526,14 +549,6 @@ void mem_initialize_memory(void)
     _mem_read_base_tab_ptr = _mem_read_base_tab;
     mem_read_limit_tab_ptr = mem_read_limit_tab;
 
-    /* setup watchpoint tables */
-    _mem_read_tab_watch[0] = zero_read_watch;
-    _mem_write_tab_watch[0] = zero_store_watch;
-    for (i = 1; i <= 0x100; i++) {
-        _mem_read_tab_watch[i] = read_watch;
-        _mem_write_tab_watch[i] = store_watch;
-    }
-
     mem_toggle_watchpoints(watchpoints_active, NULL);
     maincpu_resync_limits();
 }
@@ -550,6 +565,7 @@ void mem_mmu_translate(unsigned int addr, BYTE **base, int *start, int *limit)
 void mem_toggle_watchpoints(int flag, void *context)
 {
     if (flag) {
+        mem_update_watch_tab();
         _mem_read_tab_ptr = _mem_read_tab_watch;
         _mem_write_tab_ptr = _mem_write_tab_watch;
     } else {
@@ -124,6 +124,11 @@ typedef int ssize_t;
 #define VIDEO_SCALE_SOURCE
 #endif
 
+/* Which UI can colour convert a canvas refresh off the UI thread.  */
+#if defined(USE_XAWUI)
+#define VIDEO_CANVAS_REFRESH_SPLIT
+#endif
+
 /* ------------------------------------------------------------------------- */
 
 /* Internationalization stuff */
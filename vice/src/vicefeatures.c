@@ -68,6 +68,13 @@ static feature_list_t featurelist[] = {
 #else
         1 },
 #endif
+/* (all) */
+    { "FEATURE_HOSTTIMERS", "Measure the host time spent in the subsystems.",
+#ifndef FEATURE_HOSTTIMERS
+        0 },
+#else
+        1 },
+#endif
 #ifdef UNIX /* (unix) */
     { "HAS_DIGITAL_JOYSTICK", "Enable emulation for digital joysticks.",
 #ifndef HAS_DIGITAL_JOYSTICK
@@ -586,6 +586,7 @@ static void vicii_chip_model_set(struct ViciiChipModel *cm)
     struct ViciiCycle *ct = cm->cycle_tab;
 
     vicii.cycles_per_line = cm->cycles_per_line;
+    vicii.quiet_cycles = 0;
     vicii.screen_height = cm->num_raster_lines;
     vicii.color_latency = cm->color_latency;
     vicii.lightpen_old_irq_mode = cm->lightpen_old_irq_mode;
@@ -32,6 +32,7 @@
 #include "vice.h"
 
 #include "debug.h"
+#include "hosttimer.h"
 #include "lib.h"
 #include "log.h"
 #include "maincpu.h"
@@ -250,12 +251,116 @@ static inline void next_vicii_cycle(void)
     }
 }
 
+/*
+ * Quiet lines
+ *
+ * On lines that are completely inside the vertical border, with no sprite
+ * DMA, no sprite being displayed and no bad lines allowed, most of the
+ * per cycle logic below has no effect.  Such a line is detected once at
+ * the start of the line and the remaining cycles of it are then run
+ * through vicii_cycle_quiet(), which only performs the work that still
+ * changes state: the Phi1/Phi2 fetches (the values are visible on the
+ * bus), the border pixels, VC/RC updates and the light pen check.
+ *
+ * Any VIC-II register access ends the run (see vicii-mem.c), so the full
+ * cycle handler takes over again from the next cycle on.
+ */
+static inline int vicii_cycle_line_is_quiet(void)
+{
+    int i, b;
+    int enable = vicii.regs[0x15];
+
+    if (!vicii.vborder || !vicii.set_vborder || !vicii.main_border) {
+        return 0;
+    }
+
+    if (vicii.allow_bad_lines || vicii.bad_line
+        || vicii.raster_line == VICII_FIRST_DMA_LINE) {
+        return 0;
+    }
+
+    if (vicii.sprite_dma || vicii.sprite_display_bits
+        || vicii.clear_collisions || vicii.last_color_reg != 0xff) {
+        return 0;
+    }
+
+    /* no sprite DMA may be turned on and mc must not change */
+    for (i = 0, b = 1; i < VICII_NUM_SPRITES; i++, b <<= 1) {
+        unsigned int y = vicii.regs[i * 2 + 1];
+
+        if ((enable & b) && (y == (vicii.raster_line & 0xff))) {
+            return 0;
+        }
+        if (vicii.sprite[i].mc != vicii.sprite[i].mcbase) {
+            return 0;
+        }
+    }
+
+    return vicii_draw_cycle_is_quiet();
+}
+
+static inline void vicii_cycle_quiet(void)
+{
+    /* perform phi2 fetch after the cpu has executed */
+    vicii_fetch_sprites(vicii.cycle_flags);
+
+    /* Next cycle (the run never crosses the end of the line) */
+    vicii.raster_cycle++;
+    vicii.cycle_flags = vicii.cycle_table[vicii.raster_cycle];
+
+    /* Phi1 fetch */
+    vicii.last_read_phi1 = cycle_phi1_fetch(vicii.cycle_flags);
+
+    /* Draw one cycle of border pixels */
+    vicii_draw_cycle_quiet();
+
+    /* Update VC (Cycle 14 on PAL) */
+    if (cycle_is_update_vc(vicii.cycle_flags)) {
+        vicii.vc = vicii.vcbase;
+        vicii.vmli = 0;
+    }
+
+    /* Update RC (Cycle 58 on PAL) */
+    if (cycle_is_update_rc(vicii.cycle_flags)) {
+        if (vicii.rc == 7) {
+            vicii.idle_state = 1;
+            vicii.vcbase = vicii.vc;
+        }
+        if (!vicii.idle_state) {
+            vicii.rc = (vicii.rc + 1) & 0x7;
+        }
+    }
+
+    /* BA is never low on a quiet line */
+    vicii.prefetch_cycles = 3 + 1;
+
+    /* clear internal bus (may get set by a VIC-II read or write) */
+    vicii.last_bus_phi2 = 0xff;
+
+    /* delay video mode for fetches by one cycle */
+    vicii.reg11_delay = vicii.regs[0x11];
+
+    /* trigger light pen if scheduled */
+    if (vicii.light_pen.trigger_cycle == maincpu_clk) {
+        vicii_trigger_light_pen_internal(0);
+    }
+}
+
 int vicii_cycle(void)
 {
     int ba_low = 0;
     int can_sprite_sprite, can_sprite_background;
     int may_crash;
 
+    HOSTTIMER_ENTER(HOSTTIMER_VICII);
+
+    if (vicii.quiet_cycles) {
+        vicii.quiet_cycles--;
+        vicii_cycle_quiet();
+        HOSTTIMER_LEAVE();
+        return 0;
+    }
+
     /*VICII_DEBUG_CYCLE(("cycle: line %i, clk %i", vicii.raster_line, vicii.raster_cycle));*/
 
     /* perform phi2 fetch after the cpu has executed */
@@ -509,6 +614,14 @@ int vicii_cycle(void)
         vicii_trigger_light_pen_internal(0);
     }
 
+    /* Check if the rest of the line can use the reduced cycle handler */
+    if (vicii.raster_cycle == VICII_PAL_CYCLE(2) && !ba_low) {
+        if (vicii_cycle_line_is_quiet()) {
+            vicii.quiet_cycles = vicii.cycles_per_line - 1 - vicii.raster_cycle;
+        }
+    }
+
+    HOSTTIMER_LEAVE();
     return ba_low;
 }
 
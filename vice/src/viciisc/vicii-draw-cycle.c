@@ -37,6 +37,9 @@
 /* disable for debugging */
 #define DRAW_INLINE inline
 
+/* disable to always use the exact per pixel graphics path */
+#define DRAW_GRAPHICS_FAST
+
 /* colors */
 #define COL_NONE     0x10
 #define COL_VBUF_L   0x11
@@ -136,10 +139,37 @@ static const BYTE colors[] = {
     COL_NONE, COL_NONE, COL_NONE, COL_NONE          /* ECM=1 BMM=1 MCM=1 */
 };
 
+static DRAW_INLINE BYTE resolve_graphics_color(BYTE cc)
+{
+    /* lookup colors */
+    switch (cc) {
+        case COL_NONE:
+            cc = 0;
+            break;
+        case COL_VBUF_L:
+            cc = vbuf_reg & 0x0f;
+            break;
+        case COL_VBUF_H:
+            cc = vbuf_reg >> 4;
+            break;
+        case COL_CBUF:
+            cc = cbuf_reg;
+            break;
+        case COL_CBUF_MC:
+            cc = cbuf_reg & 0x07;
+            break;
+        case COL_D02X_EXT:
+            cc = COL_D021 + (vbuf_reg >> 6);
+            break;
+        default:
+            break;
+    }
+    return cc;
+}
+
 static DRAW_INLINE void draw_graphics(int i)
 {
     BYTE px;
-    BYTE cc;
     BYTE pixel_pri;
     BYTE vmode;
 
@@ -189,34 +219,68 @@ static DRAW_INLINE void draw_graphics(int i)
     /* Determine pixel color and priority */
     vmode = vmode11_pipe | vmode16_pipe;
     pixel_pri = (px & 0x2);
-    cc = colors[vmode | px];
 
-    /* lookup colors and render pixel */
-    switch (cc) {
-        case COL_NONE:
-            cc = 0;
-            break;
-        case COL_VBUF_L:
-            cc = vbuf_reg & 0x0f;
-            break;
-        case COL_VBUF_H:
-            cc = vbuf_reg >> 4;
-            break;
-        case COL_CBUF:
-            cc = cbuf_reg;
-            break;
-        case COL_CBUF_MC:
-            cc = cbuf_reg & 0x07;
-            break;
-        case COL_D02X_EXT:
-            cc = COL_D021 + (vbuf_reg >> 6);
-            break;
-        default:
-            break;
+    /* render pixel */
+    render_buffer[i] = resolve_graphics_color(colors[vmode | px]);
+    pri_buffer[i] = pixel_pri;
+}
+
+/*
+ * Render the pixels start..end-1 of the current cycle in one go.
+ * This is only valid if the video mode pipes stay unchanged for the
+ * whole span and no gbuf/vbuf/cbuf latch happens inside it, which
+ * draw_graphics8() guarantees before calling it.
+ * The results are identical to calling draw_graphics() per pixel.
+ */
+static DRAW_INLINE void draw_graphics_span(int start, int end)
+{
+    BYTE col[4];
+    BYTE vmode;
+    BYTE px;
+    int mc;
+    int i;
+
+    /* the colors can only change at a latch, so resolve them up front */
+    vmode = vmode11_pipe | vmode16_pipe;
+    col[0] = resolve_graphics_color(colors[vmode | 0]);
+    col[1] = resolve_graphics_color(colors[vmode | 1]);
+    col[2] = resolve_graphics_color(colors[vmode | 2]);
+    col[3] = resolve_graphics_color(colors[vmode | 3]);
+
+    mc = (vmode11_pipe & 0x08) || (cbuf_reg & 0x08);
+
+    if (vmode16_pipe2 && mc) {
+        /* mc pixels */
+        for (i = start; i < end; i++) {
+            if (gbuf_mc_flop) {
+                gbuf_pixel_reg = gbuf_reg >> 6;
+            }
+            gbuf_reg <<= 1;
+            gbuf_mc_flop ^= 1;
+            px = gbuf_pixel_reg;
+            render_buffer[i] = col[px];
+            pri_buffer[i] = px & 0x2;
+        }
+        return;
     }
 
-    render_buffer[i] = cc;
-    pri_buffer[i] = pixel_pri;
+    /* hires pixels (including the MCM=0 -> 1 kludge) */
+    px = (vmode16_pipe2 || !mc) ? 3 : 2;
+    if (gbuf_reg == 0) {
+        /* fast case: nothing but background in this span */
+        memset(&render_buffer[start], col[0], (size_t)(end - start));
+        memset(&pri_buffer[start], 0, (size_t)(end - start));
+        gbuf_pixel_reg = 0;
+        gbuf_mc_flop ^= (BYTE)((end - start) & 1);
+        return;
+    }
+    for (i = start; i < end; i++) {
+        gbuf_pixel_reg = (gbuf_reg & 0x80) ? px : 0;
+        gbuf_reg <<= 1;
+        render_buffer[i] = col[gbuf_pixel_reg];
+        pri_buffer[i] = gbuf_pixel_reg & 0x2;
+    }
+    gbuf_mc_flop ^= (BYTE)((end - start) & 1);
 }
 
 static DRAW_INLINE void draw_graphics8(unsigned int cycle_flags)
@@ -225,36 +289,66 @@ static DRAW_INLINE void draw_graphics8(unsigned int cycle_flags)
 
     vis_en = cycle_is_visible(cycle_flags);
 
-    /* render pixels */
-    /* pixel 0 */
-    draw_graphics(0);
-    /* pixel 1 */
-    draw_graphics(1);
-    /* pixel 2 */
-    draw_graphics(2);
-    /* pixel 3 */
-    draw_graphics(3);
-    /* pixel 4 */
-    vmode16_pipe = ( vicii.regs[0x16] & 0x10 ) >> 2;
-    if (vicii.color_latency) {
-        /* handle rising edge of internal signal */
-        vmode11_pipe |= ( vicii.regs[0x11] & 0x60 ) >> 2;
-    }
-    draw_graphics(4);
-    /* pixel 5 */
-    draw_graphics(5);
-    /* pixel 6 */
-    if (vicii.color_latency) {
-        /* handle falling edge of internal signal */
-        vmode11_pipe &= ( vicii.regs[0x11] & 0x60 ) >> 2;
-    }
-    draw_graphics(6);
-    /* pixel 7 */
-    if (vmode16_pipe && !vmode16_pipe2) {
-        gbuf_mc_flop = 0;
+#ifdef DRAW_GRAPHICS_FAST
+    /*
+     * Fast path: if the video mode pipes will not change during this
+     * cycle, render the pixels before and after the xscroll latch as
+     * two spans.
+     */
+    if (((vicii.regs[0x16] & 0x10) >> 2) == vmode16_pipe
+        && vmode16_pipe == vmode16_pipe2
+        && (!vicii.color_latency
+            || ((vicii.regs[0x11] & 0x60) >> 2) == vmode11_pipe)) {
+        int xs = xscroll_pipe;
+
+        if (xs < 8) {
+            if (xs > 0) {
+                draw_graphics_span(0, xs);
+            }
+            /* latch values at time xs */
+            vbuf_reg = vbuf_pipe1_reg;
+            cbuf_reg = cbuf_pipe1_reg;
+            gbuf_reg = gbuf_pipe1_reg;
+            gbuf_mc_flop = 1;
+            draw_graphics_span(xs, 8);
+        } else {
+            draw_graphics_span(0, 8);
+        }
+    } else
+#endif
+    {
+        /* exact path */
+        /* render pixels */
+        /* pixel 0 */
+        draw_graphics(0);
+        /* pixel 1 */
+        draw_graphics(1);
+        /* pixel 2 */
+        draw_graphics(2);
+        /* pixel 3 */
+        draw_graphics(3);
+        /* pixel 4 */
+        vmode16_pipe = ( vicii.regs[0x16] & 0x10 ) >> 2;
+        if (vicii.color_latency) {
+            /* handle rising edge of internal signal */
+            vmode11_pipe |= ( vicii.regs[0x11] & 0x60 ) >> 2;
+        }
+        draw_graphics(4);
+        /* pixel 5 */
+        draw_graphics(5);
+        /* pixel 6 */
+        if (vicii.color_latency) {
+            /* handle falling edge of internal signal */
+            vmode11_pipe &= ( vicii.regs[0x11] & 0x60 ) >> 2;
+        }
+        draw_graphics(6);
+        /* pixel 7 */
+        if (vmode16_pipe && !vmode16_pipe2) {
+            gbuf_mc_flop = 0;
+        }
+        vmode16_pipe2 = vmode16_pipe;
+        draw_graphics(7);
     }
-    vmode16_pipe2 = vmode16_pipe;
-    draw_graphics(7);
 
     if (!vicii.color_latency) {
         vmode11_pipe = ( vicii.regs[0x11] & 0x60 ) >> 2;
@@ -483,6 +577,33 @@ static DRAW_INLINE void draw_sprites8(unsigned int cycle_flags)
     if (cycle_is_sprite_dma1_dma2(cycle_flags)) {
         dma_cycle_2 = 1 << cycle_get_sprite_num(cycle_flags);
     }
+
+    /*
+     * Fast path: no sprite is shifting out data and none can be
+     * triggered during this cycle, so only the register pipes need
+     * updating.
+     */
+    if (!sprite_active_bits
+        && !sprite_pending_bits
+        && !(spr_en && vicii.sprite_display_bits)) {
+        sprite_halt_bits |= dma_cycle_0;
+        if (spr_en) {
+            sprite_pending_bits = vicii.sprite_display_bits;
+        }
+        update_sprite_data(cycle_flags);
+        if (!vicii.color_latency) {
+            update_sprite_mc_bits_8565();
+        }
+        sprite_pri_bits = vicii.regs[0x1b];
+        sprite_expx_bits = vicii.regs[0x1d];
+        if (vicii.color_latency) {
+            update_sprite_mc_bits_6569();
+        }
+        sprite_halt_bits &= ~dma_cycle_2;
+        update_sprite_xpos();
+        return;
+    }
+
     candidate_bits = get_trigger_candidates(xpos);
 
     /* process and render sprites */
@@ -587,38 +708,48 @@ static DRAW_INLINE void update_cregs(void)
     vicii.last_color_reg = 0xff;
 }
 
-static DRAW_INLINE void draw_colors_6569(int offs, int i)
+/*
+ * The pixel ring buffer holds the pixels of the previous cycle.  Pixel 0
+ * was already resolved at the end of the previous cycle, the others are
+ * resolved through the current color registers right before being output.
+ */
+static DRAW_INLINE void draw_colors8_6569(BYTE *dst)
 {
-    int lookup_index;
-
-    /* resolve any unresolved colors */
-    lookup_index = (i + 1) & 0x07;
-    pixel_buffer[lookup_index] = cregs[pixel_buffer[lookup_index]];
-
-    /* draw pixel to buffer */
-    vicii.dbuf[offs + i] = pixel_buffer[i];
-
-    pixel_buffer[i] = render_buffer[i];
+    dst[0] = pixel_buffer[0];
+    dst[1] = cregs[pixel_buffer[1]];
+    dst[2] = cregs[pixel_buffer[2]];
+    dst[3] = cregs[pixel_buffer[3]];
+    dst[4] = cregs[pixel_buffer[4]];
+    dst[5] = cregs[pixel_buffer[5]];
+    dst[6] = cregs[pixel_buffer[6]];
+    dst[7] = cregs[pixel_buffer[7]];
+
+    memcpy(pixel_buffer, render_buffer, 8);
+    pixel_buffer[0] = cregs[pixel_buffer[0]];
 }
 
-static DRAW_INLINE void draw_colors_8565(int offs, int i)
+/*
+ * All pixels are resolved through the current color registers right
+ * before being output, except for the grey dot on the first pixel
+ * after a color register write.
+ */
+static DRAW_INLINE void draw_colors8_8565(BYTE *dst)
 {
-    int lookup_index;
-
-    lookup_index = i;
-    /* resolve any unresolved colors */
-
     /* special case for grey dot handling */
-    if (i == 0 && pixel_buffer[lookup_index] == last_color_reg) {
-        pixel_buffer[lookup_index] = 0x0f;
+    if (pixel_buffer[0] == last_color_reg) {
+        dst[0] = 0x0f;
     } else {
-        pixel_buffer[lookup_index] = cregs[pixel_buffer[lookup_index]];
+        dst[0] = cregs[pixel_buffer[0]];
     }
-
-    /* draw pixel to buffer */
-    vicii.dbuf[offs + i] = pixel_buffer[i];
-
-    pixel_buffer[i] = render_buffer[i];
+    dst[1] = cregs[pixel_buffer[1]];
+    dst[2] = cregs[pixel_buffer[2]];
+    dst[3] = cregs[pixel_buffer[3]];
+    dst[4] = cregs[pixel_buffer[4]];
+    dst[5] = cregs[pixel_buffer[5]];
+    dst[6] = cregs[pixel_buffer[6]];
+    dst[7] = cregs[pixel_buffer[7]];
+
+    memcpy(pixel_buffer, render_buffer, 8);
 }
 
 static DRAW_INLINE void draw_colors8(void)
@@ -637,23 +768,9 @@ static DRAW_INLINE void draw_colors8(void)
 
     /* render pixels */
     if (vicii.color_latency) {
-        draw_colors_6569(offs, 0);
-        draw_colors_6569(offs, 1);
-        draw_colors_6569(offs, 2);
-        draw_colors_6569(offs, 3);
-        draw_colors_6569(offs, 4);
-        draw_colors_6569(offs, 5);
-        draw_colors_6569(offs, 6);
-        draw_colors_6569(offs, 7);
+        draw_colors8_6569(&vicii.dbuf[offs]);
     } else {
-        draw_colors_8565(offs, 0);
-        draw_colors_8565(offs, 1);
-        draw_colors_8565(offs, 2);
-        draw_colors_8565(offs, 3);
-        draw_colors_8565(offs, 4);
-        draw_colors_8565(offs, 5);
-        draw_colors_8565(offs, 6);
-        draw_colors_8565(offs, 7);
+        draw_colors8_8565(&vicii.dbuf[offs]);
     }
     vicii.dbuf_offset += 8;
 
@@ -686,6 +803,87 @@ void vicii_draw_cycle(void)
 }
 
 
+/*
+ * Check whether the pipeline is in a steady state where every cycle only
+ * produces border pixels and leaves the internal state unchanged (apart
+ * from dmli and the sprite register pipes), given no VIC-II registers are
+ * written.  Used for the quiet lines in vicii-cycle.c.
+ */
+int vicii_draw_cycle_is_quiet(void)
+{
+    int i;
+
+    if (!border_state || !vicii.main_border) {
+        return 0;
+    }
+
+    if (gbuf_reg || gbuf_pipe0_reg || gbuf_pipe1_reg || gbuf_pixel_reg) {
+        return 0;
+    }
+
+    if (vbuf_reg != vbuf_pipe1_reg || vbuf_pipe1_reg != vbuf_pipe0_reg
+        || cbuf_reg != cbuf_pipe1_reg || cbuf_pipe1_reg != cbuf_pipe0_reg) {
+        return 0;
+    }
+
+    if (vmode16_pipe != ((vicii.regs[0x16] & 0x10) >> 2)
+        || vmode16_pipe2 != vmode16_pipe
+        || vmode11_pipe != ((vicii.regs[0x11] & 0x60) >> 2)) {
+        return 0;
+    }
+
+    if (sprite_active_bits || sprite_pending_bits) {
+        return 0;
+    }
+
+    if (last_color_reg != 0xff) {
+        return 0;
+    }
+
+    /* The 6569 resolves pixel 0 at the end of the cycle, the 8565 keeps
+       the color register like for the other pixels.  */
+    if (pixel_buffer[0] != (vicii.color_latency ? cregs[COL_D020] : COL_D020)) {
+        return 0;
+    }
+
+    for (i = 0; i < 8; i++) {
+        if (render_buffer[i] != COL_D020 || pri_buffer[i]) {
+            return 0;
+        }
+        if (i > 0 && pixel_buffer[i] != COL_D020) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Draw one cycle while the pipeline is quiet.  This has the same result
+ * as vicii_draw_cycle() as long as vicii_draw_cycle_is_quiet() holds.
+ */
+void vicii_draw_cycle_quiet(void)
+{
+    int offs = vicii.dbuf_offset;
+
+    /* update display index in the visible region */
+    if (cycle_is_visible(cycle_flags_pipe)) {
+        dmli++;
+    } else {
+        dmli = 0;
+    }
+
+    /* no sprite is active, this only updates the register pipes */
+    draw_sprites8(cycle_flags_pipe);
+
+    if (offs <= VICII_DRAW_BUFFER_SIZE - 8) {
+        memset(&vicii.dbuf[offs], cregs[COL_D020], 8);
+        vicii.dbuf_offset += 8;
+    }
+
+    cycle_flags_pipe = vicii.cycle_flags;
+}
+
 void vicii_draw_cycle_init(void)
 {
     int i;
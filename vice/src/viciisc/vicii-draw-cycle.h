@@ -29,6 +29,8 @@
 
 extern void vicii_draw_cycle(void);
 extern void vicii_draw_cycle_init(void);
+extern int vicii_draw_cycle_is_quiet(void);
+extern void vicii_draw_cycle_quiet(void);
 
 struct snapshot_module_s;
 
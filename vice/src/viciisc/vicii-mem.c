@@ -333,6 +333,9 @@ void vicii_store(WORD addr, BYTE value)
 {
     addr &= 0x3f;
 
+    /* any register write ends a run of quiet cycles */
+    vicii.quiet_cycles = 0;
+
     vicii.last_bus_phi2 = value;
 
     VICII_DEBUG_REGISTER(("WRITE $D0%02X at cycle %d of current_line $%04X",
@@ -552,6 +555,9 @@ BYTE vicii_read(WORD addr)
     BYTE value;
     addr &= 0x3f;
 
+    /* reads may clear the collision registers, end quiet cycles */
+    vicii.quiet_cycles = 0;
+
     VICII_DEBUG_REGISTER(("READ $D0%02X at cycle %d of current_line $%04X:",
                           addr, vicii.raster_cycle, vicii.raster_line));
 
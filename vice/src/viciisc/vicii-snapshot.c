@@ -263,6 +263,10 @@ int vicii_snapshot_read_module(snapshot_t *s)
     if (vicii_draw_cycle_snapshot_read(m) < 0) {
         goto fail;
     }
+
+    /* restart with the full cycle handler */
+    vicii.quiet_cycles = 0;
+
     {
         unsigned int l = vicii.raster_line;
 
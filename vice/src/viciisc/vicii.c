@@ -312,6 +312,7 @@ void vicii_reset(void)
     vicii.raster_cycle = 6;
     /* this should probably be updated through some function */
     vicii.cycle_flags = 0;
+    vicii.quiet_cycles = 0;
     vicii.start_of_frame = 0;
     vicii.raster_irq_triggered = 0;
 
@@ -250,6 +250,10 @@ struct vicii_s {
     /* Counter used for DRAM refresh accesses.  */
     BYTE refresh_counter;
 
+    /* Number of remaining cycles on this line that can be run through
+       the reduced cycle handler (see vicii-cycle.c).  */
+    int quiet_cycles;
+
     /* Video chip capabilities.  */
     struct video_chip_cap_s *video_chip_cap;
 
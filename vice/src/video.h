@@ -242,6 +242,29 @@ extern void video_canvas_render(struct video_canvas_s *canvas, BYTE *trg,
                                 int width, int height, int xs, int ys,
                                 int xt, int yt, int pitcht, int depth);
 extern void video_canvas_refresh_all(struct video_canvas_s *canvas);
+
+/* `video_canvas_render()' without updating the colour tables, so it can run
+   on another thread after `video_canvas_render_prepare()'.  */
+extern void video_canvas_render_prepare(struct video_canvas_s *canvas);
+extern void video_canvas_render_prepared(struct video_canvas_s *canvas, BYTE *trg,
+                                         int width, int height, int xs, int ys,
+                                         int xt, int yt, int pitcht, int depth);
+
+#ifdef VIDEO_CANVAS_REFRESH_SPLIT
+/* `video_canvas_refresh()' in two steps.  The colour conversion into the
+   canvas image may run on another thread after
+   `video_canvas_refresh_prepare()'; it returns -1 if the canvas can only be
+   refreshed with `video_canvas_refresh()'.  Showing the image must run on
+   the UI thread.  */
+extern void video_canvas_refresh_prepare(struct video_canvas_s *canvas);
+extern int video_canvas_refresh_convert(struct video_canvas_s *canvas,
+                                        unsigned int xs, unsigned int ys,
+                                        unsigned int xi, unsigned int yi,
+                                        unsigned int w, unsigned int h);
+extern void video_canvas_refresh_show(struct video_canvas_s *canvas,
+                                      unsigned int xi, unsigned int yi,
+                                      unsigned int w, unsigned int h);
+#endif
 extern char video_canvas_can_resize(struct video_canvas_s *canvas);
 extern void video_viewport_get(struct video_canvas_s *canvas,
                                struct viewport_s **viewport,
@@ -37,6 +37,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "hosttimer.h"
 #include "lib.h"
 #include "log.h"
 #include "machine.h"
@@ -85,16 +86,12 @@ void video_canvas_shutdown(video_canvas_t *canvas)
     }
 }
 
-void video_canvas_render(video_canvas_t *canvas, BYTE *trg, int width,
-                         int height, int xs, int ys, int xt, int yt,
-                         int pitcht, int depth)
+/* Crt type the colour tables were last updated for.  */
+static int lastmode = -1;
+
+void video_canvas_render_prepare(video_canvas_t *canvas)
 {
-    static int lastmode = -1;
     viewport_t *viewport = canvas->viewport;
-#ifdef VIDEO_SCALE_SOURCE
-    xs /= canvas->videoconfig->scalex;
-    ys /= canvas->videoconfig->scaley;
-#endif
 
     /* when the color encoding changed, the palette must be recalculated */
     if (viewport->crt_type != lastmode) {
@@ -105,10 +102,31 @@ void video_canvas_render(video_canvas_t *canvas, BYTE *trg, int width,
     if (!canvas->videoconfig->color_tables.updated) { /* update colors as necessary */
         video_color_update_palette(canvas);
     }
+}
+
+void video_canvas_render_prepared(video_canvas_t *canvas, BYTE *trg,
+                                  int width, int height, int xs, int ys,
+                                  int xt, int yt, int pitcht, int depth)
+{
+#ifdef VIDEO_SCALE_SOURCE
+    xs /= canvas->videoconfig->scalex;
+    ys /= canvas->videoconfig->scaley;
+#endif
     video_render_main(canvas->videoconfig, canvas->draw_buffer->draw_buffer,
                       trg, width, height, xs, ys, xt, yt,
                       canvas->draw_buffer->draw_buffer_width, pitcht, depth,
-                      viewport);
+                      canvas->viewport);
+}
+
+void video_canvas_render(video_canvas_t *canvas, BYTE *trg, int width,
+                         int height, int xs, int ys, int xt, int yt,
+                         int pitcht, int depth)
+{
+    video_canvas_render_prepare(canvas);
+    HOSTTIMER_ENTER(HOSTTIMER_RENDER);
+    video_canvas_render_prepared(canvas, trg, width, height, xs, ys, xt, yt,
+                                 pitcht, depth);
+    HOSTTIMER_LEAVE();
 }
 
 void video_canvas_refresh_all(video_canvas_t *canvas)
@@ -52,9 +52,11 @@ int vsync_frame_counter;
 #include <limits.h>
 #endif
 
+#include "benchmark.h"
 #include "clkguard.h"
 #include "cmdline.h"
 #include "debug.h"
+#include "hosttimer.h"
 #include "log.h"
 #include "maincpu.h"
 #include "machine.h"
@@ -277,6 +279,15 @@ double vsync_get_refresh_frequency(void)
     return refresh_frequency;
 }
 
+/* Called at the end of every frame after the machine's vsync hook, used
+   when the emulator is embedded (see libvice.c).  */
+static void (*vsync_frame_callback)(void) = NULL;
+
+void vsync_set_frame_callback(void (*callback)(void))
+{
+    vsync_frame_callback = callback;
+}
+
 void vsync_init(void (*hook)(void))
 {
     vsync_hook = hook;
@@ -368,6 +379,15 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
 
     vsync_hook();
 
+    if (vsync_frame_callback != NULL) {
+        vsync_frame_callback();
+    }
+
+    benchmark_frame();
+#ifdef FEATURE_HOSTTIMERS
+    hosttimer_frame();
+#endif
+
     if (network_connected()) {
         network_hook_time = vsyncarch_gettime() - network_hook_time;
 
@@ -408,7 +428,9 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
     }
 
     /* Flush sound buffer, get delay in seconds. */
+    HOSTTIMER_ENTER(HOSTTIMER_SOUND);
     sound_delay = sound_flush();
+    HOSTTIMER_LEAVE();
 
     /* Get current time, directly after getting the sound delay. */
     now = vsyncarch_gettime();
@@ -466,7 +488,9 @@ int vsync_do_vsync(struct video_canvas_s *c, int been_skipped)
      */
     /*log_debug("vsync_do_vsync: sound_delay=%f  frame_ticks=%d  delay=%d", sound_delay, frame_ticks, delay);*/
     if (!warp_mode_enabled && timer_speed && delay < 0) {
+        HOSTTIMER_ENTER(HOSTTIMER_VSYNC);
         vsyncarch_sleep(-delay);
+        HOSTTIMER_LEAVE();
     }
 #if (defined(HAVE_OPENGL_SYNC)) && !defined(USE_SDLUI) && !defined(USE_SDLUI2)
     vsyncarch_prepare_vbl();
@@ -42,6 +42,7 @@ extern void vsync_sync_reset(void);
 extern int vsync_resources_init(void);
 extern int vsync_cmdline_options_init(void);
 extern void vsync_init(void (*hook)(void));
+extern void vsync_set_frame_callback(void (*callback)(void));
 extern void vsync_set_machine_parameter(double refresh_rate, long cycles);
 extern double vsync_get_refresh_frequency(void);
 extern int vsync_do_vsync(struct video_canvas_s *c, int been_skipped);